@@ -9,14 +9,26 @@
 #pragma once
 
 #include <Core/Application/Sketch.hpp>
+#include <Core/Application/Benchmark.hpp>
+#include <Core/Application/Input.hpp>
+#include <Core/Application/InputRecorder.hpp>
 #include <Core/Window/Window.hpp>
 #include <Core/Graphics/GraphicsContext.hpp>
+#include <Core/Graphics/RenderPipeline.hpp>
+#include <Core/Graphics/PerformanceOverlay.hpp>
 
 #include <Core/System/Types.hpp>
 #include <Core/System/Time.hpp>
 #include <Core/System/Stopwatch.hpp>
+#include <Core/System/FramePacer.hpp>
+#include <Core/System/FrameStatistics.hpp>
+#include <Core/System/SpscQueue.hpp>
+#include <Core/System/LatencyHistogram.hpp>
 
+#include <condition_variable>
 #include <memory>
+#include <mutex>
+#include <vector>
 
 namespace Core
 {
@@ -25,7 +37,7 @@ namespace Core
 	///		   sketch
 	/// 
 	////////////////////////////////////////////////////////////
-	class Application : public IEventListener<WindowEvent>
+	class Application : public IEventListener<WindowEvent>, private Benchmark::Host
 	{
 	public:
 
@@ -54,12 +66,36 @@ namespace Core
 		////////////////////////////////////////////////////////////
 		void Start();
 
+		////////////////////////////////////////////////////////////
+		/// \brief Run the sketch without a window and write a
+		///		   report of the frame timings
+		///
+		///	Every frame gets the same delta time and no frame rate
+		///	limit is applied. The events come from the recording in
+		///	Benchmark::Options::InputPath or, if there is none, from
+		///	Benchmark::GenerateEvents().
+		///
+		///	\return False if the run could not be completed
+		///
+		////////////////////////////////////////////////////////////
+		bool StartBenchmark(const Benchmark::Options& options);
+
 		////////////////////////////////////////////////////////////
 		/// \brief Start the exit process
 		/// 
 		////////////////////////////////////////////////////////////
 		void Exit();
 
+		////////////////////////////////////////////////////////////
+		/// \brief Request a new frame
+		///
+		///	Only needed in NoLoop mode, where the rendering thread
+		///	sleeps until there is something to draw. May be called
+		///	from any thread.
+		/// 
+		////////////////////////////////////////////////////////////
+		void Redraw();
+
 		////////////////////////////////////////////////////////////
 		/// \brief Event callback for window messages
 		/// 
@@ -74,6 +110,90 @@ namespace Core
 		////////////////////////////////////////////////////////////
 		void RenderThreadImpl();
 
+		////////////////////////////////////////////////////////////
+		/// \brief Deliver the events queued by the main thread to
+		///		   the graphics and the sketch
+		///
+		///	Runs on the rendering thread at the start of each frame.
+		/// 
+		////////////////////////////////////////////////////////////
+		void DispatchRenderEvents();
+
+		////////////////////////////////////////////////////////////
+		/// \brief Block the rendering thread in NoLoop mode until a
+		///		   redraw was requested, an event arrived, an
+		///		   animation is running or the application exits
+		///
+		///	\return True if the thread went to sleep
+		/// 
+		////////////////////////////////////////////////////////////
+		bool WaitForRedraw();
+
+		////////////////////////////////////////////////////////////
+		/// \brief Call Sketch::OnUpdate() once for every whole tick
+		///		   that elapsed and compute the interpolation alpha
+		///
+		///	At most MaxUpdatesPerFrame ticks are run per frame, the
+		///	remaining ones are dropped so a slow simulation can't
+		///	make every following frame slower still.
+		///
+		/// \param deltaTime The time elapsed since last frame
+		/// 
+		////////////////////////////////////////////////////////////
+		void RunFixedUpdates(const Time& deltaTime);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Let the sketch draw its content and its GUI, then
+		///		   draw the performance overlay on top
+		///
+		/// \param deltaTime The time elapsed since last frame
+		/// 
+		////////////////////////////////////////////////////////////
+		void DrawSketch(const Time& deltaTime);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Wake up the rendering thread if it is waiting in
+		///		   WaitForRedraw()
+		///
+		///	Called for every event, so it neither locks nor notifies
+		///	while the rendering thread is awake. The work must have
+		///	been published before the call.
+		/// 
+		////////////////////////////////////////////////////////////
+		void WakeRenderThread();
+
+		////////////////////////////////////////////////////////////
+		/// \brief Record the time from each event consumed by a
+		///		   frame until the frame has been presented
+		///
+		///	\param events		The events consumed by the frame
+		///	\param presented	When the frame was presented
+		/// 
+		////////////////////////////////////////////////////////////
+		void RecordPresentLatency(const std::vector<WindowEvent>& events, const Time& presented);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Restart the job workers if SetJobWorkerCount()
+		///		   asked for a different number of threads
+		///
+		///	Must be called from the thread that started the jobs,
+		///	see Jobs::Start().
+		/// 
+		////////////////////////////////////////////////////////////
+		void RestartJobs();
+
+		////////////////////////////////////////////////////////////
+		/// \brief Drive the offscreen graphics context and the
+		///		   fixed updates for Benchmark::Run()
+		/// 
+		////////////////////////////////////////////////////////////
+		virtual void BeginFrame() override;
+		virtual void Update(const Time& deltaTime) override;
+		virtual bool BeginDraw() override;
+		virtual void Draw(const Time& deltaTime) override;
+		virtual bool EndDraw() override;
+		virtual const RenderStats& GetRenderStats() const override;
+
 		////////////////////////////////////////////////////////////
 		/// \brief Counts and calculates the frames per second
 		///
@@ -91,13 +211,40 @@ namespace Core
 		std::unique_ptr<Sketch>	Sketch;				///< The client sketch
 		Window					Window;				///< The window to render on
 		GraphicsContext			Graphics;			///< The graphics context that is used for rendering.
+		Input					Input;				///< The keyboard and mouse state of the current frame, owned by the rendering thread
 		std::atomic_bool		IsRendering;		///< Keep the game loop alive
 		bool					AutoCloseEnabled;	///< State whether to close the app automatically on window close event
+		std::atomic_bool		LoopEnabled;		///< State whether to draw continuously or only on demand (NoLoop mode)
+		std::atomic_bool		RedrawRequested;	///< A frame was requested by Redraw() while in NoLoop mode
+		std::mutex				RedrawMutex;		///< Guards the sleep of the rendering thread in NoLoop mode
+		std::condition_variable	RedrawCondition;	///< Wakes the rendering thread in NoLoop mode
+		std::atomic_bool		RenderThreadSleeping;	///< Set while the rendering thread is in WaitForRedraw(), wake-ups are skipped otherwise
 		u32						TargetFps;			///< The number of frames per second the application wants to reach
+		u32						TickRate;			///< The number of Sketch::OnUpdate() calls per second, zero disables them
+		u32						MaxUpdatesPerFrame;	///< The number of ticks after which the rest of a frame's backlog is dropped
+		Time					UpdateAccumulator;	///< The elapsed time that has not been simulated yet
+		float					InterpolationAlpha;	///< The fraction of a tick in UpdateAccumulator, in [0, 1)
+		u64						DroppedUpdates;		///< The number of ticks dropped by the MaxUpdatesPerFrame clamp
 		u32						FramesPerSecond;	///< The actual number of frames per second
 		u32						FrameCount;			///< The number of frames counted since last time calculating the fps
 		Time					FpsTime;			///< Timer that is used to calculate the frames per second
-		Stopwatch				FrameTimer;			///< The time elapsed since last time the application slept to keep the frame rate limited
+		FramePacer				Pacer;				///< Keeps the frame rate limited to TargetFps (rendering thread only)
+		FrameStatistics			Statistics;			///< The timings of the recent frames, the budget follows TargetFps (rendering thread only)
+		Time					EventTimeout;		///< The maximum duration the main thread sleeps while waiting for window messages
+		SpscQueue<WindowEvent>	RenderEvents;		///< Carries window events from the main thread to the rendering thread
+		std::atomic<u32>		DroppedEvents;		///< The number of events dropped because the rendering thread fell behind
+		std::atomic_bool		GenericEventsEnabled;	///< State whether the sketch receives Generic events, the main thread subscribes to them when it wakes up next
+		LatencyHistogram		InputLatency;		///< Time from the creation of an event until the frame consuming it starts (rendering thread only)
+		LatencyHistogram		PresentLatency;		///< Time from the creation of an event until EndDraw() of the frame consuming it returned (rendering thread only)
+		std::vector<WindowEvent>	FrameEvents;		///< The events consumed by the current frame (rendering thread only)
+		InputRecorder			Recorder;			///< Writes the events of every frame to a file while a recording is in progress (rendering thread only)
+		bool					PipelineEnabled;	///< State whether to submit the frames on a separate thread, read once after Sketch::OnSetup()
+		RenderPipeline			Pipeline;			///< Submits the recorded frames in pipelined mode
+		std::vector<WindowEvent>	SubmittedEvents;	///< The events consumed by the frame in flight in pipelined mode (rendering thread only)
+		bool					OverlayEnabled;		///< State whether to draw the performance overlay after Sketch::OnDrawGui() (rendering thread only)
+		PerformanceOverlay		Overlay;			///< Shows the frame timings, renderer counters and memory use
+		std::atomic<u32>		WorkerCount;		///< The number of job worker threads started with the application, zero picks one per spare hardware thread
+		std::atomic_bool		WorkerCountChanged;	///< WorkerCount was changed, the thread that started the jobs restarts them when it wakes up next
 
 	};
 }
\ No newline at end of file
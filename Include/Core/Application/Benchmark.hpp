@@ -0,0 +1,198 @@
+﻿// 
+// Benchmark.hpp
+// Core
+// 
+// Created by Felix Busch on 19.10.2026.
+// Copyright © 2026 Felix Busch. All rights reserved.
+// 
+
+#pragma once
+
+#include <Core/Graphics/RenderStats.hpp>
+
+#include <Core/Window/WindowEvent.hpp>
+
+#include <Core/System/FrameStatistics.hpp>
+#include <Core/System/Time.hpp>
+#include <Core/System/Types.hpp>
+
+#include <filesystem>
+#include <vector>
+
+namespace Core
+{
+	////////////////////////////////////////////////////////////
+	/// Forward declaration
+	/// 
+	////////////////////////////////////////////////////////////
+	class Sketch;
+	class Input;
+
+	////////////////////////////////////////////////////////////
+	/// \brief Run a sketch without a window for a fixed number
+	///		   of frames and report how long the frames took.
+	/// 
+	///	Started by passing --benchmark to the executable:
+	/// 
+	///	\code
+	///	Sketch.exe --benchmark --frames 2000 --output bench.json
+	///	\endcode
+	/// 
+	///	The sketch renders into an offscreen software render
+	///	target with a fixed delta time, so the numbers can be
+	///	compared between machines and runs. The input is either
+	///	a recording made with StartRecording() or a synthetic,
+	///	deterministic stream of mouse and key events.
+	/// 
+	///	The frame loop itself doesn't depend on a renderer, the
+	///	Host supplies one. Application renders through Direct2D,
+	///	the core_bench test target through a CpuRenderTarget so
+	///	the same loop runs on Linux.
+	/// 
+	///	\see Application::StartBenchmark()
+	/// 
+	////////////////////////////////////////////////////////////
+	class Benchmark
+	{
+	public:
+
+		////////////////////////////////////////////////////////////
+		/// \brief Define what Run() needs from the renderer and
+		///		   the application around the sketch
+		/// 
+		////////////////////////////////////////////////////////////
+		class Host
+		{
+		public:
+
+			////////////////////////////////////////////////////////////
+			/// \brief Default destructor
+			/// 
+			////////////////////////////////////////////////////////////
+			virtual ~Host() = default;
+
+			////////////////////////////////////////////////////////////
+			/// \brief Prepare a frame before its events are read
+			/// 
+			///	Resets the renderer counters of the frame.
+			/// 
+			////////////////////////////////////////////////////////////
+			virtual void BeginFrame() = 0;
+
+			////////////////////////////////////////////////////////////
+			/// \brief Run the fixed updates of the sketch
+			/// 
+			////////////////////////////////////////////////////////////
+			virtual void Update(const Time& deltaTime) = 0;
+
+			////////////////////////////////////////////////////////////
+			/// \brief Start drawing into the render target
+			/// 
+			///	\return False to end the run
+			/// 
+			////////////////////////////////////////////////////////////
+			virtual bool BeginDraw() = 0;
+
+			////////////////////////////////////////////////////////////
+			/// \brief Let the sketch draw the frame
+			/// 
+			////////////////////////////////////////////////////////////
+			virtual void Draw(const Time& deltaTime) = 0;
+
+			////////////////////////////////////////////////////////////
+			/// \brief Finish the frame, timed as the EndDraw time
+			/// 
+			///	\return False to end the run
+			/// 
+			////////////////////////////////////////////////////////////
+			virtual bool EndDraw() = 0;
+
+			////////////////////////////////////////////////////////////
+			/// \brief Get the renderer counters of the current frame
+			/// 
+			////////////////////////////////////////////////////////////
+			virtual const RenderStats& GetRenderStats() const = 0;
+
+		};
+
+		////////////////////////////////////////////////////////////
+		/// \brief Define the settings of a run
+		/// 
+		////////////////////////////////////////////////////////////
+		struct Options
+		{
+			u32						FrameCount		= 1000;					///< --frames: the number of measured frames
+			u32						WarmupFrames	= 60;					///< --warmup: the frames run before measuring
+			u32						Width			= 1280;					///< --size WxH: the size of the render target
+			u32						Height			= 720;					///< --size WxH: the size of the render target
+			Time					FixedDelta		= Microseconds(16667);	///< --delta-ms: the delta time passed to the sketch
+			u32						Seed			= 1;					///< --seed: varies the synthetic events
+			std::filesystem::path	InputPath;								///< --input: a recording to replay instead of synthetic events
+			std::filesystem::path	OutputPath;								///< --output: where to write the report, the console if empty
+		};
+
+		////////////////////////////////////////////////////////////
+		/// \brief Check whether --benchmark is among the arguments
+		/// 
+		////////////////////////////////////////////////////////////
+		static bool IsRequested(int argc, char* argv[]);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Read the options from the command line
+		/// 
+		///	\return False if an argument is unknown or malformed
+		/// 
+		////////////////////////////////////////////////////////////
+		static bool ParseArguments(int argc, char* argv[], Options& options);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Create the synthetic events of a frame
+		/// 
+		///	The mouse follows a Lissajous curve over the render
+		///	target, the left button is clicked every half second
+		///	and the space key pressed every one and a half seconds
+		///	(at 60 frames per second). The same frame and seed
+		///	always produce the same events.
+		/// 
+		////////////////////////////////////////////////////////////
+		static void GenerateEvents(u32 frame, const Options& options, std::vector<WindowEvent>& events);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Write the report of a run as JSON
+		/// 
+		///	Contains the percentiles of the frame, draw and EndDraw
+		///	times in milliseconds, and the mean and maximum of every
+		///	renderer counter per frame.
+		/// 
+		///	\param options		The settings of the run
+		///	\param statistics	The timings of the measured frames
+		///	\param total		The sum of the counters of the measured frames
+		///	\param peak			The maximum of each counter in a single frame
+		///	\param eventCount	The number of events delivered
+		/// 
+		///	\return False if the report could not be written
+		/// 
+		////////////////////////////////////////////////////////////
+		static bool WriteReport(const Options& options, const FrameStatistics& statistics, const RenderStats& total, const RenderStats& peak, u64 eventCount);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Run a sketch for the frames of the options and
+		///		   write the report
+		/// 
+		///	Calls OnPreload() and OnSetup(), then feeds each frame
+		///	the recorded or synthetic events, lets the host update
+		///	and draw it and measures the time. OnDestroy() is called
+		///	once the frames are done or the host ended the run.
+		/// 
+		///	\param options	The settings of the run
+		///	\param sketch	The sketch to run, already created
+		///	\param input	The input snapshot the sketch reads
+		///	\param host		The renderer and updates around the sketch
+		/// 
+		///	\return False if the run could not be completed
+		/// 
+		////////////////////////////////////////////////////////////
+		static bool Run(const Options& options, Sketch& sketch, Input& input, Host& host);
+
+	};
+}
\ No newline at end of file
@@ -25,6 +25,11 @@ namespace Core
 	////////////////////////////////////////////////////////////
 	/// \brief Define event listener that updates the global
 	///		   variables.
+	///
+	///	The events are received on the main thread and published
+	///	through a triple buffer. The rendering thread takes over
+	///	the latest values once per frame in Latch(), so the globals
+	///	don't change (or tear) while a frame is drawn.
 	/// 
 	////////////////////////////////////////////////////////////
 	class GlobalUpdatingService final : public IEventListener<WindowEvent>
@@ -37,6 +42,16 @@ namespace Core
 		////////////////////////////////////////////////////////////
 		virtual void OnEvent(const WindowEvent& event) override;
 
+		////////////////////////////////////////////////////////////
+		/// \brief Update the globals from the latest published
+		///		   values.
+		///
+		///	Must be called by the rendering thread at the start of
+		///	each frame.
+		/// 
+		////////////////////////////////////////////////////////////
+		static void Latch();
+
 	};
 
 }
\ No newline at end of file
@@ -0,0 +1,168 @@
+﻿// 
+// Input.hpp
+// Core
+// 
+// Created by Felix Busch on 19.10.2026.
+// Copyright © 2026 Felix Busch. All rights reserved.
+// 
+
+#pragma once
+
+#include <Core/System/Types.hpp>
+#include <Core/System/Value2.hpp>
+
+#include <Core/Window/WindowEvent.hpp>
+#include <Core/Window/KeyCode.hpp>
+#include <Core/Window/MouseButton.hpp>
+#include <Core/Window/MouseWheel.hpp>
+
+#include <array>
+#include <bitset>
+
+namespace Core
+{
+	////////////////////////////////////////////////////////////
+	/// \brief Snapshot of the keyboard and mouse state for the
+	///		   current frame
+	/// 
+	///	The snapshot is built once per frame from the window
+	///	events, so every query is a single bit test or load
+	///	instead of tracking KeyPressed/KeyReleased events by hand.
+	/// 
+	///	Besides the held keys and buttons it records the edges of
+	///	the current frame (pressed or released since the last
+	///	frame), the accumulated wheel deltas and the distance the
+	///	mouse travelled.
+	/// 
+	////////////////////////////////////////////////////////////
+	class Input
+	{
+	public:
+
+		////////////////////////////////////////////////////////////
+		/// \brief Default constructor
+		/// 
+		////////////////////////////////////////////////////////////
+		Input();
+
+		////////////////////////////////////////////////////////////
+		/// \brief Start a new frame
+		/// 
+		///	Clears the edges, wheel deltas and mouse delta. Keys and
+		///	buttons that are held down stay down.
+		/// 
+		////////////////////////////////////////////////////////////
+		void BeginFrame();
+
+		////////////////////////////////////////////////////////////
+		/// \brief Apply a window event to the snapshot
+		/// 
+		////////////////////////////////////////////////////////////
+		void OnEvent(const WindowEvent& event);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Check whether a key is held down
+		/// 
+		////////////////////////////////////////////////////////////
+		[[nodiscard]] bool IsKeyDown(KeyCode key) const;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Check whether a key went down during the last frame
+		/// 
+		///	Key repeats don't count as new presses.
+		/// 
+		////////////////////////////////////////////////////////////
+		[[nodiscard]] bool IsKeyPressed(KeyCode key) const;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Check whether a key went up during the last frame
+		/// 
+		////////////////////////////////////////////////////////////
+		[[nodiscard]] bool IsKeyReleased(KeyCode key) const;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Check whether a mouse button is held down
+		/// 
+		////////////////////////////////////////////////////////////
+		[[nodiscard]] bool IsMouseButtonDown(MouseButton button) const;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Check whether a mouse button went down during the
+		///		   last frame
+		/// 
+		////////////////////////////////////////////////////////////
+		[[nodiscard]] bool IsMouseButtonPressed(MouseButton button) const;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Check whether a mouse button went up during the
+		///		   last frame
+		/// 
+		////////////////////////////////////////////////////////////
+		[[nodiscard]] bool IsMouseButtonReleased(MouseButton button) const;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Get the distance a wheel has been scrolled during
+		///		   the last frame
+		/// 
+		///	MouseWheel::Count and any value out of range return 0.
+		/// 
+		////////////////////////////////////////////////////////////
+		[[nodiscard]] float GetMouseWheelDelta(MouseWheel wheel) const;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Get the last known mouse position
+		/// 
+		////////////////////////////////////////////////////////////
+		[[nodiscard]] const Int2& GetMousePosition() const;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Get the distance the mouse has been moved during
+		///		   the last frame
+		/// 
+		////////////////////////////////////////////////////////////
+		[[nodiscard]] const Int2& GetMouseDelta() const;
+
+	private:
+
+		////////////////////////////////////////////////////////////
+		/// \brief Get the bit of a key
+		/// 
+		///	KeyCode::Unknown (-1), KeyCode::Count and any value out
+		///	of range map to bit 0, which is never set, so queries
+		///	for them return false.
+		/// 
+		////////////////////////////////////////////////////////////
+		static usize GetKeyIndex(KeyCode key);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Get the bit of a mouse button
+		/// 
+		///	MouseButton::Count and any value out of range map to no
+		///	bit at all.
+		/// 
+		////////////////////////////////////////////////////////////
+		static u32 GetButtonMask(MouseButton button);
+
+		////////////////////////////////////////////////////////////
+		/// The number of bits used for the keys
+		/// 
+		////////////////////////////////////////////////////////////
+		static constexpr usize KeyBitCount = (usize)KeyCode::Count + 1;
+
+		////////////////////////////////////////////////////////////
+		/// Member data
+		/// 
+		////////////////////////////////////////////////////////////
+		std::bitset<KeyBitCount>	keysDown;			///< The keys that are held down
+		std::bitset<KeyBitCount>	keysPressed;		///< The keys that went down this frame
+		std::bitset<KeyBitCount>	keysReleased;		///< The keys that went up this frame
+		u32							buttonsDown;		///< The mouse buttons that are held down
+		u32							buttonsPressed;		///< The mouse buttons that went down this frame
+		u32							buttonsReleased;	///< The mouse buttons that went up this frame
+		std::array<float, (usize)MouseWheel::Count>	wheelDeltas;	///< The scroll distance of each MouseWheel this frame
+		Int2						mousePosition;		///< The last known mouse position
+		Int2						mouseDelta;			///< The distance the mouse travelled this frame
+		bool						hasMousePosition;	///< Has the mouse position been received yet?
+
+	};
+}
\ No newline at end of file
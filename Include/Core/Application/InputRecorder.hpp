@@ -0,0 +1,102 @@
+﻿// 
+// InputRecorder.hpp
+// Core
+// 
+// Created by Felix Busch on 19.10.2026.
+// Copyright © 2026 Felix Busch. All rights reserved.
+// 
+
+#pragma once
+
+#include <Core/System/Types.hpp>
+#include <Core/System/Time.hpp>
+#include <Core/Window/WindowEvent.hpp>
+
+#include <filesystem>
+#include <fstream>
+#include <span>
+#include <vector>
+
+namespace Core
+{
+	////////////////////////////////////////////////////////////
+	/// \brief Write the window events and the delta time of each
+	///		   frame to a binary file
+	/// 
+	///	File layout (native byte order):
+	///		- header: the characters "CREC" and a u32 version
+	///		- per frame: i64 delta time in nanoseconds, u32 number
+	///		  of events, then every event as a u8 type followed by
+	///		  the bytes of its data member (nothing for types
+	///		  without data)
+	/// 
+	///	Generic events carry window handles that are meaningless
+	///	in another session and are not recorded.
+	/// 
+	///	The recording can be played back with InputReplay.
+	/// 
+	////////////////////////////////////////////////////////////
+	class InputRecorder
+	{
+	public:
+
+		////////////////////////////////////////////////////////////
+		/// The identification of the file format
+		/// 
+		////////////////////////////////////////////////////////////
+		static constexpr char Magic[4] = { 'C', 'R', 'E', 'C' };
+		static constexpr u32 Version = 1;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Get the number of bytes stored after the type of
+		///		   an event
+		/// 
+		////////////////////////////////////////////////////////////
+		static usize GetPayloadSize(WindowEvent::EventType type);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Create the file and write the header
+		/// 
+		///	A recording that is already open is closed first.
+		/// 
+		////////////////////////////////////////////////////////////
+		bool Open(const std::filesystem::path& filepath);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Flush and close the file
+		/// 
+		////////////////////////////////////////////////////////////
+		void Close();
+
+		////////////////////////////////////////////////////////////
+		/// \brief Check whether a recording is in progress
+		/// 
+		////////////////////////////////////////////////////////////
+		[[nodiscard]] bool IsOpen() const;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Append a frame
+		/// 
+		///	\param deltaTime	The time passed to Sketch::OnDraw()
+		///	\param events		The events delivered before the frame
+		/// 
+		////////////////////////////////////////////////////////////
+		void WriteFrame(const Time& deltaTime, std::span<const WindowEvent> events);
+
+	private:
+
+		////////////////////////////////////////////////////////////
+		/// \brief Append raw bytes to the frame buffer
+		/// 
+		////////////////////////////////////////////////////////////
+		void Append(const void* data, usize size);
+
+		////////////////////////////////////////////////////////////
+		/// Member data
+		/// 
+		////////////////////////////////////////////////////////////
+		std::ofstream		file;	///< The file being written
+		std::vector<char>	buffer;	///< The encoded frame, reused between frames
+
+	};
+}
\ No newline at end of file
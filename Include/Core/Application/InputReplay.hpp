@@ -0,0 +1,105 @@
+﻿// 
+// InputReplay.hpp
+// Core
+// 
+// Created by Felix Busch on 19.10.2026.
+// Copyright © 2026 Felix Busch. All rights reserved.
+// 
+
+#pragma once
+
+#include <Core/Application/Sketch.hpp>
+#include <Core/Application/Input.hpp>
+
+#include <Core/System/Types.hpp>
+#include <Core/System/Time.hpp>
+#include <Core/System/LatencyHistogram.hpp>
+#include <Core/Window/WindowEvent.hpp>
+
+#include <filesystem>
+#include <fstream>
+#include <vector>
+
+namespace Core
+{
+	////////////////////////////////////////////////////////////
+	/// \brief Play back a file written by InputRecorder
+	/// 
+	///	Frames can be read one by one, or fed into a sketch
+	///	without a window by Run(), which measures how long each
+	///	frame took. The sketch only receives OnEvent() and
+	///	OnDraw() calls, so it must not use the graphics unless an
+	///	Application with a graphics context is running.
+	/// 
+	////////////////////////////////////////////////////////////
+	class InputReplay
+	{
+	public:
+
+		////////////////////////////////////////////////////////////
+		/// \brief The delta time passed to Sketch::OnDraw()
+		/// 
+		////////////////////////////////////////////////////////////
+		enum Timestep
+		{
+			Recorded,	///< The delta time of the recorded frame
+			Fixed		///< The same delta time for every frame
+		};
+
+		////////////////////////////////////////////////////////////
+		/// \brief The results of Run()
+		/// 
+		////////////////////////////////////////////////////////////
+		struct Statistics
+		{
+			u64					FrameCount = 0;	///< The number of frames replayed
+			u64					EventCount = 0;	///< The number of events delivered
+			Time				TotalTime;		///< The time spent in the sketch
+			LatencyHistogram	FrameTimes;		///< The time spent per frame, from the first event until OnDraw() returned
+		};
+
+		////////////////////////////////////////////////////////////
+		/// \brief Open a recording and check its header
+		/// 
+		////////////////////////////////////////////////////////////
+		bool Open(const std::filesystem::path& filepath);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Close the recording
+		/// 
+		////////////////////////////////////////////////////////////
+		void Close();
+
+		////////////////////////////////////////////////////////////
+		/// \brief Read the next frame
+		/// 
+		///	\param deltaTime	Receives the recorded delta time
+		///	\param events		Receives the events of the frame
+		/// 
+		///	\return False at the end of the recording or if the
+		///			file is damaged
+		/// 
+		////////////////////////////////////////////////////////////
+		bool ReadFrame(Time& deltaTime, std::vector<WindowEvent>& events);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Replay the remaining frames against a sketch
+		/// 
+		///	\param sketch		The sketch to feed
+		///	\param input		Optional snapshot to update per frame
+		///	\param timestep		Where the delta times come from
+		///	\param fixedDelta	The delta time used by Timestep::Fixed
+		/// 
+		////////////////////////////////////////////////////////////
+		Statistics Run(Sketch& sketch, Input* input = nullptr, Timestep timestep = Recorded, const Time& fixedDelta = Microseconds(16667));
+
+	private:
+
+		////////////////////////////////////////////////////////////
+		/// Member data
+		/// 
+		////////////////////////////////////////////////////////////
+		std::ifstream file; ///< The recording being read
+
+	};
+}
\ No newline at end of file
@@ -52,6 +52,23 @@ namespace Core
 		////////////////////////////////////////////////////////////
 		virtual void OnDestroy();
 
+		////////////////////////////////////////////////////////////
+		/// \brief Advance the simulation by one fixed step
+		///
+		///	Called zero or more times per frame before OnDraw(), at
+		///	the tick rate set by SetTickRate(). OnDraw() can blend
+		///	between the last two simulation states with
+		///	GetInterpolationAlpha().
+		///
+		///	Pressed/released edges of the input snapshot cover the
+		///	whole frame, so they may be seen by several or by none
+		///	of the updates of a frame.
+		///
+		///	\param fixedDelta The duration of one step in seconds.
+		/// 
+		////////////////////////////////////////////////////////////
+		virtual void OnUpdate(float fixedDelta);
+
 		////////////////////////////////////////////////////////////
 		/// \brief Update variables & draw to screen
 		///
@@ -64,12 +81,26 @@ namespace Core
 		////////////////////////////////////////////////////////////
 		/// \brief Render ImGui content
 		///
+		///	Called every frame after OnDraw(), so the GUI is drawn
+		///	on top of the sketch. The performance overlay, when
+		///	enabled, is drawn after it.
+		///
 		////////////////////////////////////////////////////////////
 		virtual void OnDrawGui();
 
 		////////////////////////////////////////////////////////////
 		/// \brief OnEvent callback for window events. This method
 		///		   does nothing by default
+		///
+		///	Events are delivered on the rendering thread at the start
+		///	of each frame, before OnDraw() is called.
+		///
+		///	WindowEvent::Generic events with the raw window messages
+		///	are only delivered after SetGenericEventsEnabled(true),
+		///	so the window doesn't produce them for every sketch. The
+		///	subscription takes effect with the next message the main
+		///	thread handles, and these events are never recorded by
+		///	StartRecording().
 		/// 
 		////////////////////////////////////////////////////////////
 		virtual void OnEvent(const WindowEvent& event) override;
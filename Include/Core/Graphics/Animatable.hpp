@@ -11,9 +11,11 @@
 #include <Core/System/Time.hpp>
 #include <Core/System/Types.hpp>
 
+#include <atomic>
 #include <optional>
 #include <algorithm>
 #include <memory>
+#include <utility>
 
 #define CORE_DECLARE_ANIMATION(className, functionName, easeFunctionName)\
 	class className final : public Core::TimedAnimation {\
@@ -552,7 +554,7 @@ namespace Core
 
 		constexpr auto RepeatForever() const
 		{
-			static constexpr auto TruePredicate = [](u32 _) { return true; };
+			constexpr auto TruePredicate = [](u32) { return true; };
 			return Animator<RepeatAnimation<TAnimation, decltype(TruePredicate)>>({Animation, TruePredicate });
 		}
 
@@ -576,7 +578,7 @@ namespace Core
 
 		constexpr auto ReverseForever() const
 		{
-			static constexpr auto TruePredicate = [](u32 _) { return true; };
+			constexpr auto TruePredicate = [](u32) { return true; };
 			return Animator<ReverseAnimation<TAnimation, decltype(TruePredicate)>>({ Animation, TruePredicate });
 		}
 
@@ -669,6 +671,55 @@ namespace Core
 		return Animator<NullAnimation>({});
 	}
 
+	////////////////////////////////////////////////////////////
+	/// \brief Counts the Animatables that are currently
+	///		   animating.
+	///
+	///	The application keeps producing frames in NoLoop mode as
+	///	long as this count is not zero.
+	/// 
+	////////////////////////////////////////////////////////////
+	class AnimationCounter
+	{
+	public:
+
+		////////////////////////////////////////////////////////////
+		/// \brief Get the number of running animations.
+		/// 
+		////////////////////////////////////////////////////////////
+		static u32 GetCount()
+		{
+			return count.load(std::memory_order_relaxed);
+		}
+
+		////////////////////////////////////////////////////////////
+		/// \brief Register an animation that started running.
+		/// 
+		////////////////////////////////////////////////////////////
+		static void Increment()
+		{
+			count.fetch_add(1, std::memory_order_relaxed);
+		}
+
+		////////////////////////////////////////////////////////////
+		/// \brief Unregister an animation that stopped running.
+		/// 
+		////////////////////////////////////////////////////////////
+		static void Decrement()
+		{
+			count.fetch_sub(1, std::memory_order_relaxed);
+		}
+
+	private:
+
+		////////////////////////////////////////////////////////////
+		/// Static member data
+		/// 
+		////////////////////////////////////////////////////////////
+		inline static std::atomic<u32> count = 0; ///< The number of running animations
+
+	};
+
 	////////////////////////////////////////////////////////////
 	/// \brief Define animatable value wrapper.
 	/// 
@@ -760,6 +811,47 @@ namespace Core
 		{
 		}
 
+		////////////////////////////////////////////////////////////
+		/// \brief Take over the state of another Animatable.
+		/// 
+		////////////////////////////////////////////////////////////
+		Animatable(Animatable&& other) noexcept:
+			initialValue(std::move(other.initialValue)),
+			destinationValue(std::move(other.destinationValue)),
+			currentValue(std::move(other.currentValue)),
+			animating(std::exchange(other.animating, false)),
+			animation(std::move(other.animation))
+		{
+		}
+
+		////////////////////////////////////////////////////////////
+		/// \brief Take over the state of another Animatable.
+		/// 
+		////////////////////////////////////////////////////////////
+		Animatable& operator = (Animatable&& other) noexcept
+		{
+			if(this != &other)
+			{
+				SetAnimating(false);
+				initialValue = std::move(other.initialValue);
+				destinationValue = std::move(other.destinationValue);
+				currentValue = std::move(other.currentValue);
+				animating = std::exchange(other.animating, false);
+				animation = std::move(other.animation);
+			}
+
+			return *this;
+		}
+
+		////////////////////////////////////////////////////////////
+		/// \brief Unregister a running animation.
+		/// 
+		////////////////////////////////////////////////////////////
+		~Animatable()
+		{
+			SetAnimating(false);
+		}
+
 		////////////////////////////////////////////////////////////
 		/// \brief Start an animation to the retrieved value from
 		///		   \a function.
@@ -771,7 +863,7 @@ namespace Core
 			animation.reset(new AnimationContainer<TAnimation>(animator.Animation));
 			destinationValue = function();
 			initialValue = currentValue;
-			animating = true;
+			SetAnimating(true);
 		}
 
 		////////////////////////////////////////////////////////////
@@ -800,13 +892,36 @@ namespace Core
 
 				if(animation->IsDone())
 				{
-					animating = false;
+					SetAnimating(false);
 				}
 			}
 		}
 
+		////////////////////////////////////////////////////////////
+		/// \brief Get whether an animation is running.
+		/// 
+		////////////////////////////////////////////////////////////
+		bool IsAnimating() const
+		{
+			return animating;
+		}
+
 	private:
 
+		////////////////////////////////////////////////////////////
+		/// \brief Change the running state and keep the
+		///		   AnimationCounter in sync.
+		/// 
+		////////////////////////////////////////////////////////////
+		void SetAnimating(bool enabled)
+		{
+			if(animating == enabled)
+				return;
+
+			animating = enabled;
+			enabled ? AnimationCounter::Increment() : AnimationCounter::Decrement();
+		}
+
 		////////////////////////////////////////////////////////////
 		/// Member data
 		/// 
@@ -0,0 +1,176 @@
+﻿// 
+// CommandList.hpp
+// Core
+// 
+// Created by Felix Busch on 19.10.2026.
+// Copyright © 2026 Felix Busch. All rights reserved.
+// 
+
+#pragma once
+
+#include <Core/Graphics/Color.hpp>
+#include <Core/Graphics/Transformation.hpp>
+#include <Core/Graphics/Texture.hpp>
+
+#include <Core/System/Rectangle.hpp>
+#include <Core/System/Types.hpp>
+
+#include <vector>
+
+////////////////////////////////////////////////////////////
+/// Forward declaration
+/// 
+////////////////////////////////////////////////////////////
+struct IUnknown;
+struct ID2D1RenderTarget;
+struct ID2D1Bitmap;
+struct ID2D1Geometry;
+struct ID2D1StrokeStyle;
+struct ID2D1SolidColorBrush;
+
+namespace Core
+{
+	////////////////////////////////////////////////////////////
+	/// \brief Define a recorded sequence of draw commands.
+	/// 
+	///	The RenderTarget records into a command list instead of
+	///	drawing while one is set with SetCommandList(). Execute()
+	///	replays the commands on any thread later on.
+	/// 
+	///	Colors are copied, so changing the fill or stroke after
+	///	recording doesn't affect the list. Bitmaps, geometries
+	///	and stroke styles are referenced and kept alive until the
+	///	list is reset; their content is read at replay time.
+	/// 
+	////////////////////////////////////////////////////////////
+	class CommandList
+	{
+	public:
+
+		////////////////////////////////////////////////////////////
+		/// \brief Define the brushes and the outline of a shape.
+		/// 
+		////////////////////////////////////////////////////////////
+		struct Paint
+		{
+			Color				Fill;			///< The fill color
+			Color				Stroke;			///< The outline color
+			bool				HasFill;		///< State whether to fill the shape
+			bool				HasStroke;		///< State whether to outline the shape
+			float				StrokeWeight;	///< The outline thickness
+			ID2D1StrokeStyle*	StrokeStyle;	///< The outline style, may be nullptr
+		};
+
+		////////////////////////////////////////////////////////////
+		/// \brief Default constructor.
+		/// 
+		////////////////////////////////////////////////////////////
+		CommandList();
+
+		////////////////////////////////////////////////////////////
+		/// \brief Release the referenced resources.
+		/// 
+		////////////////////////////////////////////////////////////
+		~CommandList();
+
+		////////////////////////////////////////////////////////////
+		/// \brief Deleted copy operations, the list holds
+		///		   references.
+		/// 
+		////////////////////////////////////////////////////////////
+		CommandList(const CommandList&) = delete;
+		CommandList& operator = (const CommandList&) = delete;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Remove all commands and release the referenced
+		///		   resources.
+		/// 
+		////////////////////////////////////////////////////////////
+		void Reset();
+
+		////////////////////////////////////////////////////////////
+		/// \brief Record the commands of the RenderTarget.
+		/// 
+		///	Rectangles and ellipses are passed in their final
+		///	geometry, after the draw mode has been applied.
+		/// 
+		////////////////////////////////////////////////////////////
+		void Background(const Color& color);
+		void RoundedRectangle(const Matrix3x2& transform, const FloatRect& rectangle, float cornerX, float cornerY, const Paint& paint);
+		void Ellipse(const Matrix3x2& transform, float centerX, float centerY, float radiusX, float radiusY, const Paint& paint);
+		void Line(const Matrix3x2& transform, float x1, float y1, float x2, float y2, const Paint& paint);
+		void Geometry(const Matrix3x2& transform, ID2D1Geometry* geometry, const Paint& paint);
+		void Bitmap(ID2D1Bitmap* bitmap, const FloatRect& destination, float opacity, Texture::SampleMode sampleMode, const FloatRect& source);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Record a transformation for the bitmaps that
+		///		   follow.
+		/// 
+		////////////////////////////////////////////////////////////
+		void Transform(const Matrix3x2& transform);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Replay the commands on a render target.
+		/// 
+		///	Must be called between BeginDraw() and EndDraw() of
+		///	the target.
+		/// 
+		////////////////////////////////////////////////////////////
+		void Execute(ID2D1RenderTarget& target);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Get the number of recorded commands.
+		/// 
+		////////////////////////////////////////////////////////////
+		[[nodiscard]] usize GetSize() const;
+
+	private:
+
+		////////////////////////////////////////////////////////////
+		/// \brief Define a single recorded command.
+		/// 
+		////////////////////////////////////////////////////////////
+		struct Command
+		{
+			enum CommandType : u8
+			{
+				Background,
+				RoundedRectangle,
+				Ellipse,
+				Line,
+				Geometry,
+				Bitmap,
+				SetTransform
+			};
+
+			CommandType	Type;			///< The kind of command
+			Matrix3x2	Transform;		///< The transformation (unused by Background and Bitmap)
+			float		Values[6];		///< The coordinates, depending on the type
+			FloatRect	Source;			///< The source rectangle of a bitmap
+			Paint		Style;			///< The brushes, or the clear color in Style.Fill
+			IUnknown*	Resource;		///< The referenced geometry or bitmap
+		};
+
+		////////////////////////////////////////////////////////////
+		/// \brief Append a command and take references to its
+		///		   resources.
+		/// 
+		////////////////////////////////////////////////////////////
+		void Record(const Command& command);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Get the replay brush in the given color.
+		/// 
+		////////////////////////////////////////////////////////////
+		ID2D1SolidColorBrush* GetBrush(ID2D1RenderTarget& target, const Color& color);
+
+		////////////////////////////////////////////////////////////
+		/// Member data
+		/// 
+		////////////////////////////////////////////////////////////
+		std::vector<Command>	commands;		///< The recorded commands
+		ID2D1SolidColorBrush*	brush;			///< The brush used for every replayed fill and outline
+		ID2D1RenderTarget*		brushTarget;	///< The render target the brush was created for
+
+	};
+}
\ No newline at end of file
@@ -0,0 +1,226 @@
+﻿// 
+// CpuRenderTarget.hpp
+// Core
+// 
+// Created by Felix Busch on 19.10.2026.
+// Copyright © 2026 Felix Busch. All rights reserved.
+// 
+
+#pragma once
+
+#include <Core/Graphics/Color.hpp>
+#include <Core/Graphics/DrawMode.hpp>
+#include <Core/Graphics/PixelBuffer.hpp>
+#include <Core/Graphics/RenderStats.hpp>
+#include <Core/Graphics/Transformation.hpp>
+
+#include <Core/System/Types.hpp>
+
+#include <stack>
+#include <vector>
+
+namespace Core
+{
+	////////////////////////////////////////////////////////////
+	/// \brief Draw shapes into a PixelBuffer on the CPU.
+	/// 
+	///	Offers the rectangle, ellipse and line primitives of the
+	///	RenderTarget together with its styles and transformation
+	///	stack, and counts them into the same RenderStats. It has
+	///	no dependency on Direct2D, so sketches written against it
+	///	run wherever the portable part of Core builds, e.g. the
+	///	core_bench target on the Linux CI machines.
+	/// 
+	///	The output is not meant to match Direct2D pixel by pixel:
+	///	rounded corners are drawn square, ellipses as polygons and
+	///	there is no antialiasing.
+	/// 
+	////////////////////////////////////////////////////////////
+	class CpuRenderTarget
+	{
+	public:
+
+		////////////////////////////////////////////////////////////
+		/// \brief Default constructor.
+		/// 
+		////////////////////////////////////////////////////////////
+		CpuRenderTarget();
+
+		////////////////////////////////////////////////////////////
+		/// \brief Resize the pixel buffer to draw into.
+		/// 
+		///	The content is cleared to transparent black.
+		/// 
+		////////////////////////////////////////////////////////////
+		void Resize(u32 width, u32 height);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Start drawing a frame.
+		/// 
+		///	\return False if the pixel buffer has no size
+		/// 
+		////////////////////////////////////////////////////////////
+		bool BeginDraw();
+
+		////////////////////////////////////////////////////////////
+		/// \brief Finish drawing a frame.
+		/// 
+		///	The pixels are written immediately, so there is nothing
+		///	left to submit.
+		/// 
+		////////////////////////////////////////////////////////////
+		bool EndDraw();
+
+		////////////////////////////////////////////////////////////
+		/// \brief Clear the pixel buffer to an opaque color.
+		/// 
+		////////////////////////////////////////////////////////////
+		void Background(const Color& color);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Set or disable the fill and outline of the
+		///		   following shapes.
+		/// 
+		////////////////////////////////////////////////////////////
+		void Fill(const Color& color);
+		void NoFill();
+		void Stroke(const Color& color);
+		void NoStroke();
+		void StrokeWeight(float weight);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Draw a rectangle, interpreted by the RectMode.
+		/// 
+		///	The corner radii are accepted for compatibility with
+		///	RenderTarget::Rect() but ignored.
+		/// 
+		////////////////////////////////////////////////////////////
+		void RectMode(DrawMode mode);
+		void Rect(float x1, float y1, float x2, float y2, float cornerX = 0.0f, float cornerY = 0.0f);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Draw an ellipse, interpreted by the EllipseMode.
+		/// 
+		////////////////////////////////////////////////////////////
+		void EllipseMode(DrawMode mode);
+		void Ellipse(float a, float b, float c, float d);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Draw a line with the stroke color and weight.
+		/// 
+		////////////////////////////////////////////////////////////
+		void Line(float x1, float y1, float x2, float y2);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Manipulate the transformation of the current
+		///		   style, see RenderTarget.
+		/// 
+		////////////////////////////////////////////////////////////
+		void PushTransform(bool advance);
+		void PopTransform();
+		void ResetTransform();
+		void Translate(float x, float y);
+		void Rotate(const Angle& rotation);
+		void Scale(float factorX, float factorY);
+		const Transformation& GetTransform() const;
+		Transformation& GetTransform();
+
+		////////////////////////////////////////////////////////////
+		/// \brief Save and restore the whole style.
+		/// 
+		////////////////////////////////////////////////////////////
+		void PushStyle();
+		void PopStyle();
+
+		////////////////////////////////////////////////////////////
+		/// \brief Get the pixels drawn so far.
+		/// 
+		////////////////////////////////////////////////////////////
+		const PixelBuffer& GetPixelBuffer() const;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Get the counters of the current frame so far.
+		/// 
+		////////////////////////////////////////////////////////////
+		const RenderStats& GetRenderStats() const;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Get the counters of the previous, complete frame.
+		/// 
+		////////////////////////////////////////////////////////////
+		const RenderStats& GetPreviousRenderStats() const;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Keep the counters of the finished frame and start
+		///		   counting the next one.
+		/// 
+		////////////////////////////////////////////////////////////
+		void ResetRenderStats();
+
+	private:
+
+		////////////////////////////////////////////////////////////
+		/// \brief Define the state set by the style functions.
+		/// 
+		////////////////////////////////////////////////////////////
+		struct Style
+		{
+			Color						FillColor;				///< The color to fill shapes with
+			Color						StrokeColor;			///< The color to outline shapes with
+			bool						HasFill		= false;	///< State whether shapes are filled
+			bool						HasStroke	= false;	///< State whether shapes are outlined
+			float						StrokeWeight = 1.0f;	///< The outline thickness
+			DrawMode					RectMode	= Corner;	///< The draw mode to use for rectangles
+			DrawMode					EllipseMode	= Center;	///< The draw mode to use for ellipses
+			std::stack<Transformation>	Transform;				///< The transformation to apply to the shapes
+		};
+
+		////////////////////////////////////////////////////////////
+		/// \brief Fill and outline the polygon in shape.
+		/// 
+		////////////////////////////////////////////////////////////
+		void DrawShape(const Style& style);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Fill a polygon given in the coordinates of the
+		///		   current transformation (even-odd rule).
+		/// 
+		////////////////////////////////////////////////////////////
+		void FillPolygon(const Float2* points, usize count, const Color& color);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Fill the quad around a line segment.
+		/// 
+		////////////////////////////////////////////////////////////
+		void StrokeSegment(const Float2& from, const Float2& to, float weight, const Color& color);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Count a draw call of a filled and/or outlined
+		///		   primitive, see RenderTarget.
+		/// 
+		////////////////////////////////////////////////////////////
+		bool CountDraw(u32& counter, bool hasFill, bool hasStroke);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Count a change of the transformation since the
+		///		   last primitive, see RenderTarget.
+		/// 
+		////////////////////////////////////////////////////////////
+		void ChangeTransform();
+
+		////////////////////////////////////////////////////////////
+		/// Member data
+		/// 
+		////////////////////////////////////////////////////////////
+		std::stack<Style>	styles;			///< The rendering styles
+		PixelBuffer			pixels;			///< The pixels drawn into
+		std::vector<Float2>	shape;			///< The outline of the primitive being drawn
+		std::vector<Float2>	polygon;		///< The polygon being filled in pixel coordinates
+		std::vector<float>	crossings;		///< The edges crossing the row being filled
+		RenderStats			stats;			///< The counters of the current frame
+		RenderStats			previousStats;	///< The counters of the previous frame
+		Matrix3x2			transform;		///< The transformation used last in this frame
+		bool				transformSet;	///< State whether transform is valid
+
+	};
+}
\ No newline at end of file
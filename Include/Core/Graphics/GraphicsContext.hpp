@@ -16,6 +16,7 @@
 #include <Core/Graphics/RenderTarget.hpp>
 
 #include <memory>
+#include <mutex>
 
 namespace Core
 {
@@ -65,6 +66,19 @@ namespace Core
 		////////////////////////////////////////////////////////////
 		bool Create(const Window& window);
 
+		////////////////////////////////////////////////////////////
+		/// \brief Creates a graphics context that renders into a
+		///		   bitmap in memory instead of a window.
+		///
+		///	The content is rendered in software, used to run
+		///	sketches without a window (see Benchmark).
+		///
+		///	\return True if the context has been setup successfully,
+		///			false otherwise.
+		/// 
+		////////////////////////////////////////////////////////////
+		bool CreateOffscreen(u32 width, u32 height);
+
 		////////////////////////////////////////////////////////////
 		/// \brief Destroys the graphics context.
 		/// 
@@ -141,5 +155,6 @@ namespace Core
 		////////////////////////////////////////////////////////////
 		std::shared_ptr<Impl>							impl;			///< Pointer to implementation class.
 		SizeCache										sizeCache;		///< A cache for sizing information for the next frame.
+		std::mutex										sizeMutex;		///< Guards the size cache, BeginDraw() runs on the submission thread in pipelined mode.
 	};
 }
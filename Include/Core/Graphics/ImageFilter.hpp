@@ -0,0 +1,114 @@
+﻿// 
+// ImageFilter.hpp
+// Core
+// 
+// Created by Felix Busch on 19.10.2026.
+// Copyright © 2026 Felix Busch. All rights reserved.
+// 
+
+#pragma once
+
+#include <Core/Graphics/PixelBuffer.hpp>
+
+#include <Core/System/Types.hpp>
+
+namespace Core
+{
+
+	////////////////////////////////////////////////////////////
+	/// \brief Define static class that applies image filters
+	///		   to a pixel buffer.
+	/// 
+	///	The image is split into bands of rows that are processed
+	///	in parallel (see Parallel::For()). The kernels use SSE2
+	///	where available and treat pixels outside of the image as
+	///	copies of the nearest edge pixel.
+	/// 
+	////////////////////////////////////////////////////////////
+	class ImageFilter
+	{
+	public:
+
+		////////////////////////////////////////////////////////////
+		/// The available filters
+		/// 
+		////////////////////////////////////////////////////////////
+		enum Type
+		{
+			Blur,		///< Gaussian blur, the parameter is the radius in pixels
+			BoxBlur,	///< Box blur, the parameter is the radius in pixels
+			Threshold,	///< Black or white depending on the brightness, the parameter is the level in [0, 1]
+			Invert,		///< Invert the color channels
+			Gray,		///< Convert the colors to grayscale
+			Erode,		///< Shrink bright areas
+			Dilate		///< Grow bright areas
+		};
+
+		////////////////////////////////////////////////////////////
+		/// The available resampling filters
+		/// 
+		////////////////////////////////////////////////////////////
+		enum ResampleFilter
+		{
+			Box,		///< Average of the covered pixels
+			Bilinear,	///< Triangle filter
+			Bicubic,	///< Catmull-Rom spline
+			Lanczos3	///< Windowed sinc with three lobes
+		};
+
+		////////////////////////////////////////////////////////////
+		/// \brief Apply a filter with its default parameter.
+		/// 
+		///	Blurs use a radius of 1 and Threshold a level of 0.5.
+		/// 
+		////////////////////////////////////////////////////////////
+		static void Apply(PixelBuffer& pixels, Type type);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Apply a filter.
+		/// 
+		///	The whole buffer is marked as modified afterwards.
+		/// 
+		/// \param pixels		The pixels to filter in place
+		/// \param type			The filter to apply
+		/// \param parameter	The filter specific parameter, it is
+		///						ignored by filters that don't need one
+		/// 
+		////////////////////////////////////////////////////////////
+		static void Apply(PixelBuffer& pixels, Type type, float parameter);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Convolve the pixels with a square kernel.
+		/// 
+		///	Only the straight color channels are convolved, every
+		///	pixel keeps its alpha. Kernels that sum to zero (edge
+		///	detection, emboss) therefore give an opaque image for an
+		///	opaque source.
+		/// 
+		/// \param pixels	The pixels to filter in place
+		/// \param kernel	size * size weights in row major order
+		/// \param size		The width of the kernel, must be odd
+		///					(e.g. 3 or 5)
+		/// 
+		////////////////////////////////////////////////////////////
+		static void Convolve(PixelBuffer& pixels, const float* kernel, u32 size);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Resample the pixels into a buffer of a different
+		///		   size.
+		/// 
+		///	The filter weights are precomputed per destination row
+		///	and column and applied in two separable passes.
+		/// 
+		/// \param source		The pixels to resample
+		/// \param destination	Receives the resampled pixels, must
+		///						not be the source buffer
+		/// \param width		The width of the destination
+		/// \param height		The height of the destination
+		/// \param filter		The resampling filter
+		/// 
+		////////////////////////////////////////////////////////////
+		static void Resize(const PixelBuffer& source, PixelBuffer& destination, u32 width, u32 height, ResampleFilter filter);
+	};
+
+}
\ No newline at end of file
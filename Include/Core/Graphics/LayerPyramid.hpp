@@ -0,0 +1,314 @@
+﻿// 
+// LayerPyramid.hpp
+// Core
+// 
+// Created by Felix Busch on 19.10.2026.
+// Copyright © 2026 Felix Busch. All rights reserved.
+// 
+
+#pragma once
+
+#include <Core/System/Types.hpp>
+#include <Core/System/Time.hpp>
+#include <Core/System/Stopwatch.hpp>
+
+#include <list>
+#include <vector>
+
+namespace Core
+{
+
+	////////////////////////////////////////////////////////////
+	/// \brief Define the bookkeeping of a pyramid of cached
+	///		   layers.
+	/// 
+	///	A layer of level 0 covers a single chunk, every level
+	///	above covers four layers of the level below at half the
+	///	resolution, up to a single layer covering everything.
+	///	The pyramid decides which layers have to be rendered and
+	///	which ones are released to stay within a memory budget,
+	///	the pixels are owned by a Renderer.
+	/// 
+	///	A coarse layer is rendered one quadrant at a time from
+	///	its children. A child is only needed until it has been
+	///	copied into its quadrant and may be released right after,
+	///	so building a coarse layer keeps at most one layer per
+	///	level alive instead of the whole subtree. The quadrants
+	///	already rendered survive when the time budget runs out
+	///	and the work continues with the next frame.
+	/// 
+	///	Once a layer has been rendered, a changed chunk only
+	///	marks its own cell of the layer as outdated. The cell is
+	///	rendered again straight from the chunk at the resolution
+	///	of the layer, so an edit never needs the children of a
+	///	coarse layer, which may have been released long ago.
+	/// 
+	////////////////////////////////////////////////////////////
+	class LayerPyramid
+	{
+	public:
+
+		////////////////////////////////////////////////////////////
+		/// \brief Define the interface that owns and renders the
+		///		   pixels of the layers.
+		/// 
+		////////////////////////////////////////////////////////////
+		class Renderer
+		{
+		public:
+
+			////////////////////////////////////////////////////////////
+			/// \brief Virtual default destructor.
+			/// 
+			////////////////////////////////////////////////////////////
+			virtual ~Renderer() = default;
+
+			////////////////////////////////////////////////////////////
+			/// \brief Allocate a layer, its content may be undefined.
+			/// 
+			////////////////////////////////////////////////////////////
+			virtual bool CreateLayer(u32 level, u32 x, u32 y) = 0;
+
+			////////////////////////////////////////////////////////////
+			/// \brief Release the memory of a layer.
+			/// 
+			////////////////////////////////////////////////////////////
+			virtual void ReleaseLayer(u32 level, u32 x, u32 y) = 0;
+
+			////////////////////////////////////////////////////////////
+			/// \brief Render the content of a chunk into its layer of
+			///		   level 0.
+			/// 
+			////////////////////////////////////////////////////////////
+			virtual bool RenderChunk(u32 x, u32 y) = 0;
+
+			////////////////////////////////////////////////////////////
+			/// \brief Render a quadrant of a layer above level 0.
+			/// 
+			///	The quadrants are numbered 0 to 3 row by row. The
+			///	quadrant shows the child at (2x + quadrant % 2,
+			///	2y + quadrant / 2) of the level below, scaled down to
+			///	half its size, or is cleared if that child is empty.
+			/// 
+			////////////////////////////////////////////////////////////
+			virtual bool RenderQuadrant(u32 level, u32 x, u32 y, u32 quadrant, bool empty) = 0;
+
+			////////////////////////////////////////////////////////////
+			/// \brief Render a single chunk into the cell of a layer
+			///		   above level 0 that covers it.
+			/// 
+			///	The cell is 1 / 2^level of the layer in each direction.
+			///	It shows the content of the chunk at that resolution,
+			///	or is cleared if the chunk is empty.
+			/// 
+			////////////////////////////////////////////////////////////
+			virtual bool RenderCell(u32 level, u32 x, u32 y, u32 chunkX, u32 chunkY, bool empty) = 0;
+		};
+
+		////////////////////////////////////////////////////////////
+		/// \brief Default constructor.
+		/// 
+		////////////////////////////////////////////////////////////
+		LayerPyramid();
+
+		////////////////////////////////////////////////////////////
+		/// \brief Create the levels for a grid of chunks.
+		/// 
+		///	Every chunk starts empty, layers of the previous grid
+		///	must have been released by the renderer.
+		/// 
+		///	\param width		The number of chunks per row
+		///	\param height		The number of rows of chunks
+		///	\param layerBytes	The memory held by a single layer
+		///	\param byteBudget	The maximum memory held by layers
+		/// 
+		////////////////////////////////////////////////////////////
+		void Create(u32 width, u32 height, usize layerBytes, usize byteBudget);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Mark the layers containing a chunk as outdated.
+		/// 
+		///	Layers above level 0 that have been rendered before
+		///	only render the cell of the chunk again.
+		/// 
+		///	\param delta The change of the number of non-empty
+		///				 items of the chunk
+		/// 
+		////////////////////////////////////////////////////////////
+		void Invalidate(u32 x, u32 y, i32 delta);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Replace the number of non-empty items of every
+		///		   chunk and mark all layers as outdated.
+		/// 
+		///	\param counts The counts of the chunks in row major order
+		/// 
+		////////////////////////////////////////////////////////////
+		void Reset(const std::vector<u32>& counts);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Start a new frame.
+		/// 
+		///	Layers used by the previous frame are no longer pinned
+		///	and the time budget starts over.
+		/// 
+		///	\param buildBudget The time for rendering layers in this
+		///					   frame, at least one layer or quadrant
+		///					   is rendered regardless
+		/// 
+		////////////////////////////////////////////////////////////
+		void BeginFrame(const Time& buildBudget);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Make sure a layer is up to date and pin it for the
+		///		   current frame.
+		/// 
+		///	\return True if the layer can be drawn or is empty,
+		///			false if the time budget ran out first.
+		/// 
+		////////////////////////////////////////////////////////////
+		bool Build(Renderer& renderer, u32 level, u32 x, u32 y);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Find the finest layer that can stand in for a
+		///		   layer that is not up to date.
+		/// 
+		///	Starts with the layer itself and walks up the levels.
+		///	The layer found is pinned for the current frame and may
+		///	be outdated, but it has been rendered completely once.
+		/// 
+		///	\param level Receives the level of the layer found
+		/// 
+		///	\return False if no layer can be drawn.
+		/// 
+		////////////////////////////////////////////////////////////
+		bool FindFallback(u32 level, u32 x, u32 y, u32& fallback);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Release every layer.
+		/// 
+		////////////////////////////////////////////////////////////
+		void Release(Renderer& renderer);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Get the number of non-empty items covered by a
+		///		   layer.
+		/// 
+		////////////////////////////////////////////////////////////
+		u32 GetCount(u32 level, u32 x, u32 y) const;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Get the number of levels.
+		/// 
+		////////////////////////////////////////////////////////////
+		u32 GetLevelCount() const;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Get the number of layers of a level in each
+		///		   direction.
+		/// 
+		////////////////////////////////////////////////////////////
+		u32 GetWidth(u32 level) const;
+		u32 GetHeight(u32 level) const;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Get the memory held by resident layers.
+		/// 
+		////////////////////////////////////////////////////////////
+		usize GetUsedBytes() const;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Get the number of chunks, quadrants and cells
+		///		   rendered in the current frame.
+		/// 
+		////////////////////////////////////////////////////////////
+		u32 GetBuiltCount() const;
+
+	private:
+
+		////////////////////////////////////////////////////////////
+		/// \brief Define the state of a single layer.
+		/// 
+		////////////////////////////////////////////////////////////
+		struct Node
+		{
+			u32							Count = 0;			///< The number of non-empty items covered
+			u8							Stale = 0xF;		///< The quadrants that have to be rendered, all of them on level 0
+			bool						Resident = false;	///< Whether the renderer holds the layer
+			bool						Complete = false;	///< Whether every quadrant has been rendered once
+			u64							LastUsed = 0;		///< The frame that pinned the layer last
+			std::list<u64>::iterator	Position;			///< The position in the usage list
+			std::vector<u64>			Cells;				///< One bit per covered chunk that has to be rendered again
+			u32							CellCount = 0;		///< The number of bits set in Cells
+		};
+
+		////////////////////////////////////////////////////////////
+		/// \brief Define all layers of the same resolution.
+		/// 
+		////////////////////////////////////////////////////////////
+		struct Level
+		{
+			u32					Width;	///< The number of layers per row
+			u32					Height;	///< The number of rows
+			std::vector<Node>	Nodes;	///< The layers in row major order
+		};
+
+		////////////////////////////////////////////////////////////
+		/// \brief Build a layer.
+		/// 
+		///	\param pin Whether the layer is used by the current
+		///			   frame, layers only needed to render their
+		///			   parent are released first
+		/// 
+		////////////////////////////////////////////////////////////
+		bool Build(Renderer& renderer, u32 level, u32 x, u32 y, bool pin);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Check whether a layer is resident and up to date.
+		/// 
+		////////////////////////////////////////////////////////////
+		static bool IsCurrent(const Node& node);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Mark a layer as released by the renderer.
+		/// 
+		////////////////////////////////////////////////////////////
+		static void Discard(Node& node);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Pin a resident layer for the current frame.
+		/// 
+		////////////////////////////////////////////////////////////
+		void Touch(Node& node);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Release least recently used layers that are not
+		///		   pinned until the memory fits into the budget.
+		/// 
+		////////////////////////////////////////////////////////////
+		void Evict(Renderer& renderer, usize reserve);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Check whether the time budget of the frame has
+		///		   been used up.
+		/// 
+		////////////////////////////////////////////////////////////
+		bool IsOutOfTime() const;
+
+		////////////////////////////////////////////////////////////
+		/// Member data
+		/// 
+		////////////////////////////////////////////////////////////
+		std::vector<Level>	levels;		///< The layers, from the finest to a single one
+		std::list<u64>		usage;		///< Resident layers, most recently used first
+		usize				layerBytes;	///< The memory held by a single layer
+		usize				usedBytes;	///< The memory held by resident layers
+		usize				byteBudget;	///< The maximum memory held by layers
+		u64					frame;		///< The number of frames so far
+		Time				budget;		///< The time for rendering layers per frame
+		Stopwatch			watch;		///< Measures the time spent in the frame
+		u32					built;		///< The chunks and quadrants rendered in the frame
+
+	};
+
+}
\ No newline at end of file
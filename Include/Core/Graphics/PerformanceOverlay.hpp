@@ -0,0 +1,120 @@
+﻿// 
+// PerformanceOverlay.hpp
+// Core
+// 
+// Created by Felix Busch on 19.10.2026.
+// Copyright © 2026 Felix Busch. All rights reserved.
+// 
+
+#pragma once
+
+#include <Core/Graphics/RenderStats.hpp>
+
+#include <Core/System/FrameStatistics.hpp>
+#include <Core/System/Stopwatch.hpp>
+#include <Core/System/Time.hpp>
+#include <Core/System/Types.hpp>
+
+#include <memory>
+
+namespace Core
+{
+	////////////////////////////////////////////////////////////
+	/// Forward declarations
+	/// 
+	////////////////////////////////////////////////////////////
+	class RenderTarget;
+
+	////////////////////////////////////////////////////////////
+	/// \brief Draw frame timings, renderer counters and memory
+	///		   use on top of the sketch.
+	/// 
+	///	The panel shows a rolling graph of the recent frame times
+	///	against the frame budget, the percentiles of the frame
+	///	time, the draw calls of the previous frame and the memory
+	///	of the process.
+	/// 
+	///	The panel is rendered into a cached layer that is only
+	///	updated every GetRefreshInterval(). In between, drawing it
+	///	costs a single bitmap, so the overlay stays cheap enough
+	///	to be left on while diagnosing a running application.
+	/// 
+	////////////////////////////////////////////////////////////
+	class PerformanceOverlay
+	{
+	public:
+
+		////////////////////////////////////////////////////////////
+		/// The size of the panel in device independent pixels
+		/// 
+		////////////////////////////////////////////////////////////
+		static constexpr u32 Width = 300;
+		static constexpr u32 Height = 164;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Default constructor.
+		/// 
+		////////////////////////////////////////////////////////////
+		PerformanceOverlay();
+
+		////////////////////////////////////////////////////////////
+		/// \brief Release the layer.
+		/// 
+		////////////////////////////////////////////////////////////
+		~PerformanceOverlay();
+
+		////////////////////////////////////////////////////////////
+		/// \brief Draw the panel.
+		/// 
+		///	Call on the render thread, after the sketch has drawn.
+		/// 
+		///	\param target		The render target to draw on
+		///	\param statistics	The timings of the recent frames
+		///	\param renderStats	The counters of the previous frame
+		///	\param fps			The frames per second
+		/// 
+		////////////////////////////////////////////////////////////
+		void Draw(RenderTarget& target, const FrameStatistics& statistics, const RenderStats& renderStats, u32 fps);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Set where to draw the top left corner of the
+		///		   panel, ignoring the transformation.
+		/// 
+		////////////////////////////////////////////////////////////
+		void SetPosition(float x, float y);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Set how often the content of the panel is
+		///		   updated.
+		/// 
+		////////////////////////////////////////////////////////////
+		void SetRefreshInterval(const Time& interval);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Get how often the content of the panel is
+		///		   updated.
+		/// 
+		////////////////////////////////////////////////////////////
+		const Time& GetRefreshInterval() const;
+
+	private:
+
+		////////////////////////////////////////////////////////////
+		/// \brief Use PImpl-pattern so we don't need to include
+		///		   the Direct2D headers.
+		/// 
+		////////////////////////////////////////////////////////////
+		class Impl;
+
+		////////////////////////////////////////////////////////////
+		/// Member data
+		/// 
+		////////////////////////////////////////////////////////////
+		std::unique_ptr<Impl>	impl;				///< Pointer to implementation class
+		float					positionX;			///< The left edge of the panel
+		float					positionY;			///< The top edge of the panel
+		Time					refreshInterval;	///< The time between two updates of the layer
+		Stopwatch				sinceRefresh;		///< Measures the time since the last update
+
+	};
+}
\ No newline at end of file
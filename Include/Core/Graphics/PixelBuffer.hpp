@@ -0,0 +1,215 @@
+﻿// 
+// PixelBuffer.hpp
+// Core
+// 
+// Created by Felix Busch on 19.10.2026.
+// Copyright © 2026 Felix Busch. All rights reserved.
+// 
+
+#pragma once
+
+#include <Core/Graphics/Color.hpp>
+
+#include <Core/System/Types.hpp>
+#include <Core/System/Rectangle.hpp>
+
+#include <vector>
+
+namespace Core
+{
+	////////////////////////////////////////////////////////////
+	/// \brief Define a CPU-side pixel buffer.
+	/// 
+	///	The pixels are stored as contiguous 32-bit values in
+	///	premultiplied BGRA order (0xAARRGGBB on little endian
+	///	machines), which is exactly the memory layout Direct2D
+	///	uses for its bitmaps.
+	/// 
+	///	Every write through SetPixel() or MarkDirty() is tracked
+	///	per row so only the modified rows have to be uploaded
+	///	back to the GPU.
+	/// 
+	////////////////////////////////////////////////////////////
+	class PixelBuffer
+	{
+	public:
+
+		////////////////////////////////////////////////////////////
+		/// \brief Define a rectangular area of modified pixels.
+		/// 
+		///	The rows [Top, Bottom) have been touched and the columns
+		///	[Left, Right) contain all modifications.
+		/// 
+		////////////////////////////////////////////////////////////
+		struct DirtySpan
+		{
+			u32 Left;
+			u32 Top;
+			u32 Right;
+			u32 Bottom;
+		};
+
+		////////////////////////////////////////////////////////////
+		/// \brief Pack a color into a premultiplied BGRA pixel.
+		/// 
+		////////////////////////////////////////////////////////////
+		static constexpr u32 Pack(const Color& color)
+		{
+			const u32 a = color.A;
+			const u32 r = (color.R * a + 127) / 255;
+			const u32 g = (color.G * a + 127) / 255;
+			const u32 b = (color.B * a + 127) / 255;
+			return (a << 24) | (r << 16) | (g << 8) | b;
+		}
+
+		////////////////////////////////////////////////////////////
+		/// \brief Unpack a premultiplied BGRA pixel into a color.
+		/// 
+		////////////////////////////////////////////////////////////
+		static constexpr Color Unpack(u32 pixel)
+		{
+			const u32 a = (pixel >> 24) & 0xFF;
+			if(a == 0)
+			{
+				return { 0, 0, 0, 0 };
+			}
+
+			const u32 r = (((pixel >> 16) & 0xFF) * 255 + a / 2) / a;
+			const u32 g = (((pixel >> 8) & 0xFF) * 255 + a / 2) / a;
+			const u32 b = ((pixel & 0xFF) * 255 + a / 2) / a;
+			return { (u8)r, (u8)g, (u8)b, (u8)a };
+		}
+
+		////////////////////////////////////////////////////////////
+		/// \brief Default constructor.
+		/// 
+		////////////////////////////////////////////////////////////
+		PixelBuffer();
+
+		////////////////////////////////////////////////////////////
+		/// \brief Resize the buffer.
+		/// 
+		///	The content is cleared to transparent black and the
+		///	whole buffer is marked as clean.
+		/// 
+		///	\param width	The number of pixels per row
+		///	\param height	The number of rows
+		/// 
+		////////////////////////////////////////////////////////////
+		void Resize(u32 width, u32 height);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Release the memory held by the buffer.
+		/// 
+		////////////////////////////////////////////////////////////
+		void Release();
+
+		////////////////////////////////////////////////////////////
+		/// \brief Get the contiguous pixel memory.
+		/// 
+		///	Rows are tightly packed, so the pitch in bytes is
+		///	GetWidth() * sizeof(u32).
+		/// 
+		////////////////////////////////////////////////////////////
+		u32* GetPixels();
+		const u32* GetPixels() const;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Get the pointer to the first pixel in a row.
+		/// 
+		////////////////////////////////////////////////////////////
+		u32* GetRow(u32 y);
+		const u32* GetRow(u32 y) const;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Get the dimensions of the buffer.
+		/// 
+		////////////////////////////////////////////////////////////
+		u32 GetWidth() const;
+		u32 GetHeight() const;
+		u32 GetPitch() const;
+		bool IsEmpty() const;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Write a single pixel and mark its row as dirty.
+		/// 
+		///	Out of bounds coordinates are ignored.
+		/// 
+		////////////////////////////////////////////////////////////
+		void SetPixel(u32 x, u32 y, u32 pixel);
+		void SetPixel(u32 x, u32 y, const Color& color);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Read a single pixel.
+		/// 
+		///	Out of bounds coordinates return a transparent pixel.
+		/// 
+		////////////////////////////////////////////////////////////
+		u32 GetPixel(u32 x, u32 y) const;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Mark the whole buffer as modified.
+		/// 
+		////////////////////////////////////////////////////////////
+		void MarkDirty();
+
+		////////////////////////////////////////////////////////////
+		/// \brief Mark a region as modified.
+		/// 
+		///	The region is clipped against the buffer boundary.
+		/// 
+		////////////////////////////////////////////////////////////
+		void MarkDirty(const IntRect& region);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Tell whether any pixel has been modified since
+		///		   the last call to ClearDirty().
+		/// 
+		////////////////////////////////////////////////////////////
+		bool IsDirty() const;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Collect the modified regions.
+		/// 
+		///	Consecutive dirty rows are merged into a single span.
+		/// 
+		///	\param spans Receives the spans, it is cleared first.
+		/// 
+		////////////////////////////////////////////////////////////
+		void GetDirtySpans(std::vector<DirtySpan>& spans) const;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Forget about all modifications.
+		/// 
+		////////////////////////////////////////////////////////////
+		void ClearDirty();
+
+	private:
+
+		////////////////////////////////////////////////////////////
+		/// \brief Mark the rows [top, bottom) and the columns
+		///		   [left, right) as modified.
+		/// 
+		////////////////////////////////////////////////////////////
+		void MarkRows(u32 left, u32 top, u32 right, u32 bottom);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Check whether a single row has been modified.
+		/// 
+		////////////////////////////////////////////////////////////
+		bool IsRowDirty(u32 y) const;
+
+		////////////////////////////////////////////////////////////
+		/// Member data
+		/// 
+		////////////////////////////////////////////////////////////
+		std::vector<u32>	pixels;		///< The pixel data in premultiplied BGRA
+		std::vector<u64>	dirtyRows;	///< One bit per row that has been modified
+		u32					width;		///< The number of pixels per row
+		u32					height;		///< The number of rows
+		u32					dirtyLeft;	///< The leftmost modified column
+		u32					dirtyRight;	///< One past the rightmost modified column
+		bool				dirty;		///< Whether any row has been modified
+
+	};
+}
\ No newline at end of file
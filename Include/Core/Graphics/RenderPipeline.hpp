@@ -0,0 +1,162 @@
+﻿// 
+// RenderPipeline.hpp
+// Core
+// 
+// Created by Felix Busch on 19.10.2026.
+// Copyright © 2026 Felix Busch. All rights reserved.
+// 
+
+#pragma once
+
+#include <Core/Graphics/CommandList.hpp>
+
+#include <Core/System/Time.hpp>
+#include <Core/System/LatencyHistogram.hpp>
+
+#include <condition_variable>
+#include <mutex>
+#include <optional>
+#include <thread>
+
+namespace Core
+{
+	////////////////////////////////////////////////////////////
+	/// Forward declarations
+	/// 
+	////////////////////////////////////////////////////////////
+	class GraphicsContext;
+
+	////////////////////////////////////////////////////////////
+	/// \brief Overlap the recording of a frame with the
+	///		   submission of the previous one.
+	/// 
+	///	Between BeginFrame() and EndFrame() the draw commands of
+	///	the graphics context are recorded into one of two command
+	///	lists. EndFrame() hands the list over to a submission
+	///	thread that replays it between BeginDraw() and EndDraw()
+	///	while the next frame is recorded into the other list.
+	/// 
+	///	EndFrame() waits until the previous frame has been
+	///	submitted, so at most one frame is in flight and the
+	///	added latency is bounded to one frame.
+	/// 
+	///	Comparing GetSubmitTimes() with GetStallTimes() shows the
+	///	gain: a frame costs about max(record, submit) instead of
+	///	record + submit, the stall is the part of the submission
+	///	that could not be hidden.
+	/// 
+	////////////////////////////////////////////////////////////
+	class RenderPipeline
+	{
+	public:
+
+		////////////////////////////////////////////////////////////
+		/// \brief Create a stopped pipeline.
+		/// 
+		///	\param graphics The context to record and submit with,
+		///					must outlive the pipeline
+		/// 
+		////////////////////////////////////////////////////////////
+		explicit RenderPipeline(GraphicsContext& graphics);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Stop the submission thread.
+		/// 
+		////////////////////////////////////////////////////////////
+		~RenderPipeline();
+
+		////////////////////////////////////////////////////////////
+		/// \brief Launch the submission thread.
+		/// 
+		///	From here on the render target must only be drawn to
+		///	through BeginFrame()/EndFrame().
+		/// 
+		////////////////////////////////////////////////////////////
+		void Start();
+
+		////////////////////////////////////////////////////////////
+		/// \brief Submit the frame in flight and join the
+		///		   submission thread.
+		/// 
+		////////////////////////////////////////////////////////////
+		void Stop();
+
+		////////////////////////////////////////////////////////////
+		/// \brief Check whether the submission thread is running.
+		/// 
+		////////////////////////////////////////////////////////////
+		[[nodiscard]] bool IsRunning() const;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Start recording a frame.
+		/// 
+		////////////////////////////////////////////////////////////
+		void BeginFrame();
+
+		////////////////////////////////////////////////////////////
+		/// \brief Stop recording, wait for the previous frame to be
+		///		   submitted and hand this one over.
+		/// 
+		///	\return False if a submission failed to present
+		/// 
+		////////////////////////////////////////////////////////////
+		bool EndFrame();
+
+		////////////////////////////////////////////////////////////
+		/// \brief Get when the previous frame was presented.
+		/// 
+		///	Valid after EndFrame(), empty if the previous frame was
+		///	skipped because the window was occluded. Call from the
+		///	recording thread only, as the getters below.
+		/// 
+		////////////////////////////////////////////////////////////
+		[[nodiscard]] const std::optional<Time>& GetPresentTimestamp() const;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Get the time the submission thread spent per
+		///		   frame from BeginDraw() until EndDraw() returned.
+		/// 
+		////////////////////////////////////////////////////////////
+		[[nodiscard]] const LatencyHistogram& GetSubmitTimes() const;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Get the time the recording thread waited in
+		///		   EndFrame() for the previous submission.
+		/// 
+		////////////////////////////////////////////////////////////
+		[[nodiscard]] const LatencyHistogram& GetStallTimes() const;
+
+	private:
+
+		////////////////////////////////////////////////////////////
+		/// \brief Method that runs on the submission thread.
+		/// 
+		////////////////////////////////////////////////////////////
+		void SubmitThreadImpl();
+
+		////////////////////////////////////////////////////////////
+		/// \brief Block until the submission thread is idle.
+		/// 
+		////////////////////////////////////////////////////////////
+		void WaitForSubmission(std::unique_lock<std::mutex>& lock);
+
+		////////////////////////////////////////////////////////////
+		/// Member data
+		/// 
+		////////////////////////////////////////////////////////////
+		GraphicsContext&		graphics;			///< The context to record and submit with
+		CommandList				commandLists[2];	///< The list being recorded and the list being submitted
+		u32						recordIndex;		///< The index of the list being recorded
+		std::thread				thread;				///< The submission thread
+		std::mutex				mutex;				///< Guards the hand-over state below
+		std::condition_variable	condition;			///< Signals hand-overs and finished submissions
+		CommandList*			pending;			///< The list handed over and not yet submitted, or nullptr
+		bool					stopping;			///< Tells the submission thread to quit
+		bool					failed;				///< A submission failed to present
+		std::optional<Time>		presentTimestamp;	///< When the last submitted frame was presented
+		Time					submitTime;			///< The duration of the last submission
+		LatencyHistogram		submitTimes;		///< The duration of each submission (recording thread only)
+		LatencyHistogram		stallTimes;			///< The wait in EndFrame() (recording thread only)
+
+	};
+}
\ No newline at end of file
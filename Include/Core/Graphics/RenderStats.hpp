@@ -0,0 +1,49 @@
+﻿// 
+// RenderStats.hpp
+// Core
+// 
+// Created by Felix Busch on 19.10.2026.
+// Copyright © 2026 Felix Busch. All rights reserved.
+// 
+
+#pragma once
+
+#include <Core/System/Types.hpp>
+
+namespace Core
+{
+	////////////////////////////////////////////////////////////
+	/// \brief Define the work the renderer did in one frame.
+	/// 
+	///	The counters are collected by the RenderTarget and the
+	///	resources it uses on the render thread, and are reset at
+	///	the start of every frame. Draw calls are counted where
+	///	the sketch issues them, so a frame recorded for pipelined
+	///	rendering reports the same numbers as a direct one.
+	/// 
+	////////////////////////////////////////////////////////////
+	struct RenderStats
+	{
+		u32 Clears					= 0;	///< Background() calls
+		u32 Rectangles				= 0;	///< Fill and outline calls for rectangles
+		u32 Ellipses				= 0;	///< Fill and outline calls for ellipses
+		u32 Lines					= 0;	///< Line calls
+		u32 Geometries				= 0;	///< Fill and outline calls for shapes
+		u32 Bitmaps					= 0;	///< DrawBitmap calls, including tiles, tile map chunks and pixel updates
+		u32 TransformChanges		= 0;	///< SetTransform calls that changed the transformation
+		u32 BrushCreations			= 0;	///< Solid color brushes created
+		u32 StrokeStyleCreations	= 0;	///< Stroke styles created
+		u32 PathGeometryCreations	= 0;	///< Path geometries created, one per BeginShape() or Shape::Begin()
+		u32 CulledPrimitives		= 0;	///< Primitives skipped because nothing of them would be visible
+		u64 UploadedBytes			= 0;	///< Pixel bytes copied into bitmaps
+
+		////////////////////////////////////////////////////////////
+		/// \brief Get the number of draw calls of all kinds.
+		/// 
+		////////////////////////////////////////////////////////////
+		u32 GetDrawCallCount() const
+		{
+			return Clears + Rectangles + Ellipses + Lines + Geometries + Bitmaps;
+		}
+	};
+}
\ No newline at end of file
@@ -11,6 +11,10 @@
 #include <Core/Graphics/RenderStyle.hpp>
 #include <Core/Graphics/Shape.hpp>
 #include <Core/Graphics/Texture.hpp>
+#include <Core/Graphics/TiledTexture.hpp>
+#include <Core/Graphics/TileMap.hpp>
+#include <Core/Graphics/CommandList.hpp>
+#include <Core/Graphics/RenderStats.hpp>
 
 #include <Core/System/Rectangle.hpp>
 
@@ -21,6 +25,7 @@
 /// 
 ////////////////////////////////////////////////////////////
 struct ID2D1RenderTarget;
+struct ID2D1Bitmap;
 
 namespace Core
 {
@@ -167,6 +172,63 @@ namespace Core
 		void Image(const Texture& texture, float a, float b);
 		void Image(const Texture& texture, float a, float b, float c, float d);
 		void Image(const Texture& texture, float a, float b, float c, float d, const FloatRect& sourceRectangle);
+		void Image(TiledTexture& texture, float a, float b);
+		void Image(TiledTexture& texture, float a, float b, float c, float d);
+		void Image(TileMap& map, float a, float b);
+		void Image(TileMap& map, float a, float b, float c, float d);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Draw a Direct2D bitmap in the coordinates of the
+		///		   render target, ignoring the transformation.
+		///
+		///	Meant for overlays drawn on top of the sketch, works
+		///	while recording as well.
+		/// 
+		////////////////////////////////////////////////////////////
+		void ScreenImage(ID2D1Bitmap* bitmap, const FloatRect& destination, float opacity);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Make the pixels of the render target accessible.
+		///
+		///	Direct2D does not allow reading back the content of the
+		///	render target, so the buffer keeps whatever has been
+		///	written into it and is cleared whenever the size of the
+		///	render target changes.
+		///
+		///	\return Pointer to the pixels of the render target in
+		///			premultiplied BGRA order.
+		/// 
+		////////////////////////////////////////////////////////////
+		u32* LoadPixels();
+
+		////////////////////////////////////////////////////////////
+		/// \brief Upload the modified pixels and draw them over
+		///		   the whole render target.
+		///
+		///	\see Texture::UpdatePixels()
+		/// 
+		////////////////////////////////////////////////////////////
+		void UpdatePixels();
+		void UpdatePixels(i32 x, i32 y, i32 width, i32 height);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Get the CPU-side pixel buffer of the render target.
+		/// 
+		////////////////////////////////////////////////////////////
+		PixelBuffer& GetPixelBuffer();
+
+		////////////////////////////////////////////////////////////
+		/// \brief Apply a filter to the pixels of the render target.
+		///
+		///	Works on the buffer returned by LoadPixels() and draws
+		///	the result over the whole render target.
+		///
+		///	\see ImageFilter::Apply()
+		/// 
+		////////////////////////////////////////////////////////////
+		void Filter(ImageFilter::Type type);
+		void Filter(ImageFilter::Type type, float parameter);
+		void Filter(const float* kernel, u32 size);
 
 		////////////////////////////////////////////////////////////
 		/// \brief Render a shape object on screen.
@@ -197,6 +259,53 @@ namespace Core
 		/// 
 		////////////////////////////////////////////////////////////
 		const Shape& GetGeometry() const;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Record the draw commands into a command list
+		///		   instead of drawing them.
+		///
+		///	Drawing tiled textures and tile maps as well as the pixel
+		///	functions (LoadPixels(), UpdatePixels(), Filter()) need
+		///	the render target itself and are skipped while
+		///	recording.
+		///
+		///	\param commandList The list to record into, or nullptr
+		///					   to draw directly again.
+		/// 
+		////////////////////////////////////////////////////////////
+		void SetCommandList(CommandList* commandList);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Get the command list that is recorded into.
+		/// 
+		////////////////////////////////////////////////////////////
+		CommandList* GetCommandList() const;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Get the counters of the current frame so far.
+		/// 
+		///	Resources used by the render target count themselves
+		///	through the non-const overload.
+		/// 
+		////////////////////////////////////////////////////////////
+		const RenderStats& GetRenderStats() const;
+		RenderStats& GetRenderStats();
+
+		////////////////////////////////////////////////////////////
+		/// \brief Get the counters of the previous, complete frame.
+		/// 
+		////////////////////////////////////////////////////////////
+		const RenderStats& GetPreviousRenderStats() const;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Keep the counters of the finished frame and start
+		///		   counting the next one.
+		/// 
+		///	Called by the application at the start of every frame,
+		///	on the render thread.
+		/// 
+		////////////////////////////////////////////////////////////
+		void ResetRenderStats();
 		
 		////////////////////////////////////////////////////////////
 		/// \brief Abstract method to receive a Direct2D render
@@ -210,12 +319,73 @@ namespace Core
 
 	private:
 
+		////////////////////////////////////////////////////////////
+		/// \brief Compute where to draw an image based on the
+		///		   current image mode.
+		/// 
+		////////////////////////////////////////////////////////////
+		FloatRect GetImageRectangle(float a, float b, float c, float d) const;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Draw the pixel buffer over the whole render target.
+		/// 
+		////////////////////////////////////////////////////////////
+		void DrawPixels();
+
+		////////////////////////////////////////////////////////////
+		/// \brief Capture the brushes of the current style for a
+		///		   command list.
+		/// 
+		////////////////////////////////////////////////////////////
+		CommandList::Paint GetPaint() const;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Report once that a function can't be recorded
+		///		   into a command list.
+		/// 
+		////////////////////////////////////////////////////////////
+		void ReportNotRecordable(const char* function);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Count a draw call of a filled and/or outlined
+		///		   primitive.
+		/// 
+		///	\return False if the primitive has neither a fill nor an
+		///			outline and can be skipped
+		/// 
+		////////////////////////////////////////////////////////////
+		bool CountDraw(u32& counter, bool hasFill, bool hasStroke);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Remember the transformation that is about to be
+		///		   applied.
+		/// 
+		///	\return False if it is already set and the SetTransform
+		///			call can be skipped
+		/// 
+		////////////////////////////////////////////////////////////
+		bool ChangeTransform(const Matrix3x2& transform);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Apply the current transformation to the render
+		///		   target unless it is already set.
+		/// 
+		////////////////////////////////////////////////////////////
+		void ApplyTransform(ID2D1RenderTarget& target);
+
 		////////////////////////////////////////////////////////////
 		/// Member data
 		/// 
 		////////////////////////////////////////////////////////////
-		std::stack<RenderStyle> styles;		///< The rendering styles
-		Shape					geometry;	///< Geometry to build and render
+		std::stack<RenderStyle> styles;			///< The rendering styles
+		Shape					geometry;		///< Geometry to build and render
+		Texture					framebuffer;	///< Texture that holds the pixels written through LoadPixels()
+		CommandList*			commandList;	///< The list the draw commands are recorded into, or nullptr
+		bool					reported;		///< State whether ReportNotRecordable() has printed its error
+		RenderStats				stats;			///< The counters of the current frame
+		RenderStats				previousStats;	///< The counters of the previous frame
+		Matrix3x2				transform;		///< The transformation set last in this frame
+		bool					transformSet;	///< State whether transform is valid
 
 	};
 
@@ -8,6 +8,9 @@
 
 #pragma once
 
+#include <Core/Graphics/PixelBuffer.hpp>
+#include <Core/Graphics/ImageFilter.hpp>
+
 #include <Core/System/Types.hpp>
 #include <Core/System/Value2.hpp>
 
@@ -27,7 +30,9 @@ namespace Core
 	/// \brief Define texture class.
 	///
 	///	A texture does not hold the pixel information of itself
-	///	but can be rendered to the screen anyways.
+	///	but can be rendered to the screen anyways. Calling
+	///	LoadPixels() creates a CPU-side copy of the pixels that
+	///	can be modified and uploaded again using UpdatePixels().
 	/// 
 	////////////////////////////////////////////////////////////
 	class Texture
@@ -56,6 +61,15 @@ namespace Core
 		////////////////////////////////////////////////////////////
 		bool LoadFromFile(const std::filesystem::path& filepath);
 
+		////////////////////////////////////////////////////////////
+		/// \brief Create an empty, fully transparent texture.
+		/// 
+		///	\param width	The width of the texture in pixels
+		///	\param height	The height of the texture in pixels
+		/// 
+		////////////////////////////////////////////////////////////
+		bool Create(u32 width, u32 height);
+
 		////////////////////////////////////////////////////////////
 		/// \brief Copy a part of the texture into a new resource.
 		///
@@ -66,6 +80,86 @@ namespace Core
 		/// 
 		////////////////////////////////////////////////////////////
 		Texture Get(i32 x, i32 y, i32 width, i32 height) const;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Create a resampled copy of the texture.
+		///
+		///	Unlike the sample mode used for drawing, the resampling
+		///	is done once on the CPU, which makes it suitable for
+		///	thumbnails or upscaled pixel art.
+		///
+		///	\param width	The width of the new texture in pixels
+		///	\param height	The height of the new texture in pixels
+		///	\param filter	The resampling filter to use
+		/// 
+		////////////////////////////////////////////////////////////
+		Texture Resized(u32 width, u32 height, ImageFilter::ResampleFilter filter) const;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Make the pixels of the texture accessible.
+		/// 
+		///	The first call copies the pixels into a CPU-side buffer,
+		///	subsequent calls return the same buffer. The pixels are
+		///	stored row by row in premultiplied BGRA order. Textures
+		///	loaded from a file don't keep the file open, their
+		///	pixels are decoded from the file again.
+		/// 
+		///	\return Pointer to GetSize().X * GetSize().Y pixels or
+		///			nullptr if the texture has not been created or
+		///			its pixels could not be read.
+		/// 
+		////////////////////////////////////////////////////////////
+		u32* LoadPixels();
+
+		////////////////////////////////////////////////////////////
+		/// \brief Upload the modified pixels back to the bitmap.
+		/// 
+		///	Only the rows marked through the pixel buffer (see
+		///	PixelBuffer::SetPixel() and PixelBuffer::MarkDirty())
+		///	are uploaded. If nothing has been marked, the whole
+		///	buffer is uploaded since raw writes through the pointer
+		///	returned by LoadPixels() cannot be tracked.
+		/// 
+		////////////////////////////////////////////////////////////
+		void UpdatePixels();
+
+		////////////////////////////////////////////////////////////
+		/// \brief Upload a region of the pixels back to the bitmap.
+		/// 
+		///	\param x		The x-coordinate of the modified region
+		///	\param y		The y-coordinate of the modified region
+		///	\param width	The width of the modified region
+		///	\param height	The height of the modified region
+		/// 
+		////////////////////////////////////////////////////////////
+		void UpdatePixels(i32 x, i32 y, i32 width, i32 height);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Apply a filter to the pixels and upload them.
+		///
+		///	\see ImageFilter::Apply()
+		/// 
+		////////////////////////////////////////////////////////////
+		void Filter(ImageFilter::Type type);
+		void Filter(ImageFilter::Type type, float parameter);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Convolve the pixels with a square kernel and
+		///		   upload them.
+		///
+		///	\see ImageFilter::Convolve()
+		/// 
+		////////////////////////////////////////////////////////////
+		void Filter(const float* kernel, u32 size);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Get the CPU-side pixel buffer.
+		/// 
+		///	The buffer is empty until LoadPixels() has been called.
+		/// 
+		////////////////////////////////////////////////////////////
+		PixelBuffer& GetPixelBuffer();
+		const PixelBuffer& GetPixelBuffer() const;
 		
 		////////////////////////////////////////////////////////////
 		/// \brief Get the underlying bitmap handle from Direct2D
@@ -0,0 +1,184 @@
+﻿// 
+// TileMap.hpp
+// Core
+// 
+// Created by Felix Busch on 19.10.2026.
+// Copyright © 2026 Felix Busch. All rights reserved.
+// 
+
+#pragma once
+
+#include <Core/Graphics/Texture.hpp>
+#include <Core/Graphics/RenderStats.hpp>
+
+#include <Core/System/Types.hpp>
+#include <Core/System/Value2.hpp>
+#include <Core/System/Rectangle.hpp>
+#include <Core/System/Time.hpp>
+
+#include <memory>
+
+////////////////////////////////////////////////////////////
+/// Forward declaration
+/// 
+////////////////////////////////////////////////////////////
+struct ID2D1RenderTarget;
+
+namespace Core
+{
+
+	////////////////////////////////////////////////////////////
+	/// \brief Define a grid of tiles taken from a tileset.
+	/// 
+	///	The tiles are grouped into chunks of ChunkSize x ChunkSize
+	///	tiles. Every chunk is rendered once into a cached layer and
+	///	only rendered again after one of its tiles changed, so
+	///	drawing the map costs one bitmap per visible chunk.
+	/// 
+	///	When the map is drawn scaled down, chunks are combined
+	///	into coarser layers (each one built from four layers of
+	///	the level below), which keeps the number of visible layers
+	///	bounded regardless of the size of the map. A coarse layer
+	///	is rendered one quadrant at a time and the layer below is
+	///	released right after it has been copied, so the layers
+	///	stay within the byte budget even for maps with millions
+	///	of tiles.
+	/// 
+	///	\see LayerPyramid
+	/// 
+	////////////////////////////////////////////////////////////
+	class TileMap
+	{
+	public:
+
+		////////////////////////////////////////////////////////////
+		/// The number of tiles per chunk in each direction
+		/// 
+		////////////////////////////////////////////////////////////
+		static constexpr u32 ChunkSize = 32;
+
+		////////////////////////////////////////////////////////////
+		/// The index of a tile that is not drawn
+		/// 
+		////////////////////////////////////////////////////////////
+		static constexpr u16 Empty = 0xFFFF;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Default constructor.
+		/// 
+		////////////////////////////////////////////////////////////
+		TileMap();
+
+		////////////////////////////////////////////////////////////
+		/// \brief Destructor.
+		/// 
+		////////////////////////////////////////////////////////////
+		~TileMap();
+
+		TileMap(const TileMap&) = delete;
+		TileMap& operator = (const TileMap&) = delete;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Create an empty map.
+		/// 
+		///	The tiles of the tileset are numbered row by row,
+		///	starting at 0 in the top left corner.
+		/// 
+		///	\param columns		The number of tiles per row
+		///	\param rows			The number of rows
+		///	\param tileset		The texture containing all tiles
+		///	\param tileWidth	The width of a tile in pixels
+		///	\param tileHeight	The height of a tile in pixels
+		///	\param byteBudget	The maximum number of bytes used by
+		///						cached layers
+		/// 
+		////////////////////////////////////////////////////////////
+		bool Create(u32 columns, u32 rows, const Texture& tileset, u32 tileWidth, u32 tileHeight, usize byteBudget = 256ull * 1024 * 1024);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Change a single tile.
+		/// 
+		///	Only the layers containing the tile are rendered again.
+		/// 
+		////////////////////////////////////////////////////////////
+		void SetTile(u32 column, u32 row, u16 tile);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Get the index of a tile.
+		/// 
+		///	Out of bounds coordinates return Empty.
+		/// 
+		////////////////////////////////////////////////////////////
+		u16 GetTile(u32 column, u32 row) const;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Set all tiles to the same index.
+		/// 
+		////////////////////////////////////////////////////////////
+		void Fill(u16 tile);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Draw the visible part of the map.
+		/// 
+		///	Layers that are outdated are rendered within a time
+		///	budget per call. Until then, the closest coarser layer
+		///	is drawn in their place. The transformation of the
+		///	render target must already be set.
+		/// 
+		///	\param target				The render target to draw to
+		///	\param destinationRectangle	Where to draw the whole map
+		///	\param opacity				The opacity in [0, 1]
+		///	\param sampleMode			The interpolation mode
+		///	\param stats				The counters to add the draw calls,
+		///								uploads and culled tiles to, may be
+		///								nullptr
+		/// 
+		////////////////////////////////////////////////////////////
+		void Draw(ID2D1RenderTarget& target, const FloatRect& destinationRectangle, float opacity, Texture::SampleMode sampleMode, RenderStats* stats = nullptr);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Set the time spent on rendering layers per call
+		///		   to Draw().
+		/// 
+		///	At least one layer is rendered per call.
+		/// 
+		////////////////////////////////////////////////////////////
+		void SetBuildBudget(const Time& budget);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Get the number of bytes used by cached layers.
+		/// 
+		////////////////////////////////////////////////////////////
+		usize GetUsedBytes() const;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Get the number of tiles in each direction.
+		/// 
+		////////////////////////////////////////////////////////////
+		u32 GetColumns() const;
+		u32 GetRows() const;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Get the size of the whole map in pixels.
+		/// 
+		////////////////////////////////////////////////////////////
+		const Float2& GetSize() const;
+
+	private:
+
+		////////////////////////////////////////////////////////////
+		/// \brief Forward declaration of the implementation.
+		/// 
+		////////////////////////////////////////////////////////////
+		class Impl;
+
+		////////////////////////////////////////////////////////////
+		/// Member data
+		/// 
+		////////////////////////////////////////////////////////////
+		std::unique_ptr<Impl>	impl;	///< The tiles and cached layers
+		Float2					size;	///< The size of the map in pixels
+
+	};
+
+}
\ No newline at end of file
@@ -0,0 +1,156 @@
+﻿// 
+// TiledTexture.hpp
+// Core
+// 
+// Created by Felix Busch on 19.10.2026.
+// Copyright © 2026 Felix Busch. All rights reserved.
+// 
+
+#pragma once
+
+#include <Core/Graphics/Texture.hpp>
+#include <Core/Graphics/RenderStats.hpp>
+
+#include <Core/System/Types.hpp>
+#include <Core/System/Value2.hpp>
+#include <Core/System/Rectangle.hpp>
+
+#include <memory>
+#include <filesystem>
+
+////////////////////////////////////////////////////////////
+/// Forward declaration
+/// 
+////////////////////////////////////////////////////////////
+struct ID2D1RenderTarget;
+
+namespace Core
+{
+
+	////////////////////////////////////////////////////////////
+	/// \brief Define a texture for images that are too large
+	///		   to be held by a single bitmap.
+	/// 
+	///	The image is split into square tiles that are decoded by
+	///	jobs (see Jobs) only when they become visible. When
+	///	the image is drawn smaller than its native size, tiles of
+	///	a downscaled level are used so the number of tiles stays
+	///	proportional to the size of the render target.
+	/// 
+	///	Tiles are evicted in least recently used order to keep the
+	///	memory below the byte budget. Missing tiles are replaced
+	///	by a coarser level until they have been streamed in.
+	/// 
+	////////////////////////////////////////////////////////////
+	class TiledTexture
+	{
+	public:
+
+		////////////////////////////////////////////////////////////
+		/// \brief Default constructor.
+		/// 
+		////////////////////////////////////////////////////////////
+		TiledTexture();
+
+		////////////////////////////////////////////////////////////
+		/// \brief Destructor, waits for the decode jobs.
+		/// 
+		////////////////////////////////////////////////////////////
+		~TiledTexture();
+
+		TiledTexture(const TiledTexture&) = delete;
+		TiledTexture& operator = (const TiledTexture&) = delete;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Open an image file for streaming.
+		/// 
+		///	Only the header of the image is read, the pixels are
+		///	decoded on demand.
+		/// 
+		///	\param filepath		The image to stream from
+		///	\param tileSize		The width and height of a tile in pixels
+		///	\param byteBudget	The maximum number of bytes used by tiles
+		/// 
+		////////////////////////////////////////////////////////////
+		bool Open(const std::filesystem::path& filepath, u32 tileSize = 512, usize byteBudget = 256ull * 1024 * 1024);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Stop streaming and release all tiles.
+		/// 
+		////////////////////////////////////////////////////////////
+		void Close();
+
+		////////////////////////////////////////////////////////////
+		/// \brief Draw the visible part of the image.
+		/// 
+		///	Uploads a limited number of decoded tiles, draws the
+		///	resident tiles intersecting the render target and
+		///	requests the missing ones. The transformation of the
+		///	render target must already be set.
+		/// 
+		///	\param target				The render target to draw to
+		///	\param destinationRectangle	Where to draw the whole image
+		///	\param opacity				The opacity in [0, 1]
+		///	\param sampleMode			The interpolation mode
+		///	\param stats				The counters to add the draw calls,
+		///								uploads and culled tiles to, may be
+		///								nullptr
+		/// 
+		////////////////////////////////////////////////////////////
+		void Draw(ID2D1RenderTarget& target, const FloatRect& destinationRectangle, float opacity, Texture::SampleMode sampleMode, RenderStats* stats = nullptr);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Set the maximum number of bytes used by tiles.
+		/// 
+		////////////////////////////////////////////////////////////
+		void SetByteBudget(usize byteBudget);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Get the maximum number of bytes used by tiles.
+		/// 
+		////////////////////////////////////////////////////////////
+		usize GetByteBudget() const;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Get the number of bytes currently used by
+		///		   uploaded and decoded tiles.
+		/// 
+		////////////////////////////////////////////////////////////
+		usize GetUsedBytes() const;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Get the width and height of a tile in pixels.
+		/// 
+		////////////////////////////////////////////////////////////
+		u32 GetTileSize() const;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Get the size of the whole image in pixels.
+		/// 
+		////////////////////////////////////////////////////////////
+		const Float2& GetSize() const;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Tell whether an image has been opened.
+		/// 
+		////////////////////////////////////////////////////////////
+		bool IsOpen() const;
+
+	private:
+
+		////////////////////////////////////////////////////////////
+		/// \brief Forward declaration of the implementation.
+		/// 
+		////////////////////////////////////////////////////////////
+		class Impl;
+
+		////////////////////////////////////////////////////////////
+		/// Member data
+		/// 
+		////////////////////////////////////////////////////////////
+		std::unique_ptr<Impl>	impl;	///< The streaming state
+		Float2					size;	///< The size of the image
+
+	};
+
+}
\ No newline at end of file
@@ -9,11 +9,15 @@
 #pragma once
 
 #include <Core/Application/Globals.hpp>
+#include <Core/Application/Input.hpp>
 
 #include <Core/System/Types.hpp>
+#include <Core/System/LatencyHistogram.hpp>
+#include <Core/System/FrameStatistics.hpp>
 #include <Core/System/Value2.hpp>
 #include <Core/System/String.hpp>
 #include <Core/System/Rectangle.hpp>
+#include <Core/System/Jobs.hpp>
 
 #include <Core/Window/MouseCursor.hpp>
 #include <Core/Window/WindowIcon.hpp>
@@ -22,8 +26,12 @@
 #include <Core/Graphics/Color.hpp>
 #include <Core/Graphics/ShapeProperties.hpp>
 #include <Core/Graphics/Texture.hpp>
+#include <Core/Graphics/TiledTexture.hpp>
+#include <Core/Graphics/TileMap.hpp>
 #include <Core/Graphics/Shape.hpp>
 
+#include <filesystem>
+
 #include "Graphics/Shape.hpp"
 
 namespace Core
@@ -43,8 +51,44 @@ namespace Core
 	void SetAutoCloseEnabled(bool enabled);
 	bool IsAutoCloseEnabled();
 	void Exit();
+	void Loop();
+	void NoLoop();
+	bool IsLooping();
+	void Redraw();
 	void SetFrameRateLimit(u32 limit);
+	void SetPipelinedRendering(bool enabled);
+	bool IsPipelinedRendering();
+
+	////////////////////////////////////////////////////////////
+	/// \brief Restart the job workers with the given number of
+	///		   threads, 0 picks one less than there are hardware
+	///		   threads.
+	/// 
+	///	Can be called from any thread, including jobs. The
+	///	workers belong to the main thread, which restarts them
+	///	the next time it wakes up, after the jobs in flight have
+	///	finished. Until then GetJobWorkerCount() returns the old
+	///	number.
+	/// 
+	////////////////////////////////////////////////////////////
+	void SetJobWorkerCount(u32 count);
+	u32 GetJobWorkerCount();
+	void SetPerformanceOverlay(bool enabled);
+	bool IsPerformanceOverlay();
+	void SetGenericEventsEnabled(bool enabled);
+	bool IsGenericEventsEnabled();
+	void SetTickRate(u32 ticksPerSecond);
+	u32 GetTickRate();
+	float GetInterpolationAlpha();
 	u32 GetFramesPerSecond();
+	const LatencyHistogram& GetInputLatency();
+	const LatencyHistogram& GetPresentLatency();
+	const LatencyHistogram& GetPacingError();
+	const FrameStatistics& GetFrameStatistics();
+	bool StartRecording(const std::filesystem::path& filepath);
+	void StopRecording();
+	bool StartProfiling(const std::filesystem::path& filepath);
+	void StopProfiling();
 	Application& GetApp();
 
 	////////////////////////////////////////////////////////////
@@ -81,6 +125,20 @@ namespace Core
 	const WindowIcon& GetWindowIcon();
 	Window& GetWindow();
 
+	////////////////////////////////////////////////////////////
+	/// Input functions
+	/// 
+	////////////////////////////////////////////////////////////
+	bool IsKeyDown(KeyCode key);
+	bool IsKeyPressed(KeyCode key);
+	bool IsKeyReleased(KeyCode key);
+	bool IsMouseButtonDown(MouseButton button);
+	bool IsMouseButtonPressed(MouseButton button);
+	bool IsMouseButtonReleased(MouseButton button);
+	float GetMouseWheelDelta(MouseWheel wheel = MouseWheel::Vertical);
+	Int2 GetMouseDelta();
+	const Input& GetInput();
+
 	////////////////////////////////////////////////////////////
 	/// Rendering
 	/// 
@@ -121,6 +179,16 @@ namespace Core
 	void Image(const Texture& texture, float a, float b);
 	void Image(const Texture& texture, float a, float b, float c, float d);
 	void Image(const Texture& texture, float a, float b, float c, float d, const FloatRect& destinationRectangle);
+	void Image(TiledTexture& texture, float a, float b);
+	void Image(TiledTexture& texture, float a, float b, float c, float d);
+	void Image(TileMap& map, float a, float b);
+	void Image(TileMap& map, float a, float b, float c, float d);
+	u32* LoadPixels();
+	void UpdatePixels();
+	void UpdatePixels(i32 x, i32 y, i32 width, i32 height);
+	void Filter(ImageFilter::Type type);
+	void Filter(ImageFilter::Type type, float parameter);
+	void Filter(const float* kernel, u32 size);
 	void ResetTransform();
 	void Translate(float x, float y);
 	void Rotate(const Angle& rotation);
@@ -18,7 +18,6 @@ namespace Core
 	/// Linking static members
 	/// 
 	////////////////////////////////////////////////////////////
-	inline constexpr Angle Angle::Zero;
 	inline constexpr float Angle::DegToRad = std::numbers::pi_v<float> / 180.0f;
 	inline constexpr float Angle::RadToDeg = 180.0f / std::numbers::pi_v<float>;
 
@@ -27,6 +26,13 @@ namespace Core
 		degrees(0.0f)
 	{}
 
+	////////////////////////////////////////////////////////////
+	/// The constructor has to be defined before Zero can be
+	/// initialized in a constant expression
+	/// 
+	////////////////////////////////////////////////////////////
+	inline constexpr Angle Angle::Zero;
+
 	////////////////////////////////////////////////////////////
 	constexpr float Angle::ToRadians() const
 	{
@@ -120,7 +126,7 @@ namespace Core
 	////////////////////////////////////////////////////////////
 	constexpr Angle operator%(const Angle& lhs, const Angle& rhs)
 	{
-		return Degrees(std::fmodf(lhs.ToDegrees(), rhs.ToDegrees()));
+		return Degrees(std::fmod(lhs.ToDegrees(), rhs.ToDegrees()));
 	}
 
 	////////////////////////////////////////////////////////////
@@ -0,0 +1,116 @@
+﻿// 
+// EventDelegate.hpp
+// Core
+// 
+// Created by Felix Busch on 19.10.2026.
+// Copyright © 2026 Felix Busch. All rights reserved.
+// 
+
+#pragma once
+
+#include <Core/System/Types.hpp>
+
+#include <cstring>
+#include <new>
+#include <type_traits>
+
+namespace Core
+{
+	////////////////////////////////////////////////////////////
+	/// \brief Type-erased event callback that is stored inline
+	/// 
+	///	Holds a small, trivially copyable function object (like a
+	///	lambda capturing a pointer or two) in place and calls it
+	///	through a single function pointer. Unlike std::function it
+	///	never allocates, and unlike IEventListener the callback
+	///	doesn't need a class deriving from an interface.
+	/// 
+	///	Two delegates compare equal if they store the same bytes
+	///	and call the same function, which is what
+	///	EventPublisher::RemoveEventDelegate() relies on.
+	/// 
+	////////////////////////////////////////////////////////////
+	template<typename TEvent>
+	class EventDelegate
+	{
+	public:
+
+		////////////////////////////////////////////////////////////
+		/// The number of bytes available for the function object
+		/// 
+		////////////////////////////////////////////////////////////
+		static constexpr usize StorageSize = 2 * sizeof(void*);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Wrap a function object
+		/// 
+		///	\param function A callable taking a const TEvent&
+		/// 
+		////////////////////////////////////////////////////////////
+		template<typename TFunction> requires
+			(!std::is_same_v<std::remove_cvref_t<TFunction>, EventDelegate>) &&
+			std::is_trivially_copyable_v<TFunction> &&
+			std::is_invocable_v<const TFunction&, const TEvent&>
+		EventDelegate(const TFunction& function):
+			storage{},
+			invoke(&Invoke<TFunction>)
+		{
+			static_assert(sizeof(TFunction) <= StorageSize, "The function object is too large for an EventDelegate");
+			static_assert(alignof(TFunction) <= alignof(void*), "The function object is over-aligned for an EventDelegate");
+
+			new(storage) TFunction(function);
+		}
+
+		////////////////////////////////////////////////////////////
+		/// \brief Create a delegate that calls a member function
+		/// 
+		///	\code
+		///	auto delegate = EventDelegate<WindowEvent>::Bind<&Player::OnEvent>(player);
+		///	\endcode
+		/// 
+		////////////////////////////////////////////////////////////
+		template<auto Method, typename T>
+		static EventDelegate Bind(T& object)
+		{
+			return EventDelegate([instance = &object](const TEvent& event) { (instance->*Method)(event); });
+		}
+
+		////////////////////////////////////////////////////////////
+		/// \brief Call the function object
+		/// 
+		////////////////////////////////////////////////////////////
+		void operator () (const TEvent& event) const
+		{
+			invoke(storage, event);
+		}
+
+		////////////////////////////////////////////////////////////
+		/// \brief Compare two delegates
+		/// 
+		////////////////////////////////////////////////////////////
+		friend bool operator == (const EventDelegate& lhs, const EventDelegate& rhs)
+		{
+			return lhs.invoke == rhs.invoke && std::memcmp(lhs.storage, rhs.storage, StorageSize) == 0;
+		}
+
+	private:
+
+		////////////////////////////////////////////////////////////
+		/// \brief Call the function object stored as TFunction
+		/// 
+		////////////////////////////////////////////////////////////
+		template<typename TFunction>
+		static void Invoke(const void* storage, const TEvent& event)
+		{
+			(*static_cast<const TFunction*>(storage))(event);
+		}
+
+		////////////////////////////////////////////////////////////
+		/// Member data
+		/// 
+		////////////////////////////////////////////////////////////
+		alignas(void*) unsigned char	storage[StorageSize];						///< The function object, zero-padded
+		void							(*invoke)(const void*, const TEvent&);	///< Calls the function object
+
+	};
+}
\ No newline at end of file
@@ -9,20 +9,76 @@
 #pragma once
 
 #include <Core/System/IEventListener.hpp>
+#include <Core/System/EventDelegate.hpp>
 #include <Core/System/PollEventSystem.hpp>
+#include <Core/System/Profiler.hpp>
+#include <Core/System/Types.hpp>
 
+#include <algorithm>
+#include <array>
 #include <vector>
 
 namespace Core
 {
+	////////////////////////////////////////////////////////////
+	/// \brief Bitmask of event types a listener subscribes to
+	/// 
+	////////////////////////////////////////////////////////////
+	using EventMask = u64;
+
+	////////////////////////////////////////////////////////////
+	/// \brief Event types without a \a Type member are treated
+	///		   as a single type
+	/// 
+	////////////////////////////////////////////////////////////
+	template<typename TEvent>
+	struct EventTypeTraits
+	{
+		static constexpr u32 TypeCount = 1;
+		static u32 GetType(const TEvent&) { return 0; }
+	};
+
+	////////////////////////////////////////////////////////////
+	/// \brief Event types that provide a \a Type member and a
+	///		   static \a TypeCount
+	/// 
+	////////////////////////////////////////////////////////////
+	template<typename TEvent> requires requires(const TEvent& event) { TEvent::TypeCount; event.Type; }
+	struct EventTypeTraits<TEvent>
+	{
+		static constexpr u32 TypeCount = (u32)TEvent::TypeCount;
+		static u32 GetType(const TEvent& event) { return (u32)event.Type; }
+	};
+
 	////////////////////////////////////////////////////////////
 	/// \brief Generic event publisher
 	/// 
+	///	Events that provide a \a Type member and a static
+	///	\a TypeCount are routed to the listeners that subscribed
+	///	to their type only. Any other event type is treated as a
+	///	single type and reaches every listener.
+	/// 
 	////////////////////////////////////////////////////////////
 	template<typename TEvent>
 	class EventPublisher : PollEventSystem<TEvent>
 	{
 	public:
+
+		////////////////////////////////////////////////////////////
+		/// \brief Mask that subscribes to every event type
+		/// 
+		////////////////////////////////////////////////////////////
+		static constexpr EventMask AllEvents = ~EventMask(0);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Get the mask that subscribes to a single type
+		/// 
+		////////////////////////////////////////////////////////////
+		static constexpr EventMask MaskOf(u32 type)
+		{
+			return EventMask(1) << type;
+		}
+
 		////////////////////////////////////////////////////////////
 		/// \brief Default destructor
 		/// 
@@ -32,12 +88,21 @@ namespace Core
 		////////////////////////////////////////////////////////////
 		/// \brief Add an event listener to the subscribers
 		///
-		///	\param listener The event listener to add
+		///	\param listener	The event listener to add
+		///	\param mask		The event types the listener is notified about
 		/// 
 		////////////////////////////////////////////////////////////
-		void AddEventListener(IEventListener<TEvent>& listener)
+		void AddEventListener(IEventListener<TEvent>& listener, EventMask mask = AllEvents)
 		{
 			subscribers.push_back(&listener);
+
+			for(u32 type = 0; type < TypeCount; ++type)
+			{
+				if(mask & MaskOf(type))
+				{
+					listenersByType[type].push_back(&listener);
+				}
+			}
 		}
 
 		////////////////////////////////////////////////////////////
@@ -52,16 +117,82 @@ namespace Core
 			if(const auto itr = std::ranges::find(subscribers, &listener); itr != subscribers.end())
 			{
 				subscribers.erase(itr);
+
+				for(std::vector<IEventListener<TEvent>*>& listeners : listenersByType)
+				{
+					if(const auto typeItr = std::ranges::find(listeners, &listener); typeItr != listeners.end())
+					{
+						listeners.erase(typeItr);
+					}
+				}
 			}
 		}
 
 		////////////////////////////////////////////////////////////
-		/// \brief Remove all event listeners from the list
+		/// \brief Add a callback that is notified without a virtual
+		///		   call
+		///
+		///	Delegates are notified after the event listeners.
+		///
+		///	\param delegate	The callback to add
+		///	\param mask		The event types the callback is notified about
+		/// 
+		////////////////////////////////////////////////////////////
+		void AddEventDelegate(const EventDelegate<TEvent>& delegate, EventMask mask = AllEvents)
+		{
+			for(u32 type = 0; type < TypeCount; ++type)
+			{
+				if(mask & MaskOf(type))
+				{
+					delegatesByType[type].push_back(delegate);
+				}
+			}
+		}
+
+		////////////////////////////////////////////////////////////
+		/// \brief Remove a callback from every event type
+		/// 
+		////////////////////////////////////////////////////////////
+		void RemoveEventDelegate(const EventDelegate<TEvent>& delegate)
+		{
+			for(std::vector<EventDelegate<TEvent>>& delegates : delegatesByType)
+			{
+				if(const auto itr = std::ranges::find(delegates, delegate); itr != delegates.end())
+				{
+					delegates.erase(itr);
+				}
+			}
+		}
+
+		////////////////////////////////////////////////////////////
+		/// \brief Remove all event listeners and delegates
 		/// 
 		////////////////////////////////////////////////////////////
 		void RemoveAllEventListeners()
 		{
 			subscribers.clear();
+
+			for(std::vector<IEventListener<TEvent>*>& listeners : listenersByType)
+			{
+				listeners.clear();
+			}
+
+			for(std::vector<EventDelegate<TEvent>>& delegates : delegatesByType)
+			{
+				delegates.clear();
+			}
+		}
+
+		////////////////////////////////////////////////////////////
+		/// \brief Check whether any listener subscribed to a type
+		///
+		///	Sources can use this to skip producing events nobody
+		///	is interested in.
+		/// 
+		////////////////////////////////////////////////////////////
+		[[nodiscard]] bool HasEventListeners(u32 type) const
+		{
+			return type < TypeCount && (!listenersByType[type].empty() || !delegatesByType[type].empty());
 		}
 
 		////////////////////////////////////////////////////////////
@@ -70,33 +201,82 @@ namespace Core
 		////////////////////////////////////////////////////////////
 		using PollEventSystem<TEvent>::PushEvent;
 
+		////////////////////////////////////////////////////////////
+		/// \brief Adopt the blocking wait and its wake-up signal
+		/// 
+		////////////////////////////////////////////////////////////
+		using PollEventSystem<TEvent>::WaitEvents;
+		using PollEventSystem<TEvent>::Wake;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Adopt the coalescing switch
+		/// 
+		////////////////////////////////////////////////////////////
+		using PollEventSystem<TEvent>::SetCoalescingEnabled;
+		using PollEventSystem<TEvent>::IsCoalescingEnabled;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Adopt the overflow handling
+		/// 
+		////////////////////////////////////////////////////////////
+		using PollEventSystem<TEvent>::SetOverflowPolicy;
+		using PollEventSystem<TEvent>::GetOverflowPolicy;
+		using PollEventSystem<TEvent>::GetDroppedEventCount;
+
 		////////////////////////////////////////////////////////////
 		/// \brief Notify all subscribers
 		/// 
 		////////////////////////////////////////////////////////////
 		void DispatchEvents()
 		{
+			CORE_PROFILE_SCOPE("EventPublisher::DispatchEvents");
+
 			// declare event buffer
 			TEvent event = {};
 
 			// dispatch every queued event
 			while (this->PollEvents(event))
 			{
-				// notify each subscriber
-				for(IEventListener<TEvent>* subscriber : subscribers)
+				const u32 type = GetTypeIndex(event);
+
+				// notify each subscriber of this type
+				for(IEventListener<TEvent>* subscriber : listenersByType[type])
 				{
 					subscriber->OnEvent(event);
 				}
+
+				for(const EventDelegate<TEvent>& delegate : delegatesByType[type])
+				{
+					delegate(event);
+				}
 			}
 		}
 
 	private:
 
+		////////////////////////////////////////////////////////////
+		/// \brief Get the index of the list to notify for an event
+		/// 
+		////////////////////////////////////////////////////////////
+		static u32 GetTypeIndex(const TEvent& event)
+		{
+			return EventTypeTraits<TEvent>::GetType(event);
+		}
+
+		////////////////////////////////////////////////////////////
+		/// The number of event types
+		/// 
+		////////////////////////////////////////////////////////////
+		static constexpr u32 TypeCount = EventTypeTraits<TEvent>::TypeCount;
+		static_assert(TypeCount <= sizeof(EventMask) * 8, "Too many event types for EventMask");
+
 		////////////////////////////////////////////////////////////
 		/// Member data
 		/// 
 		////////////////////////////////////////////////////////////
-		std::vector<IEventListener<TEvent>*> subscribers; //!< The subscriber to notify
+		std::vector<IEventListener<TEvent>*>								subscribers;		//!< The subscriber to notify
+		std::array<std::vector<IEventListener<TEvent>*>, TypeCount>		listenersByType;	//!< The subscribers of each event type
+		std::array<std::vector<EventDelegate<TEvent>>, TypeCount>		delegatesByType;	//!< The delegates of each event type
 
 	};
 
@@ -0,0 +1,128 @@
+﻿// 
+// FramePacer.hpp
+// Core
+// 
+// Created by Felix Busch on 19.10.2026.
+// Copyright © 2026 Felix Busch. All rights reserved.
+// 
+
+#pragma once
+
+#include <Core/System/Types.hpp>
+#include <Core/System/Time.hpp>
+#include <Core/System/LatencyHistogram.hpp>
+
+namespace Core
+{
+	////////////////////////////////////////////////////////////
+	/// \brief Limit a loop to a fixed rate by waiting for
+	///		   absolute deadlines
+	/// 
+	///	Every deadline is the previous one plus the interval, so
+	///	the time spent outside of Wait() and the inaccuracy of a
+	///	single wake-up don't add up over frames. Wait() sleeps
+	///	with the OS timer until shortly before the deadline and
+	///	spins for the rest:
+	///		- Windows: a high resolution waitable timer, or a
+	///		  regular one with a 1 ms timer period on older systems
+	///		- Other systems: clock_nanosleep() with TIMER_ABSTIME
+	/// 
+	///	If a frame misses its deadline by more than a whole
+	///	interval, the schedule restarts from the current time
+	///	instead of rushing through the missed frames.
+	/// 
+	///	This class is not thread-safe.
+	/// 
+	////////////////////////////////////////////////////////////
+	class FramePacer
+	{
+	public:
+
+		////////////////////////////////////////////////////////////
+		/// \brief Create the pacer and its OS timer
+		/// 
+		////////////////////////////////////////////////////////////
+		FramePacer();
+
+		////////////////////////////////////////////////////////////
+		/// \brief Release the OS timer
+		/// 
+		////////////////////////////////////////////////////////////
+		~FramePacer();
+
+		////////////////////////////////////////////////////////////
+		/// \brief Deleted copy operations, the pacer owns a timer
+		/// 
+		////////////////////////////////////////////////////////////
+		FramePacer(const FramePacer&) = delete;
+		FramePacer& operator = (const FramePacer&) = delete;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Change the time between two deadlines
+		/// 
+		///	The next deadline is moved accordingly.
+		/// 
+		////////////////////////////////////////////////////////////
+		void SetInterval(const Time& interval);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Get the time between two deadlines
+		/// 
+		////////////////////////////////////////////////////////////
+		[[nodiscard]] const Time& GetInterval() const;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Start a new schedule one interval from now
+		/// 
+		///	Call this after the loop was paused on purpose, so the
+		///	pause doesn't count as a missed deadline.
+		/// 
+		////////////////////////////////////////////////////////////
+		void Reset();
+
+		////////////////////////////////////////////////////////////
+		/// \brief Block until the next deadline and advance it by
+		///		   one interval
+		/// 
+		///	Returns immediately if the deadline has already passed.
+		/// 
+		////////////////////////////////////////////////////////////
+		void Wait();
+
+		////////////////////////////////////////////////////////////
+		/// \brief Get how late Wait() returned after its deadline
+		/// 
+		///	Only waits that actually slept are recorded.
+		/// 
+		////////////////////////////////////////////////////////////
+		[[nodiscard]] const LatencyHistogram& GetPacingError() const;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Get the number of deadlines that had already
+		///		   passed when Wait() was called
+		/// 
+		////////////////////////////////////////////////////////////
+		[[nodiscard]] u64 GetMissedDeadlineCount() const;
+
+	private:
+
+		////////////////////////////////////////////////////////////
+		/// \brief Let the OS put the thread to sleep until the
+		///		   given timestamp at most
+		/// 
+		////////////////////////////////////////////////////////////
+		void SleepUntil(const Time& timestamp);
+
+		////////////////////////////////////////////////////////////
+		/// Member data
+		/// 
+		////////////////////////////////////////////////////////////
+		void*				timer;				///< The waitable timer (Windows only)
+		Time				spinThreshold;		///< The time before the deadline that is spent spinning instead of sleeping
+		Time				interval;			///< The time between two deadlines
+		Time				deadline;			///< The timestamp the next Wait() returns at
+		LatencyHistogram	pacingError;		///< How late Wait() returned
+		u64					missedDeadlines;	///< The number of deadlines that were already over when Wait() was called
+
+	};
+}
\ No newline at end of file
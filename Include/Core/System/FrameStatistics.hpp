@@ -0,0 +1,164 @@
+﻿// 
+// FrameStatistics.hpp
+// Core
+// 
+// Created by Felix Busch on 19.10.2026.
+// Copyright © 2026 Felix Busch. All rights reserved.
+// 
+
+#pragma once
+
+#include <Core/System/Types.hpp>
+#include <Core/System/Time.hpp>
+#include <Core/System/RingBuffer.hpp>
+
+#include <vector>
+
+namespace Core
+{
+	////////////////////////////////////////////////////////////
+	/// \brief Keep the timings of the most recent frames
+	/// 
+	///	Recording a frame is a copy into a ring buffer, so the
+	///	statistics can stay enabled in release builds. Queries
+	///	sort the requested window and should be made a few times
+	///	per second at most, e.g. by a performance overlay.
+	/// 
+	///	This class is not thread-safe.
+	/// 
+	////////////////////////////////////////////////////////////
+	class FrameStatistics
+	{
+	public:
+
+		////////////////////////////////////////////////////////////
+		/// \brief The timings of a single frame
+		/// 
+		////////////////////////////////////////////////////////////
+		struct Sample
+		{
+			Time FrameTime;		///< The CPU time of the frame, without the sleep of the frame rate limit
+			Time DrawTime;		///< The time spent in Sketch::OnDraw(), Sketch::OnDrawGui() and the performance overlay
+			Time EndDrawTime;	///< The time spent in EndDraw(), or waiting for the submission in pipelined mode
+			Time SleepTime;		///< The time slept to keep the frame rate limited
+		};
+
+		////////////////////////////////////////////////////////////
+		/// \brief Select one of the timings of a sample
+		/// 
+		////////////////////////////////////////////////////////////
+		enum Metric
+		{
+			Frame,		///< Sample::FrameTime
+			Draw,		///< Sample::DrawTime
+			EndDraw,	///< Sample::EndDrawTime
+			Sleep		///< Sample::SleepTime
+		};
+
+		////////////////////////////////////////////////////////////
+		/// \brief The result of a query over a window of frames
+		/// 
+		////////////////////////////////////////////////////////////
+		struct Summary
+		{
+			Time	Min;				///< The shortest value
+			Time	Max;				///< The longest value
+			Time	Mean;				///< The average value
+			Time	P50;				///< The median
+			Time	P95;				///< 95% of the values are less or equal
+			Time	P99;				///< 99% of the values are less or equal
+			u32		FrameCount;			///< The number of frames the summary covers
+			u32		OverBudgetCount;	///< The number of values greater than the budget
+		};
+
+		////////////////////////////////////////////////////////////
+		/// \brief The number of frames kept by default
+		/// 
+		////////////////////////////////////////////////////////////
+		static constexpr usize DefaultCapacity = 1024;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Create the statistics
+		/// 
+		///	\param capacity The number of frames to keep, rounded up
+		///					to a power of two
+		/// 
+		////////////////////////////////////////////////////////////
+		explicit FrameStatistics(usize capacity = DefaultCapacity);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Add a frame, replacing the oldest one if full
+		/// 
+		////////////////////////////////////////////////////////////
+		void Record(const Sample& sample);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Remove all frames and reset the counters
+		/// 
+		////////////////////////////////////////////////////////////
+		void Clear();
+
+		////////////////////////////////////////////////////////////
+		/// \brief Set the frame time above which a frame is counted
+		///		   as over budget, zero disables the count
+		/// 
+		////////////////////////////////////////////////////////////
+		void SetBudget(const Time& budget);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Get the budget of a frame
+		/// 
+		////////////////////////////////////////////////////////////
+		[[nodiscard]] const Time& GetBudget() const;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Summarize one timing over the most recent frames
+		/// 
+		///	\param metric	The timing to summarize
+		///	\param window	The number of frames, clamped to the
+		///					number of recorded frames
+		/// 
+		////////////////////////////////////////////////////////////
+		[[nodiscard]] Summary GetSummary(Metric metric, usize window) const;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Get a recorded frame
+		/// 
+		///	\param age Zero for the most recent frame, must be less
+		///			   than GetSize()
+		/// 
+		////////////////////////////////////////////////////////////
+		[[nodiscard]] const Sample& GetSample(usize age) const;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Get the number of recorded frames
+		/// 
+		////////////////////////////////////////////////////////////
+		[[nodiscard]] usize GetSize() const;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Get the number of frames over budget since the
+		///		   last Clear(), including the ones no longer kept
+		/// 
+		////////////////////////////////////////////////////////////
+		[[nodiscard]] u64 GetOverBudgetCount() const;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Get one timing of a sample
+		/// 
+		////////////////////////////////////////////////////////////
+		static const Time& GetValue(const Sample& sample, Metric metric);
+
+	private:
+
+		////////////////////////////////////////////////////////////
+		/// Member data
+		/// 
+		////////////////////////////////////////////////////////////
+		RingBuffer<Sample>			samples;		///< The most recent frames
+		Time						budget;			///< The frame time above which a frame is over budget
+		u64							overBudget;		///< The number of frames over budget
+		mutable std::vector<Time>	scratch;		///< The sorted values of a query, kept to avoid allocations
+
+	};
+}
\ No newline at end of file
@@ -0,0 +1,129 @@
+﻿// 
+// HeadlessEventSource.hpp
+// Core
+// 
+// Created by Felix Busch on 19.10.2026.
+// Copyright © 2026 Felix Busch. All rights reserved.
+// 
+
+#pragma once
+
+#include <Core/System/EventPublisher.hpp>
+#include <Core/System/Time.hpp>
+
+#include <mutex>
+#include <condition_variable>
+#include <chrono>
+#include <vector>
+
+namespace Core
+{
+	////////////////////////////////////////////////////////////
+	/// \brief Event publisher that is fed by other threads
+	///		   instead of an operating system window
+	/// 
+	///	Events posted from any thread are collected and handed to
+	///	the publisher in QueueEvents(). WaitEvents() sleeps on a
+	///	condition variable until an event is posted or Wake() is
+	///	called, which makes it possible to drive the application
+	///	loop without a window, e.g. on machines without a display.
+	/// 
+	////////////////////////////////////////////////////////////
+	template<typename TEvent>
+	class HeadlessEventSource : public EventPublisher<TEvent>
+	{
+	public:
+
+		////////////////////////////////////////////////////////////
+		/// \brief Default destructor
+		/// 
+		////////////////////////////////////////////////////////////
+		virtual ~HeadlessEventSource() override = default;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Post an event from any thread
+		/// 
+		///	The event is published by the next call to
+		///	DispatchEvents() on the thread that owns the source.
+		/// 
+		///	\param event The event to post
+		/// 
+		////////////////////////////////////////////////////////////
+		void Post(const TEvent& event)
+		{
+			{
+				std::scoped_lock lock(mutex);
+				pending.push_back(event);
+			}
+
+			condition.notify_one();
+		}
+
+		////////////////////////////////////////////////////////////
+		/// \brief Interrupt the thread that waits in WaitEvents()
+		/// 
+		////////////////////////////////////////////////////////////
+		virtual void Wake() override
+		{
+			{
+				std::scoped_lock lock(mutex);
+				woken = true;
+			}
+
+			condition.notify_one();
+		}
+
+	protected:
+
+		////////////////////////////////////////////////////////////
+		/// \brief Move the posted events into the queue
+		/// 
+		////////////////////////////////////////////////////////////
+		virtual void QueueEvents() override
+		{
+			// take the events out while holding the lock as short as possible
+			{
+				std::scoped_lock lock(mutex);
+				pending.swap(queued);
+			}
+
+			for(TEvent& event : queued)
+			{
+				this->PushEvent(std::move(event));
+			}
+
+			queued.clear();
+		}
+
+		////////////////////////////////////////////////////////////
+		/// \brief Sleep until an event is posted, the timeout has
+		///		   expired or Wake() is called
+		/// 
+		////////////////////////////////////////////////////////////
+		virtual void WaitForEvents(const Time& timeout) override
+		{
+			std::unique_lock lock(mutex);
+
+			condition.wait_for(lock, std::chrono::nanoseconds(timeout.ToNanoseconds<int64_t>()), [this]
+			{
+				return woken || !pending.empty();
+			});
+
+			// consume the wake-up signal
+			woken = false;
+		}
+
+	private:
+
+		////////////////////////////////////////////////////////////
+		/// Member data
+		/// 
+		////////////////////////////////////////////////////////////
+		std::mutex				mutex;			///< Guards pending and woken
+		std::condition_variable	condition;		///< Signaled by Post() and Wake()
+		std::vector<TEvent>		pending;		///< Events posted since the last QueueEvents()
+		std::vector<TEvent>		queued;			///< Swap buffer that keeps its capacity between calls
+		bool					woken = false;	///< Has Wake() been called since the last wait?
+
+	};
+}
\ No newline at end of file
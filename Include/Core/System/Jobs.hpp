@@ -0,0 +1,231 @@
+﻿// 
+// Jobs.hpp
+// Core
+// 
+// Created by Felix Busch on 19.10.2026.
+// Copyright © 2026 Felix Busch. All rights reserved.
+// 
+
+#pragma once
+
+#include <Core/System/Time.hpp>
+#include <Core/System/Types.hpp>
+
+#include <atomic>
+#include <functional>
+#include <mutex>
+#include <vector>
+
+namespace Core
+{
+	////////////////////////////////////////////////////////////
+	/// \brief Define static class that runs jobs on a pool of
+	///		   worker threads
+	/// 
+	///	Every worker has its own queue. Jobs submitted by a job
+	///	go to the queue of its worker, other jobs are spread
+	///	across the queues. A worker runs its newest job first
+	///	and takes the oldest job of another worker when its own
+	///	queue is empty.
+	/// 
+	///	The pool is started by the Application, so sketches and
+	///	engine subsystems (image filters, tiled textures) share
+	///	the same threads:
+	/// 
+	///	\code
+	///	Jobs::Counter loaded;
+	///	Jobs::Submit([&] { LoadLevel(); }, &loaded);
+	///	Jobs::Submit([&] { BuildNavigation(); }, nullptr, &loaded);
+	///	...
+	///	Jobs::Wait(loaded);
+	///	\endcode
+	/// 
+	///	While the pool is not running, jobs are run right away on
+	///	the calling thread.
+	/// 
+	////////////////////////////////////////////////////////////
+	class Jobs
+	{
+	public:
+
+		////////////////////////////////////////////////////////////
+		/// \brief Define the function run by a job
+		/// 
+		////////////////////////////////////////////////////////////
+		using Job = std::function<void()>;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Count the unfinished jobs submitted with it
+		/// 
+		///	Jobs can be made to wait for a counter, and a thread
+		///	can wait for it with Wait(). A counter must not be
+		///	destroyed before Wait() returned for it.
+		/// 
+		////////////////////////////////////////////////////////////
+		class Counter
+		{
+		public:
+
+			////////////////////////////////////////////////////////////
+			/// \brief Create a counter without jobs
+			/// 
+			////////////////////////////////////////////////////////////
+			Counter() = default;
+
+			////////////////////////////////////////////////////////////
+			/// \brief Deleted copy operations
+			/// 
+			////////////////////////////////////////////////////////////
+			Counter(const Counter&) = delete;
+			Counter& operator = (const Counter&) = delete;
+
+			////////////////////////////////////////////////////////////
+			/// \brief Check whether all jobs have finished
+			/// 
+			////////////////////////////////////////////////////////////
+			[[nodiscard]] bool IsDone() const;
+
+			////////////////////////////////////////////////////////////
+			/// \brief Get the number of unfinished jobs
+			/// 
+			////////////////////////////////////////////////////////////
+			[[nodiscard]] u32 GetValue() const;
+
+		private:
+
+			friend class Jobs;
+
+			////////////////////////////////////////////////////////////
+			/// Member data
+			/// 
+			////////////////////////////////////////////////////////////
+			std::atomic<u32>						value = 0;	///< The number of unfinished jobs
+			std::mutex								mutex;		///< Guards the waiting jobs against the last job finishing
+			std::vector<std::pair<Job, Counter*>>	waiting;	///< The jobs to submit once the value drops to zero
+
+		};
+
+		////////////////////////////////////////////////////////////
+		/// \brief Define what a worker did since the pool started
+		/// 
+		////////////////////////////////////////////////////////////
+		struct WorkerStats
+		{
+			u64		JobCount;		///< The number of jobs run
+			u64		StealCount;		///< The number of jobs taken from other workers
+			Time	BusyTime;		///< The time spent running jobs
+			float	Utilization;	///< BusyTime divided by the time since the pool started, in [0, 1]
+		};
+
+		////////////////////////////////////////////////////////////
+		/// \brief Start the worker threads
+		/// 
+		///	Does nothing if the pool is already running. Start() and
+		///	Stop() must be called from the same thread, which must
+		///	not be a worker. Jobs may be submitted from other threads
+		///	meanwhile.
+		/// 
+		///	\param workerCount The number of threads, 0 means one
+		///					   less than there are hardware threads
+		/// 
+		////////////////////////////////////////////////////////////
+		static void Start(u32 workerCount = 0);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Wait for all jobs and stop the worker threads
+		/// 
+		///	Must not be called from a job. Jobs submitted while the
+		///	workers shut down are run on the submitting thread.
+		/// 
+		////////////////////////////////////////////////////////////
+		static void Stop();
+
+		////////////////////////////////////////////////////////////
+		/// \brief Check whether the worker threads are running
+		/// 
+		////////////////////////////////////////////////////////////
+		static bool IsRunning();
+
+		////////////////////////////////////////////////////////////
+		/// \brief Get the number of worker threads, 0 if the pool
+		///		   is not running
+		/// 
+		////////////////////////////////////////////////////////////
+		static u32 GetWorkerCount();
+
+		////////////////////////////////////////////////////////////
+		/// \brief Check whether the calling thread is a worker or
+		///		   runs a job right now
+		/// 
+		///	Functions that wait for all jobs, like Stop() and
+		///	WaitIdle(), must not be called while this is true.
+		/// 
+		////////////////////////////////////////////////////////////
+		static bool IsInJob();
+
+		////////////////////////////////////////////////////////////
+		/// \brief Queue a job
+		/// 
+		///	\param job			The function to run
+		///	\param counter		Optional counter that the job is
+		///						added to until it finished
+		///	\param dependency	Optional counter the job waits for
+		///						before it is queued
+		/// 
+		////////////////////////////////////////////////////////////
+		static void Submit(Job job, Counter* counter = nullptr, Counter* dependency = nullptr);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Invoke the body for contiguous sub-ranges of
+		///		   [0, count) and wait for all of them to finish
+		/// 
+		///	The range is cut into a few more sub-ranges than there
+		///	are threads, so workers that finish early steal the
+		///	rest. The calling thread takes part. Ranges smaller than
+		///	the grain size are not split any further.
+		/// 
+		/// \param count	The number of work items
+		/// \param grain	The minimum number of items per sub-range
+		/// \param body		Callback receiving [begin, end)
+		/// 
+		////////////////////////////////////////////////////////////
+		static void ParallelFor(u32 count, u32 grain, const std::function<void(u32 begin, u32 end)>& body);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Wait until all jobs of a counter have finished
+		/// 
+		///	The calling thread runs queued jobs while it waits.
+		///	Once there are none left, a thread outside the pool
+		///	sleeps until the last job of the counter finished. A
+		///	job keeps looking for work instead, since the jobs it
+		///	waits for may be queued behind it.
+		/// 
+		////////////////////////////////////////////////////////////
+		static void Wait(Counter& counter);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Wait until every submitted job has finished
+		/// 
+		///	Must not be called from a job.
+		/// 
+		////////////////////////////////////////////////////////////
+		static void WaitIdle();
+
+		////////////////////////////////////////////////////////////
+		/// \brief Get what a worker did since the pool started
+		/// 
+		///	\param worker Must be less than GetWorkerCount()
+		/// 
+		////////////////////////////////////////////////////////////
+		static WorkerStats GetWorkerStats(u32 worker);
+
+	private:
+
+		////////////////////////////////////////////////////////////
+		/// \brief Forward declaration of the implementation.
+		/// 
+		////////////////////////////////////////////////////////////
+		class Impl;
+
+	};
+}
\ No newline at end of file
@@ -0,0 +1,114 @@
+﻿// 
+// LatencyHistogram.hpp
+// Core
+// 
+// Created by Felix Busch on 19.10.2026.
+// Copyright © 2026 Felix Busch. All rights reserved.
+// 
+
+#pragma once
+
+#include <Core/System/Types.hpp>
+#include <Core/System/Time.hpp>
+
+#include <array>
+
+namespace Core
+{
+	////////////////////////////////////////////////////////////
+	/// \brief Histogram of durations with logarithmic buckets
+	/// 
+	///	Every power of two is split into eight buckets, so the
+	///	reported percentiles are at most 12.5% above the real
+	///	value while recording stays a constant-time increment
+	///	regardless of the number of samples.
+	/// 
+	///	This class is not thread-safe.
+	/// 
+	////////////////////////////////////////////////////////////
+	class LatencyHistogram
+	{
+	public:
+
+		////////////////////////////////////////////////////////////
+		/// \brief Default constructor
+		/// 
+		////////////////////////////////////////////////////////////
+		LatencyHistogram();
+
+		////////////////////////////////////////////////////////////
+		/// \brief Add a sample, negative durations count as zero
+		/// 
+		////////////////////////////////////////////////////////////
+		void Record(const Time& duration);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Remove all samples
+		/// 
+		////////////////////////////////////////////////////////////
+		void Reset();
+
+		////////////////////////////////////////////////////////////
+		/// \brief Get the duration below which the given percentage
+		///		   of the samples lie
+		/// 
+		///	\param percentile The percentage in [0, 100], e.g. 99
+		/// 
+		///	\return The upper bound of the matching bucket, or zero
+		///			if there are no samples
+		/// 
+		////////////////////////////////////////////////////////////
+		[[nodiscard]] Time GetPercentile(float percentile) const;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Get the average of all samples
+		/// 
+		////////////////////////////////////////////////////////////
+		[[nodiscard]] Time GetMean() const;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Get the longest sample
+		/// 
+		////////////////////////////////////////////////////////////
+		[[nodiscard]] const Time& GetMax() const;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Get the number of samples
+		/// 
+		////////////////////////////////////////////////////////////
+		[[nodiscard]] u64 GetCount() const;
+
+	private:
+
+		////////////////////////////////////////////////////////////
+		/// The number of buckets per power of two, as exponent
+		/// 
+		////////////////////////////////////////////////////////////
+		static constexpr u32 SubBucketBits = 3;
+		static constexpr u32 SubBucketCount = 1u << SubBucketBits;
+		static constexpr u32 BucketCount = 64 * SubBucketCount;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Get the bucket of a duration in nanoseconds
+		/// 
+		////////////////////////////////////////////////////////////
+		static u32 GetBucket(u64 nanoseconds);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Get the largest duration in nanoseconds that
+		///		   falls into a bucket
+		/// 
+		////////////////////////////////////////////////////////////
+		static u64 GetUpperBound(u32 bucket);
+
+		////////////////////////////////////////////////////////////
+		/// Member data
+		/// 
+		////////////////////////////////////////////////////////////
+		std::array<u64, BucketCount>	buckets;	///< The number of samples per bucket
+		u64								count;		///< The number of samples
+		u64								sum;		///< The sum of all samples in nanoseconds
+		Time							max;		///< The longest sample
+
+	};
+}
\ No newline at end of file
@@ -0,0 +1,64 @@
+﻿// 
+// Parallel.hpp
+// Core
+// 
+// Created by Felix Busch on 19.10.2026.
+// Copyright © 2026 Felix Busch. All rights reserved.
+// 
+
+#pragma once
+
+#include <Core/System/Types.hpp>
+
+#include <functional>
+
+namespace Core
+{
+
+	////////////////////////////////////////////////////////////
+	/// \brief Define static class that splits a range of work
+	///		   items across multiple threads.
+	/// 
+	///	The work runs on the job workers (see Jobs), so it shares
+	///	the threads with the jobs of the sketch. While the job
+	///	system is not running, everything runs on the calling
+	///	thread.
+	/// 
+	////////////////////////////////////////////////////////////
+	class Parallel
+	{
+	public:
+
+		////////////////////////////////////////////////////////////
+		/// \brief Invoke the body for contiguous sub-ranges of
+		///		   [0, count) and wait for all of them to finish.
+		/// 
+		///	The calling thread processes one of the sub-ranges
+		///	itself. Ranges smaller than the grain size are not
+		///	split any further.
+		/// 
+		/// \param count	The number of work items
+		/// \param grain	The minimum number of items per sub-range
+		/// \param body		Callback receiving [begin, end)
+		/// 
+		////////////////////////////////////////////////////////////
+		static void For(u32 count, u32 grain, const std::function<void(u32 begin, u32 end)>& body);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Limit the number of threads used by For().
+		/// 
+		/// \param threadCount The maximum number of threads, 0
+		///					   means all job workers and the
+		///					   calling thread.
+		/// 
+		////////////////////////////////////////////////////////////
+		static void SetThreadCount(u32 threadCount);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Get the maximum number of threads used by For().
+		/// 
+		////////////////////////////////////////////////////////////
+		static u32 GetThreadCount();
+	};
+
+}
\ No newline at end of file
@@ -8,12 +8,32 @@
 
 #pragma once
 
-#include <queue>
+#include <Core/System/Time.hpp>
+#include <Core/System/Types.hpp>
+#include <Core/System/RingBuffer.hpp>
+
+#include <utility>
 
 namespace Core
 {
+	////////////////////////////////////////////////////////////
+	/// \brief Define what happens when an event is pushed to a
+	///		   full queue
+	/// 
+	////////////////////////////////////////////////////////////
+	enum class OverflowPolicy
+	{
+		Grow,		//!< Double the capacity, no event is lost
+		DropOldest,	//!< Discard the oldest queued event
+		Coalesce	//!< Merge the event into the newest one if possible, drop the oldest otherwise
+	};
+
 	////////////////////////////////////////////////////////////
 	/// \brief Event system that uses polling
+	///
+	///	The events are stored in a ring buffer that is allocated
+	///	once, so pushing and polling don't allocate as long as
+	///	the capacity is not exceeded.
 	/// 
 	////////////////////////////////////////////////////////////
 	template<typename TEvent>
@@ -21,8 +41,28 @@ namespace Core
 	{
 	public:
 
+		////////////////////////////////////////////////////////////
+		/// The number of events the queue holds before it overflows
+		/// 
+		////////////////////////////////////////////////////////////
+		static constexpr usize DefaultCapacity = 256;
+
 		////////////////////////////////////////////////////////////
 		/// \brief Default constructor
+		///
+		///	\param capacity	The number of events to preallocate
+		///	\param policy	What to do when the queue is full
+		/// 
+		////////////////////////////////////////////////////////////
+		explicit PollEventSystem(usize capacity = DefaultCapacity, OverflowPolicy policy = OverflowPolicy::Grow):
+			events(capacity),
+			overflowPolicy(policy),
+			droppedEvents(0)
+		{
+		}
+
+		////////////////////////////////////////////////////////////
+		/// \brief Default destructor
 		/// 
 		////////////////////////////////////////////////////////////
 		virtual ~PollEventSystem() = default;
@@ -33,7 +73,7 @@ namespace Core
 		////////////////////////////////////////////////////////////
 		void PushEvent(const TEvent& event)
 		{
-			events.push(event);
+			Push(event);
 		}
 
 		////////////////////////////////////////////////////////////
@@ -42,7 +82,58 @@ namespace Core
 		////////////////////////////////////////////////////////////
 		void PushEvent(TEvent&& event)
 		{
-			events.emplace(event);
+			Push(std::move(event));
+		}
+
+		////////////////////////////////////////////////////////////
+		/// \brief Set what happens when the queue is full
+		/// 
+		////////////////////////////////////////////////////////////
+		void SetOverflowPolicy(OverflowPolicy policy)
+		{
+			overflowPolicy = policy;
+		}
+
+		////////////////////////////////////////////////////////////
+		/// \brief Get what happens when the queue is full
+		/// 
+		////////////////////////////////////////////////////////////
+		[[nodiscard]] OverflowPolicy GetOverflowPolicy() const
+		{
+			return overflowPolicy;
+		}
+
+		////////////////////////////////////////////////////////////
+		/// \brief Get the number of events discarded because the
+		///		   queue was full
+		/// 
+		////////////////////////////////////////////////////////////
+		[[nodiscard]] usize GetDroppedEventCount() const
+		{
+			return droppedEvents;
+		}
+
+		////////////////////////////////////////////////////////////
+		/// \brief Enable/Disable merging consecutive events
+		///
+		///	When enabled (the default), an event is offered to
+		///	MergeEvent() together with the most recently queued
+		///	event. Disable it to keep the full history, e.g. every
+		///	single mouse position for drawing applications.
+		/// 
+		////////////////////////////////////////////////////////////
+		void SetCoalescingEnabled(bool enabled)
+		{
+			coalescingEnabled = enabled;
+		}
+
+		////////////////////////////////////////////////////////////
+		/// \brief Check whether consecutive events are merged
+		/// 
+		////////////////////////////////////////////////////////////
+		[[nodiscard]] bool IsCoalescingEnabled() const
+		{
+			return coalescingEnabled;
 		}
 		
 		////////////////////////////////////////////////////////////
@@ -58,17 +149,14 @@ namespace Core
 				QueueEvents();
 			}
 
-			if(HasEvents())
+			while(HasEvents())
 			{
-				// copy event into new buffer
-				const TEvent currentEvent = events.front();
-				events.pop();
+				// move the event straight into the caller's buffer
+				events.PopFront(event);
 
-				// apply filtering
-				if(FilterEvent(currentEvent))
+				// apply filtering, filtered events don't end the polling
+				if(FilterEvent(event))
 				{
-					// copy the event
-					event = currentEvent;
 					return true;
 				}
 			}
@@ -85,7 +173,49 @@ namespace Core
 		////////////////////////////////////////////////////////////
 		[[nodiscard]] bool HasEvents() const
 		{
-			return !events.empty();
+			return !events.IsEmpty();
+		}
+
+		////////////////////////////////////////////////////////////
+		/// \brief Block until events are queued, the timeout has
+		///		   expired or Wake() has been called
+		///
+		///	Returns immediately if events are already waiting to be
+		///	polled.
+		///
+		///	\param timeout The maximum duration to wait
+		///
+		///	\return True if there are events in the queue, false otherwise
+		/// 
+		////////////////////////////////////////////////////////////
+		bool WaitEvents(const Time& timeout)
+		{
+			if(!HasEvents())
+			{
+				QueueEvents();
+			}
+
+			if(!HasEvents() && timeout > Time::Zero)
+			{
+				// sleep until the external source signals new events
+				WaitForEvents(timeout);
+				QueueEvents();
+			}
+
+			return HasEvents();
+		}
+
+		////////////////////////////////////////////////////////////
+		/// \brief Interrupt a thread that is blocked in WaitEvents()
+		///
+		///	May be called from any thread. A wake-up that arrives
+		///	while no thread is waiting is remembered, so the next
+		///	wait returns immediately.
+		/// 
+		////////////////////////////////////////////////////////////
+		virtual void Wake()
+		{
+			// nothing to do
 		}
 
 	protected:
@@ -102,25 +232,114 @@ namespace Core
 			// nothing to do
 		}
 
+		////////////////////////////////////////////////////////////
+		/// \brief Block until the external source has events to
+		///		   queue, the timeout has expired or Wake() has been
+		///		   called
+		///
+		///	This method can be overwritten by systems that are able
+		///	to sleep. By default it returns immediately.
+		///
+		///	\param timeout The maximum duration to wait
+		/// 
+		////////////////////////////////////////////////////////////
+		virtual void WaitForEvents([[maybe_unused]] const Time& timeout)
+		{
+			// nothing to do
+		}
+
 		////////////////////////////////////////////////////////////
 		/// \brief Filter the event based on its data
 		///
 		///	\return True if the event should be published, false otherwise
 		/// 
 		////////////////////////////////////////////////////////////
-		virtual bool FilterEvent(const TEvent& event)
+		virtual bool FilterEvent([[maybe_unused]] const TEvent& event)
 		{
 			// forward the event
 			return true;
 		}
 
+		////////////////////////////////////////////////////////////
+		/// \brief Merge an event into the most recently queued one
+		///
+		///	This method can be overwritten to replace events that
+		///	only describe a state (like a position) instead of
+		///	queuing every intermediate step.
+		///
+		///	\param last	The most recently queued event
+		///	\param next	The event that is being pushed
+		///
+		///	\return True if \a next has been merged into \a last,
+		///			false if it has to be queued
+		/// 
+		////////////////////////////////////////////////////////////
+		virtual bool MergeEvent([[maybe_unused]] TEvent& last, [[maybe_unused]] const TEvent& next)
+		{
+			// queue every event
+			return false;
+		}
+
 	private:
 
+		////////////////////////////////////////////////////////////
+		/// \brief Try to merge an event into the back of the queue
+		/// 
+		////////////////////////////////////////////////////////////
+		bool Coalesce(const TEvent& event)
+		{
+			return coalescingEnabled && HasEvents() && MergeEvent(events.Back(), event);
+		}
+
+		////////////////////////////////////////////////////////////
+		/// \brief Shared implementation of both PushEvent() overloads
+		/// 
+		////////////////////////////////////////////////////////////
+		template<typename U>
+		void Push(U&& event)
+		{
+			if(Coalesce(event))
+			{
+				return;
+			}
+
+			if(events.IsFull())
+			{
+				switch(overflowPolicy)
+				{
+					case OverflowPolicy::Grow:
+					{
+						events.Grow();
+					} break;
+
+					case OverflowPolicy::Coalesce:
+					{
+						// merge even if coalescing is disabled, it's better than losing the event
+						if(!coalescingEnabled && MergeEvent(events.Back(), event))
+						{
+							return;
+						}
+					} [[fallthrough]];
+
+					case OverflowPolicy::DropOldest:
+					{
+						events.PopFront();
+						++droppedEvents;
+					} break;
+				}
+			}
+
+			events.PushBack(std::forward<U>(event));
+		}
+
 		////////////////////////////////////////////////////////////
 		/// Member data
 		/// 
 		////////////////////////////////////////////////////////////
-		std::queue<TEvent> events; //!< Events to handle when dispatching
+		RingBuffer<TEvent>	events;						//!< Events to handle when dispatching
+		OverflowPolicy		overflowPolicy;				//!< What to do when the queue is full
+		usize				droppedEvents;				//!< The number of events lost by overflowing
+		bool				coalescingEnabled = true;	//!< Merge consecutive events with MergeEvent()
 
 	};
 
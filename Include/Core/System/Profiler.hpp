@@ -0,0 +1,181 @@
+﻿// 
+// Profiler.hpp
+// Core
+// 
+// Created by Felix Busch on 19.10.2026.
+// Copyright © 2026 Felix Busch. All rights reserved.
+// 
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+/// \brief Measure the enclosing scope
+/// 
+///	\a name must be a string literal (or otherwise live until
+///	the profiler has been stopped). Without CORE_ENABLE_PROFILER
+///	the macros expand to nothing.
+/// 
+////////////////////////////////////////////////////////////
+#ifdef CORE_ENABLE_PROFILER
+#define CORE_PROFILE_CONCAT_IMPL(a, b) a##b
+#define CORE_PROFILE_CONCAT(a, b) CORE_PROFILE_CONCAT_IMPL(a, b)
+#define CORE_PROFILE_SCOPE(name) const ::Core::ProfileScope CORE_PROFILE_CONCAT(profileScope, __LINE__)(name)
+#define CORE_PROFILE_FUNCTION() CORE_PROFILE_SCOPE(__FUNCTION__)
+#define CORE_PROFILE_THREAD(name) ::Core::Profiler::SetThreadName(name)
+#else
+#define CORE_PROFILE_SCOPE(name) ((void)0)
+#define CORE_PROFILE_FUNCTION() ((void)0)
+#define CORE_PROFILE_THREAD(name) ((void)0)
+#endif
+
+#include <Core/System/Types.hpp>
+
+#include <filesystem>
+
+namespace Core
+{
+	////////////////////////////////////////////////////////////
+	/// \brief Collect the scopes marked with CORE_PROFILE_SCOPE
+	///		   and write them to a trace file
+	/// 
+	///	Every thread writes begin and end records into its own
+	///	lock-free queue, a background thread drains the queues
+	///	and writes them in the Chrome trace event format, which
+	///	can be opened in chrome://tracing or ui.perfetto.dev.
+	/// 
+	///	Records are only taken between Start() and Stop(). When a
+	///	queue is full the record is dropped and counted instead of
+	///	blocking the thread being measured.
+	/// 
+	///	Scopes still open at Stop() are ended in the trace at the
+	///	time of Stop(), end records without a begin record in the
+	///	trace are left out.
+	/// 
+	///	Without CORE_ENABLE_PROFILER, Start() fails and nothing
+	///	is recorded.
+	/// 
+	////////////////////////////////////////////////////////////
+	class Profiler
+	{
+	public:
+
+		////////////////////////////////////////////////////////////
+		/// \brief The kind of a record
+		/// 
+		////////////////////////////////////////////////////////////
+		enum Phase
+		{
+			Begin,	///< A scope was entered
+			End		///< A scope was left
+		};
+
+		////////////////////////////////////////////////////////////
+		/// \brief Open the trace file and start recording
+		/// 
+		///	\return False if the file could not be created or the
+		///			profiler is disabled
+		/// 
+		////////////////////////////////////////////////////////////
+		static bool Start(const std::filesystem::path& filepath);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Stop recording, write the remaining records and
+		///		   close the file
+		/// 
+		////////////////////////////////////////////////////////////
+		static void Stop();
+
+		////////////////////////////////////////////////////////////
+		/// \brief Check whether records are taken
+		/// 
+		////////////////////////////////////////////////////////////
+		static bool IsRunning();
+
+		////////////////////////////////////////////////////////////
+		/// \brief Name the calling thread in the trace
+		/// 
+		////////////////////////////////////////////////////////////
+		static void SetThreadName(const char* name);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Add a record for the calling thread
+		/// 
+		///	Does nothing while the profiler is not running.
+		/// 
+		////////////////////////////////////////////////////////////
+		static void Emit(const char* name, Phase phase);
+
+		////////////////////////////////////////////////////////////
+		/// \brief Get the number of records dropped because a
+		///		   queue was full
+		/// 
+		////////////////////////////////////////////////////////////
+		static u64 GetDroppedRecordCount();
+
+		////////////////////////////////////////////////////////////
+		/// \brief Get the number of record buffers allocated
+		/// 
+		///	Every thread that records gets one. The buffer of an
+		///	ended thread is reused by the next thread that starts
+		///	recording, so the count follows the number of threads
+		///	alive at the same time.
+		/// 
+		////////////////////////////////////////////////////////////
+		static u64 GetBufferCount();
+
+	};
+
+#ifdef CORE_ENABLE_PROFILER
+	////////////////////////////////////////////////////////////
+	/// \brief Emit the begin and end records of a scope
+	/// 
+	///	Use through CORE_PROFILE_SCOPE.
+	/// 
+	////////////////////////////////////////////////////////////
+	class ProfileScope
+	{
+	public:
+
+		////////////////////////////////////////////////////////////
+		/// \brief Enter the scope
+		/// 
+		////////////////////////////////////////////////////////////
+		explicit ProfileScope(const char* name):
+			name(Profiler::IsRunning() ? name : nullptr)
+		{
+			if(this->name)
+			{
+				Profiler::Emit(this->name, Profiler::Begin);
+			}
+		}
+
+		////////////////////////////////////////////////////////////
+		/// \brief Leave the scope
+		/// 
+		////////////////////////////////////////////////////////////
+		~ProfileScope()
+		{
+			if(name)
+			{
+				Profiler::Emit(name, Profiler::End);
+			}
+		}
+
+		////////////////////////////////////////////////////////////
+		/// \brief Deleted copy operations
+		/// 
+		////////////////////////////////////////////////////////////
+		ProfileScope(const ProfileScope&) = delete;
+		ProfileScope& operator = (const ProfileScope&) = delete;
+
+	private:
+
+		////////////////////////////////////////////////////////////
+		/// Member data
+		/// 
+		////////////////////////////////////////////////////////////
+		const char* name; ///< The name of the scope, nullptr if the profiler was not running
+
+	};
+#endif
+}
\ No newline at end of file
@@ -0,0 +1,191 @@
+﻿// 
+// RingBuffer.hpp
+// Core
+// 
+// Created by Felix Busch on 19.10.2026.
+// Copyright © 2026 Felix Busch. All rights reserved.
+// 
+
+#pragma once
+
+#include <Core/System/Types.hpp>
+
+#include <vector>
+#include <utility>
+
+namespace Core
+{
+	////////////////////////////////////////////////////////////
+	/// \brief First-in-first-out queue on top of a preallocated
+	///		   array
+	/// 
+	///	The capacity is always a power of two so wrapping around
+	///	is a single mask. Pushing and popping never allocate, the
+	///	storage only changes when Grow() is called explicitly.
+	/// 
+	///	This class is not thread-safe.
+	/// 
+	////////////////////////////////////////////////////////////
+	template<typename T>
+	class RingBuffer
+	{
+	public:
+
+		////////////////////////////////////////////////////////////
+		/// \brief Create the buffer with a fixed capacity
+		/// 
+		///	\param capacity The minimum number of elements the buffer
+		///					can hold
+		/// 
+		////////////////////////////////////////////////////////////
+		explicit RingBuffer(usize capacity):
+			slots(RoundUp(capacity)),
+			head(0),
+			size(0)
+		{
+		}
+
+		////////////////////////////////////////////////////////////
+		/// \brief Append an element at the back
+		/// 
+		///	The buffer must not be full.
+		/// 
+		////////////////////////////////////////////////////////////
+		void PushBack(const T& value)
+		{
+			slots[(head + size) & GetMask()] = value;
+			++size;
+		}
+
+		void PushBack(T&& value)
+		{
+			slots[(head + size) & GetMask()] = std::move(value);
+			++size;
+		}
+
+		////////////////////////////////////////////////////////////
+		/// \brief Move the front element out of the buffer
+		/// 
+		///	The buffer must not be empty.
+		/// 
+		////////////////////////////////////////////////////////////
+		void PopFront(T& value)
+		{
+			value = std::move(slots[head]);
+			PopFront();
+		}
+
+		////////////////////////////////////////////////////////////
+		/// \brief Discard the front element
+		/// 
+		///	The buffer must not be empty.
+		/// 
+		////////////////////////////////////////////////////////////
+		void PopFront()
+		{
+			head = (head + 1) & GetMask();
+			--size;
+		}
+
+		////////////////////////////////////////////////////////////
+		/// \brief Access the oldest and the newest element
+		/// 
+		///	The buffer must not be empty.
+		/// 
+		////////////////////////////////////////////////////////////
+		[[nodiscard]] T& Front() { return slots[head]; }
+		[[nodiscard]] T& Back() { return slots[(head + size - 1) & GetMask()]; }
+
+		////////////////////////////////////////////////////////////
+		/// \brief Access an element by its distance from the
+		///		   oldest one
+		/// 
+		///	\a index must be less than GetSize().
+		/// 
+		////////////////////////////////////////////////////////////
+		[[nodiscard]] T& operator [] (usize index) { return slots[(head + index) & GetMask()]; }
+		[[nodiscard]] const T& operator [] (usize index) const { return slots[(head + index) & GetMask()]; }
+
+		////////////////////////////////////////////////////////////
+		/// \brief Double the capacity while keeping the order of
+		///		   the elements
+		/// 
+		////////////////////////////////////////////////////////////
+		void Grow()
+		{
+			std::vector<T> grown(slots.size() * 2);
+
+			for(usize i = 0; i < size; ++i)
+			{
+				grown[i] = std::move(slots[(head + i) & GetMask()]);
+			}
+
+			slots = std::move(grown);
+			head = 0;
+		}
+
+		////////////////////////////////////////////////////////////
+		/// \brief Remove all elements but keep the storage
+		/// 
+		////////////////////////////////////////////////////////////
+		void Clear()
+		{
+			head = 0;
+			size = 0;
+		}
+
+		////////////////////////////////////////////////////////////
+		/// \brief Get the number of elements
+		/// 
+		////////////////////////////////////////////////////////////
+		[[nodiscard]] usize GetSize() const { return size; }
+
+		////////////////////////////////////////////////////////////
+		/// \brief Get the number of elements the buffer can hold
+		/// 
+		////////////////////////////////////////////////////////////
+		[[nodiscard]] usize GetCapacity() const { return slots.size(); }
+
+		////////////////////////////////////////////////////////////
+		/// \brief Check whether the buffer is empty or full
+		/// 
+		////////////////////////////////////////////////////////////
+		[[nodiscard]] bool IsEmpty() const { return size == 0; }
+		[[nodiscard]] bool IsFull() const { return size == slots.size(); }
+
+	private:
+
+		////////////////////////////////////////////////////////////
+		/// \brief Get the mask that wraps an index around
+		/// 
+		////////////////////////////////////////////////////////////
+		[[nodiscard]] usize GetMask() const
+		{
+			return slots.size() - 1;
+		}
+
+		////////////////////////////////////////////////////////////
+		/// \brief Round a capacity up to the next power of two
+		/// 
+		////////////////////////////////////////////////////////////
+		static usize RoundUp(usize capacity)
+		{
+			usize result = 1;
+			while(result < capacity)
+			{
+				result <<= 1;
+			}
+
+			return result;
+		}
+
+		////////////////////////////////////////////////////////////
+		/// Member data
+		/// 
+		////////////////////////////////////////////////////////////
+		std::vector<T>	slots;	///< The storage, its size is a power of two
+		usize			head;	///< The index of the front element
+		usize			size;	///< The number of elements
+
+	};
+}
\ No newline at end of file
@@ -0,0 +1,186 @@
+﻿// 
+// SpscQueue.hpp
+// Core
+// 
+// Created by Felix Busch on 19.10.2026.
+// Copyright © 2026 Felix Busch. All rights reserved.
+// 
+
+#pragma once
+
+#include <Core/System/Types.hpp>
+
+#include <atomic>
+#include <vector>
+#include <utility>
+
+namespace Core
+{
+	////////////////////////////////////////////////////////////
+	/// \brief Bounded lock-free queue for exactly one producer
+	///		   thread and one consumer thread
+	/// 
+	///	The capacity is rounded up to a power of two and allocated
+	///	once. Both indices grow monotonically and are masked when
+	///	accessing a slot, so no slot is wasted to tell a full queue
+	///	from an empty one.
+	/// 
+	///	Each side keeps a cached copy of the other side's index and
+	///	only reloads it when the queue looks full (or empty), which
+	///	keeps the two cache lines from bouncing between the threads
+	///	on every operation.
+	/// 
+	////////////////////////////////////////////////////////////
+	template<typename T>
+	class SpscQueue
+	{
+	public:
+
+		////////////////////////////////////////////////////////////
+		/// \brief Create the queue with a fixed capacity
+		/// 
+		///	\param capacity The minimum number of elements the queue
+		///					can hold
+		/// 
+		////////////////////////////////////////////////////////////
+		explicit SpscQueue(usize capacity):
+			mask(0),
+			head(0),
+			cachedTail(0),
+			tail(0),
+			cachedHead(0)
+		{
+			usize size = 1;
+			while(size < capacity)
+			{
+				size <<= 1;
+			}
+
+			slots.resize(size);
+			mask = size - 1;
+		}
+
+		SpscQueue(const SpscQueue&) = delete;
+		SpscQueue& operator = (const SpscQueue&) = delete;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Append an element (producer thread only)
+		/// 
+		///	\return False if the queue is full
+		/// 
+		////////////////////////////////////////////////////////////
+		bool TryPush(const T& value)
+		{
+			return Push(value);
+		}
+
+		bool TryPush(T&& value)
+		{
+			return Push(std::move(value));
+		}
+
+		////////////////////////////////////////////////////////////
+		/// \brief Remove the oldest element (consumer thread only)
+		/// 
+		///	\param value Receives the element
+		/// 
+		///	\return False if the queue is empty
+		/// 
+		////////////////////////////////////////////////////////////
+		bool TryPop(T& value)
+		{
+			const usize position = head.load(std::memory_order_relaxed);
+
+			if(position == cachedTail)
+			{
+				// refresh the producer index only when the queue looks empty
+				cachedTail = tail.load(std::memory_order_acquire);
+
+				if(position == cachedTail)
+				{
+					return false;
+				}
+			}
+
+			value = std::move(slots[position & mask]);
+			head.store(position + 1, std::memory_order_release);
+			return true;
+		}
+
+		////////////////////////////////////////////////////////////
+		/// \brief Get the number of elements the queue can hold
+		/// 
+		////////////////////////////////////////////////////////////
+		[[nodiscard]] usize GetCapacity() const
+		{
+			return slots.size();
+		}
+
+		////////////////////////////////////////////////////////////
+		/// \brief Get the number of queued elements
+		/// 
+		///	The value is only a snapshot when called while the other
+		///	thread is working on the queue.
+		/// 
+		////////////////////////////////////////////////////////////
+		[[nodiscard]] usize GetSize() const
+		{
+			return tail.load(std::memory_order_acquire) - head.load(std::memory_order_acquire);
+		}
+
+		////////////////////////////////////////////////////////////
+		/// \brief Check whether the queue holds any element
+		/// 
+		////////////////////////////////////////////////////////////
+		[[nodiscard]] bool IsEmpty() const
+		{
+			return GetSize() == 0;
+		}
+
+	private:
+
+		////////////////////////////////////////////////////////////
+		/// \brief Shared implementation of both TryPush() overloads
+		/// 
+		////////////////////////////////////////////////////////////
+		template<typename U>
+		bool Push(U&& value)
+		{
+			const usize position = tail.load(std::memory_order_relaxed);
+
+			if(position - cachedHead == slots.size())
+			{
+				// refresh the consumer index only when the queue looks full
+				cachedHead = head.load(std::memory_order_acquire);
+
+				if(position - cachedHead == slots.size())
+				{
+					return false;
+				}
+			}
+
+			slots[position & mask] = std::forward<U>(value);
+			tail.store(position + 1, std::memory_order_release);
+			return true;
+		}
+
+		////////////////////////////////////////////////////////////
+		/// The size of a cache line, used to keep the indices of
+		/// both threads apart
+		/// 
+		////////////////////////////////////////////////////////////
+		static constexpr usize CacheLineSize = 64;
+
+		////////////////////////////////////////////////////////////
+		/// Member data
+		/// 
+		////////////////////////////////////////////////////////////
+		std::vector<T>								slots;			///< The ring storage
+		usize										mask;			///< The capacity minus one
+		alignas(CacheLineSize) std::atomic<usize>	head;			///< The next element to pop, written by the consumer
+		usize										cachedTail;		///< The consumer's copy of tail
+		alignas(CacheLineSize) std::atomic<usize>	tail;			///< The next slot to push to, written by the producer
+		usize										cachedHead;		///< The producer's copy of head
+
+	};
+}
\ No newline at end of file
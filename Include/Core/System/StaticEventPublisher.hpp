@@ -0,0 +1,105 @@
+﻿// 
+// StaticEventPublisher.hpp
+// Core
+// 
+// Created by Felix Busch on 19.10.2026.
+// Copyright © 2026 Felix Busch. All rights reserved.
+// 
+
+#pragma once
+
+#include <Core/System/PollEventSystem.hpp>
+
+#include <tuple>
+
+namespace Core
+{
+	////////////////////////////////////////////////////////////
+	/// \brief Event publisher with a set of listeners that is
+	///		   fixed at compile time
+	/// 
+	///	The listeners are held by reference and notified in the
+	///	order of the template arguments through a fold expression.
+	///	Each call is qualified with the listener type, so it is a
+	///	direct call that can be inlined instead of a virtual one.
+	///	Therefore every type in \a Listeners must be the dynamic
+	///	type of the object passed in, not one of its base classes.
+	/// 
+	///	A listener is any type with an OnEvent(const TEvent&)
+	///	method, it doesn't have to implement IEventListener.
+	/// 
+	///	\code
+	///	StaticEventPublisher<WindowEvent, Player, Camera> publisher(player, camera);
+	///	publisher.PushEvent(event);
+	///	publisher.DispatchEvents();
+	///	\endcode
+	/// 
+	////////////////////////////////////////////////////////////
+	template<typename TEvent, typename... Listeners>
+	class StaticEventPublisher : PollEventSystem<TEvent>
+	{
+	public:
+
+		////////////////////////////////////////////////////////////
+		/// \brief Create the publisher
+		/// 
+		///	\param listeners The listeners to notify, they must
+		///					 outlive the publisher
+		/// 
+		////////////////////////////////////////////////////////////
+		explicit StaticEventPublisher(Listeners&... listeners):
+			listeners(listeners...)
+		{
+		}
+
+		////////////////////////////////////////////////////////////
+		/// \brief Default destructor
+		/// 
+		////////////////////////////////////////////////////////////
+		virtual ~StaticEventPublisher() override = default;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Adopt the PushEvent method
+		/// 
+		////////////////////////////////////////////////////////////
+		using PollEventSystem<TEvent>::PushEvent;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Notify all listeners about a single event right
+		///		   away, bypassing the queue
+		/// 
+		////////////////////////////////////////////////////////////
+		void Publish(const TEvent& event)
+		{
+			std::apply([&event](Listeners&... listener)
+			{
+				(listener.Listeners::OnEvent(event), ...);
+			}, listeners);
+		}
+
+		////////////////////////////////////////////////////////////
+		/// \brief Notify all listeners about the queued events
+		/// 
+		////////////////////////////////////////////////////////////
+		void DispatchEvents()
+		{
+			// declare event buffer
+			TEvent event = {};
+
+			// dispatch every queued event
+			while(this->PollEvents(event))
+			{
+				Publish(event);
+			}
+		}
+
+	private:
+
+		////////////////////////////////////////////////////////////
+		/// Member data
+		/// 
+		////////////////////////////////////////////////////////////
+		std::tuple<Listeners&...> listeners; ///< The listeners to notify
+
+	};
+}
\ No newline at end of file
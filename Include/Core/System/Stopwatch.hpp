@@ -30,6 +30,16 @@ namespace Core
 		////////////////////////////////////////////////////////////
 		static Stopwatch StartNew();
 
+		////////////////////////////////////////////////////////////
+		/// \brief Get the current time of the monotonic clock used
+		///		   by all stopwatches
+		///
+		///	The epoch is unspecified, only differences between two
+		///	timestamps are meaningful.
+		/// 
+		////////////////////////////////////////////////////////////
+		static Time GetTimestamp();
+
 		////////////////////////////////////////////////////////////
 		/// \brief Default constructor
 		/// 
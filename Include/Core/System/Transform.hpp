@@ -154,39 +154,54 @@ namespace Core
 		[[nodiscard]] constexpr Transform Inverse() const
 		{
 			const float* m = matrix;
-			float inv[16]{};
 
-			inv[0] = m[5] * m[10] * m[15] - m[5] * m[11] * m[14] - m[9] * m[6] * m[15] + m[9] * m[7] * m[14] + m[13] * m[6] * m[11] - m[13] * m[7] * m[10];
-			inv[4] = -m[4] * m[10] * m[15] + m[4] * m[11] * m[14] + m[8] * m[6] * m[15] - m[8] * m[7] * m[14] - m[12] * m[6] * m[11] + m[12] * m[7] * m[10];
-			inv[8] = m[4] * m[9] * m[15] - m[4] * m[11] * m[13] - m[8] * m[5] * m[15] + m[8] * m[7] * m[13] + m[12] * m[5] * m[11] - m[12] * m[7] * m[9];
-			inv[12] = -m[4] * m[9] * m[14] + m[4] * m[10] * m[13] + m[8] * m[5] * m[14] - m[8] * m[6] * m[13] - m[12] * m[5] * m[10] + m[12] * m[6] * m[9];
+			// the 2x2 determinants of the first and last two columns
+			// are shared by the cofactors, which saves two thirds of
+			// the multiplications of a plain cofactor expansion
+			const float s0 = m[0] * m[5] - m[4] * m[1];
+			const float s1 = m[0] * m[6] - m[4] * m[2];
+			const float s2 = m[0] * m[7] - m[4] * m[3];
+			const float s3 = m[1] * m[6] - m[5] * m[2];
+			const float s4 = m[1] * m[7] - m[5] * m[3];
+			const float s5 = m[2] * m[7] - m[6] * m[3];
+
+			const float c5 = m[10] * m[15] - m[14] * m[11];
+			const float c4 = m[9]  * m[15] - m[13] * m[11];
+			const float c3 = m[9]  * m[14] - m[13] * m[10];
+			const float c2 = m[8]  * m[15] - m[12] * m[11];
+			const float c1 = m[8]  * m[14] - m[12] * m[10];
+			const float c0 = m[8]  * m[13] - m[12] * m[9];
+
+			const float det = s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
 
-			const float det = m[0] * inv[0] + m[1] * inv[4] + m[2] * inv[8] + m[3] * inv[12];
 			if (det == 0.0f)
 				return *this;
 
-			inv[1] = -m[1] * m[10] * m[15] + m[1] * m[11] * m[14] + m[9] * m[2] * m[15] - m[9] * m[3] * m[14] - m[13] * m[2] * m[11] + m[13] * m[3] * m[10];
-			inv[5] = m[0] * m[10] * m[15] - m[0] * m[11] * m[14] - m[8] * m[2] * m[15] + m[8] * m[3] * m[14] + m[12] * m[2] * m[11] - m[12] * m[3] * m[10];
-			inv[9] = -m[0] * m[9] * m[15] + m[0] * m[11] * m[13] + m[8] * m[1] * m[15] - m[8] * m[3] * m[13] - m[12] * m[1] * m[11] + m[12] * m[3] * m[9];
-			inv[13] = m[0] * m[9] * m[14] - m[0] * m[10] * m[13] - m[8] * m[1] * m[14] + m[8] * m[2] * m[13] + m[12] * m[1] * m[10] - m[12] * m[2] * m[9];
-			inv[2] = m[1] * m[6] * m[15] - m[1] * m[7] * m[14] - m[5] * m[2] * m[15] + m[5] * m[3] * m[14] + m[13] * m[2] * m[7] - m[13] * m[3] * m[6];
-			inv[6] = -m[0] * m[6] * m[15] + m[0] * m[7] * m[14] + m[4] * m[2] * m[15] - m[4] * m[3] * m[14] - m[12] * m[2] * m[7] + m[12] * m[3] * m[6];
-			inv[10] = m[0] * m[5] * m[15] - m[0] * m[7] * m[13] - m[4] * m[1] * m[15] + m[4] * m[3] * m[13] + m[12] * m[1] * m[7] - m[12] * m[3] * m[5];
-			inv[14] = -m[0] * m[5] * m[14] + m[0] * m[6] * m[13] + m[4] * m[1] * m[14] - m[4] * m[2] * m[13] - m[12] * m[1] * m[6] + m[12] * m[2] * m[5];
-			inv[3] = -m[1] * m[6] * m[11] + m[1] * m[7] * m[10] + m[5] * m[2] * m[11] - m[5] * m[3] * m[10] - m[9] * m[2] * m[7] + m[9] * m[3] * m[6];
-			inv[7] = m[0] * m[6] * m[11] - m[0] * m[7] * m[10] - m[4] * m[2] * m[11] + m[4] * m[3] * m[10] + m[8] * m[2] * m[7] - m[8] * m[3] * m[6];
-			inv[11] = -m[0] * m[5] * m[11] + m[0] * m[7] * m[9] + m[4] * m[1] * m[11] - m[4] * m[3] * m[9] - m[8] * m[1] * m[7] + m[8] * m[3] * m[5];
-			inv[15] = m[0] * m[5] * m[10] - m[0] * m[6] * m[9] - m[4] * m[1] * m[10] + m[4] * m[2] * m[9] + m[8] * m[1] * m[6] - m[8] * m[2] * m[5];
-			
-			const float determinant = 1.0f / det;
-			
-			float invOut[16]{};
-			std::ranges::transform(inv, invOut, [&](float value)
-			{
-				return value * determinant;
-			});
+			const float d = 1.0f / det;
 
-			return { invOut };
+			return {
+				{
+					( m[5]  * c5 - m[6]  * c4 + m[7]  * c3) * d,
+					(-m[1]  * c5 + m[2]  * c4 - m[3]  * c3) * d,
+					( m[13] * s5 - m[14] * s4 + m[15] * s3) * d,
+					(-m[9]  * s5 + m[10] * s4 - m[11] * s3) * d,
+
+					(-m[4]  * c5 + m[6]  * c2 - m[7]  * c1) * d,
+					( m[0]  * c5 - m[2]  * c2 + m[3]  * c1) * d,
+					(-m[12] * s5 + m[14] * s2 - m[15] * s1) * d,
+					( m[8]  * s5 - m[10] * s2 + m[11] * s1) * d,
+
+					( m[4]  * c4 - m[5]  * c2 + m[7]  * c0) * d,
+					(-m[0]  * c4 + m[1]  * c2 - m[3]  * c0) * d,
+					( m[12] * s4 - m[13] * s2 + m[15] * s0) * d,
+					(-m[8]  * s4 + m[9]  * s2 - m[11] * s0) * d,
+
+					(-m[4]  * c3 + m[5]  * c1 - m[6]  * c0) * d,
+					( m[0]  * c3 - m[1]  * c1 + m[2]  * c0) * d,
+					(-m[12] * s3 + m[13] * s1 - m[14] * s0) * d,
+					( m[8]  * s3 - m[9]  * s1 + m[10] * s0) * d
+				}
+			};
 		}
 
 		////////////////////////////////////////////////////////////
@@ -0,0 +1,112 @@
+﻿// 
+// TripleBuffer.hpp
+// Core
+// 
+// Created by Felix Busch on 19.10.2026.
+// Copyright © 2026 Felix Busch. All rights reserved.
+// 
+
+#pragma once
+
+#include <Core/System/Types.hpp>
+
+#include <array>
+#include <atomic>
+
+namespace Core
+{
+	////////////////////////////////////////////////////////////
+	/// \brief Wait-free handoff of the latest value from one
+	///		   producer thread to one consumer thread
+	/// 
+	///	The producer writes into its own buffer and publishes it by
+	///	swapping it with the shared middle buffer. The consumer
+	///	swaps its buffer with the middle one whenever a fresh value
+	///	has been published. Neither side ever waits for the other,
+	///	intermediate values may be skipped, and the consumer always
+	///	sees a complete value that doesn't change until its next
+	///	call to Update().
+	/// 
+	////////////////////////////////////////////////////////////
+	template<typename T>
+	class TripleBuffer
+	{
+	public:
+
+		////////////////////////////////////////////////////////////
+		/// \brief Default constructor
+		/// 
+		////////////////////////////////////////////////////////////
+		TripleBuffer():
+			buffers{},
+			back(0),
+			middle(1),
+			front(2)
+		{
+		}
+
+		TripleBuffer(const TripleBuffer&) = delete;
+		TripleBuffer& operator = (const TripleBuffer&) = delete;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Publish a value (producer thread only)
+		/// 
+		////////////////////////////////////////////////////////////
+		void Publish(const T& value)
+		{
+			buffers[back] = value;
+
+			// hand the buffer over and take whatever the consumer left in the middle
+			back = middle.exchange(back | FreshBit, std::memory_order_acq_rel) & IndexMask;
+		}
+
+		////////////////////////////////////////////////////////////
+		/// \brief Take over the latest published value (consumer
+		///		   thread only)
+		/// 
+		///	\return True if a new value has been published since
+		///			the last call
+		/// 
+		////////////////////////////////////////////////////////////
+		bool Update()
+		{
+			if((middle.load(std::memory_order_relaxed) & FreshBit) == 0)
+			{
+				return false;
+			}
+
+			front = middle.exchange(front, std::memory_order_acq_rel) & IndexMask;
+			return true;
+		}
+
+		////////////////////////////////////////////////////////////
+		/// \brief Get the value taken over by the last Update()
+		///		   (consumer thread only)
+		/// 
+		////////////////////////////////////////////////////////////
+		[[nodiscard]] const T& Get() const
+		{
+			return buffers[front];
+		}
+
+	private:
+
+		////////////////////////////////////////////////////////////
+		/// The bits of the middle index and the flag telling that
+		/// the middle buffer hasn't been read yet
+		/// 
+		////////////////////////////////////////////////////////////
+		static constexpr u8 IndexMask	= 0b011;
+		static constexpr u8 FreshBit	= 0b100;
+
+		////////////////////////////////////////////////////////////
+		/// Member data
+		/// 
+		////////////////////////////////////////////////////////////
+		std::array<T, 3>	buffers;	///< The storage of the three values
+		u8					back;		///< The buffer written by the producer
+		std::atomic<u8>		middle;		///< The buffer in transit, combined with FreshBit
+		u8					front;		///< The buffer read by the consumer
+
+	};
+}
\ No newline at end of file
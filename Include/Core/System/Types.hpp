@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 
 namespace Core
@@ -44,7 +45,7 @@ namespace Core
 	/// size type
 	/// 
 	////////////////////////////////////////////////////////////
-	using usize = size_t;
+	using usize = std::size_t;
 
 	////////////////////////////////////////////////////////////
 	/// floating point types
@@ -17,6 +17,8 @@ namespace Core
 	enum class MouseWheel
 	{
 		Vertical,	//!< The vertical mouse wheel
-		Horizontal	//!< The horizontal mouse wheel
+		Horizontal,	//!< The horizontal mouse wheel
+
+		Count		//!< The number of mouse wheels
 	};
 }
\ No newline at end of file
@@ -39,6 +39,11 @@ namespace Core
 	using WParam = uint32_t;
 	using LParam = long;
 	using LResult = long;
+#else
+	using MessageID = uint32_t;
+	using WParam = uintptr_t;
+	using LParam = intptr_t;
+	using LResult = intptr_t;
 #endif
 
 }
\ No newline at end of file
@@ -282,6 +282,15 @@ namespace Core
 		////////////////////////////////////////////////////////////
 		[[nodiscard]] WindowHandle GetWindowHandle() const;
 
+		////////////////////////////////////////////////////////////
+		/// \brief Interrupt the thread that waits for messages in
+		///		   WaitEvents()
+		///
+		///	May be called from any thread.
+		/// 
+		////////////////////////////////////////////////////////////
+		virtual void Wake() override;
+
 	private:
 
 		////////////////////////////////////////////////////////////
@@ -311,6 +320,20 @@ namespace Core
 		////////////////////////////////////////////////////////////
 		virtual void QueueEvents() override;
 
+		////////////////////////////////////////////////////////////
+		/// \brief Overwritten method to sleep until the win32 message
+		///		   queue receives input or Wake() is called
+		/// 
+		////////////////////////////////////////////////////////////
+		virtual void WaitForEvents(const Time& timeout) override;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Overwritten method to merge consecutive mouse move
+		///		   and resize events
+		/// 
+		////////////////////////////////////////////////////////////
+		virtual bool MergeEvent(WindowEvent& last, const WindowEvent& next) override;
+
 	private:
 
 		////////////////////////////////////////////////////////////
@@ -13,6 +13,8 @@
 #include <Core/Window/KeyCode.hpp>
 #include <Core/Window/Types.hpp>
 
+#include <Core/System/Time.hpp>
+
 #include <cstdint>
 
 namespace Core
@@ -31,8 +33,8 @@ namespace Core
 		{
 			WindowHandle Handle;
 			MessageID Message;
-			WParam WParam;
-			LParam LParam;
+			Core::WParam WParam;
+			Core::LParam LParam;
 		};
 
 		////////////////////////////////////////////////////////////
@@ -122,6 +124,12 @@ namespace Core
 			Generic				//!< Any event (data in WindowEvent::Any)
 		};
 
+		////////////////////////////////////////////////////////////
+		/// \brief The number of event types
+		/// 
+		////////////////////////////////////////////////////////////
+		static constexpr uint32_t TypeCount = Generic + 1;
+
 		////////////////////////////////////////////////////////////
 		/// \brief Default constructor
 		/// 
@@ -130,6 +138,8 @@ namespace Core
 
 		////////////////////////////////////////////////////////////
 		/// \brief Construct WindowEvent with its type directly
+		///
+		///	The event is stamped with Stopwatch::GetTimestamp().
 		/// 
 		////////////////////////////////////////////////////////////
 		WindowEvent(EventType type);
@@ -138,7 +148,8 @@ namespace Core
 		/// Member data
 		/// 
 		////////////////////////////////////////////////////////////
-		EventType Type;
+		EventType	Type;		//!< The type to decide which data to use
+		Time		Timestamp;	//!< When the event has been created, see Stopwatch::GetTimestamp()
 
 		////////////////////////////////////////////////////////////
 		/// \brief Event data
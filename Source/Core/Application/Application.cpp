@@ -11,8 +11,12 @@
 
 #include <Core/System/FinalAction.hpp>
 #include <Core/System/Error.hpp>
-#include <Core/System/Sleep.hpp>
+#include <Core/System/Jobs.hpp>
+#include <Core/System/Profiler.hpp>
 
+#include <Core/Graphics/Animatable.hpp>
+
+#include <algorithm>
 #include <thread>
 
 namespace Core
@@ -30,16 +34,47 @@ namespace Core
 	////////////////////////////////////////////////////////////
 	Application* Application::Instance = nullptr;
 
+	////////////////////////////////////////////////////////////
+	/// \brief The number of events the render thread can lag behind
+	/// 
+	////////////////////////////////////////////////////////////
+	inline static constexpr usize RenderEventCapacity = 4096;
+
+	////////////////////////////////////////////////////////////
+	/// \brief How long the main thread waits for a free slot
+	///		   before an event is dropped
+	/// 
+	////////////////////////////////////////////////////////////
+	inline static constexpr Time MaxEventBackOff = Milliseconds(100);
+
 	////////////////////////////////////////////////////////////
 	Application::Application():
 		IsRendering(false),
 		AutoCloseEnabled(true),
+		LoopEnabled(true),
+		RedrawRequested(true),
+		RenderThreadSleeping(false),
 		TargetFps(60),
+		TickRate(60),
+		MaxUpdatesPerFrame(8),
+		UpdateAccumulator(Time::Zero),
+		InterpolationAlpha(0.0f),
+		DroppedUpdates(0),
 		FramesPerSecond(0),
 		FrameCount(0),
 		FpsTime(Time::Zero),
-		FrameTimer(Stopwatch::StartNew())
+		EventTimeout(Milliseconds(250)),
+		RenderEvents(RenderEventCapacity),
+		DroppedEvents(0),
+		GenericEventsEnabled(false),
+		PipelineEnabled(false),
+		Pipeline(Graphics),
+		OverlayEnabled(false),
+		WorkerCount(0),
+		WorkerCountChanged(false)
 	{
+		FrameEvents.reserve(RenderEventCapacity);
+		SubmittedEvents.reserve(RenderEventCapacity);
 	}
 
 	////////////////////////////////////////////////////////////
@@ -55,15 +90,39 @@ namespace Core
 		const FinalAction windowDeletion = [&] { Window.Destroy(); };
 		GlobalUpdatingService globals;
 
-		Window.AddEventListener(globals);
-		Window.AddEventListener(*this);
+		// shared by the sketch and the engine, stopped after the sketch was destroyed
+		Jobs::Start(WorkerCount);
+		const FinalAction jobsShutdown = [] { Jobs::Stop(); };
+
+		// raw win32 messages are only forwarded while the sketch asks for them, so the window doesn't have to produce them otherwise
+		constexpr EventMask DefaultEvents = Window::AllEvents & ~Window::MaskOf(WindowEvent::Generic);
+		bool genericEvents = GenericEventsEnabled;
+
+		Window.AddEventListener(globals, Window::MaskOf(WindowEvent::Resized) | Window::MaskOf(WindowEvent::MouseMoved));
+		Window.AddEventListener(*this, genericEvents ? Window::AllEvents : DefaultEvents);
+
+		CORE_PROFILE_THREAD("Main Thread");
 
 		IsRendering = true;
 		std::thread renderThread(&Application::RenderThreadImpl, this);
 
 		while(IsRendering)
 		{
-			// queue up & dispatch the events
+			// sleep until messages arrive or Exit() wakes us up
+			Window.WaitEvents(EventTimeout);
+
+			// follow SetGenericEventsEnabled(), the subscriptions belong to this thread
+			if(const bool enabled = GenericEventsEnabled; enabled != genericEvents)
+			{
+				Window.RemoveEventListener(*this);
+				Window.AddEventListener(*this, enabled ? Window::AllEvents : DefaultEvents);
+				genericEvents = enabled;
+			}
+
+			// follow SetJobWorkerCount(), the workers belong to this thread
+			RestartJobs();
+
+			// dispatch the queued events
 			Window.DispatchEvents();
 		}
 
@@ -71,17 +130,85 @@ namespace Core
 		{
 			renderThread.join();
 		}
+
+		// write the trace of a session the sketch didn't stop
+		Profiler::Stop();
+
+		// remove all event listeners
+		Window.RemoveAllEventListeners();
+	}
+
+	////////////////////////////////////////////////////////////
+	bool Application::StartBenchmark(const Benchmark::Options& options)
+	{
+		CORE_PROFILE_THREAD("Benchmark Thread");
+
+		Jobs::Start(WorkerCount);
+		const FinalAction jobsShutdown = [] { Jobs::Stop(); };
+
+		if(!Graphics.CreateOffscreen(options.Width, options.Height))
+		{
+			return false;
+		}
+		const FinalAction graphicsDeletion = [&] { Graphics.Destroy(); };
+
+		if(Sketch.reset(CreateSketch()); !Sketch)
+		{
+			Err() << "CreateSketch() returned nullptr" << std::endl;
+			return false;
+		}
+		const FinalAction sketchDeletion = [&] { Sketch.reset(); };
+
+		IsRendering = true;
+		const bool completed = Benchmark::Run(options, *Sketch, Input, *this);
+		IsRendering = false;
+
+		return completed;
 	}
 
 	////////////////////////////////////////////////////////////
 	void Application::Exit()
 	{
 		IsRendering = false;
+
+		// interrupt the main thread if it is waiting for messages
+		Window.Wake();
+
+		// and the rendering thread if it is waiting for a redraw
+		WakeRenderThread();
+	}
+
+	////////////////////////////////////////////////////////////
+	void Application::Redraw()
+	{
+		RedrawRequested = true;
+		WakeRenderThread();
 	}
 
 	////////////////////////////////////////////////////////////
 	void Application::OnEvent(const WindowEvent& event)
 	{
+		// hand the event over to the render thread
+		if(!RenderEvents.TryPush(event))
+		{
+			// back off until the render thread catches up, but don't stall the message loop forever
+			const Stopwatch backOff = Stopwatch::StartNew();
+
+			while(!RenderEvents.TryPush(event))
+			{
+				if(!IsRendering || backOff.GetElapsedTime() >= MaxEventBackOff)
+				{
+					++DroppedEvents;
+					break;
+				}
+
+				std::this_thread::yield();
+			}
+		}
+
+		// input always produces a frame in NoLoop mode
+		WakeRenderThread();
+
 		if (!AutoCloseEnabled)
 			return;
 
@@ -96,10 +223,12 @@ namespace Core
 	////////////////////////////////////////////////////////////
 	void Application::RenderThreadImpl()
 	{
+		CORE_PROFILE_THREAD("Render Thread");
+
 		// initialize the graphics
 		if(!Graphics.Create(Window))
 		{
-			IsRendering = false;
+			Exit();
 			return;
 		}
 		const FinalAction graphicsDeletion = [&] { Graphics.Destroy(); };
@@ -108,55 +237,323 @@ namespace Core
 		if(Sketch.reset(CreateSketch()); !Sketch)
 		{
 			Err() << "CreateSketch() returned nullptr" << std::endl;
-			IsRendering = false;
+			Exit();
 			return;
 		}
 
 		const FinalAction sketchDeletion = [&] { Sketch.reset(); };
 
 
-		// add event listeners
-		Window.AddEventListener(Graphics);
-		Window.AddEventListener(*Sketch);
-		
 		// load assets
 		if(!Sketch->OnPreload())
 		{
 			Err() << "OnPreload() returned false";
-			IsRendering = false;
+			Exit();
 			return;
 		}
 
 		Sketch->OnSetup();
 
+		// from here on the sketch records, a separate thread submits
+		if(PipelineEnabled)
+		{
+			Pipeline.Start();
+		}
+
 		// start game timer
 		Stopwatch gameTimer = Stopwatch::StartNew();
+		Pacer.Reset();
 
 		while (IsRendering)
 		{
+			// in NoLoop mode the time spent idle is not part of the frame
+			if(!LoopEnabled && WaitForRedraw())
+			{
+				gameTimer.Restart();
+				Pacer.Reset();
+			}
+
+			CORE_PROFILE_SCOPE("Frame");
+
 			const Time deltaTime = gameTimer.Restart();
+			const Stopwatch frameTimer = Stopwatch::StartNew();
+			FrameStatistics::Sample sample = {};
+
+			// resources created in OnUpdate() count towards this frame as well
+			Graphics.ResetRenderStats();
+
+			// deliver the input that arrived since the last frame
+			DispatchRenderEvents();
+
+			// capture the frame for a later replay
+			if(Recorder.IsOpen())
+			{
+				Recorder.WriteFrame(deltaTime, FrameEvents);
+			}
+
+			// advance the simulation in fixed steps
+			RunFixedUpdates(deltaTime);
+
+			if(Pipeline.IsRunning())
+			{
+				// record user data while the previous frame is submitted
+				Pipeline.BeginFrame();
+				const Stopwatch drawTimer = Stopwatch::StartNew();
+				DrawSketch(deltaTime);
+				sample.DrawTime = drawTimer.GetElapsedTime();
+
+				const Stopwatch endDrawTimer = Stopwatch::StartNew();
+				bool submitted;
+				{
+					CORE_PROFILE_SCOPE("EndFrame");
+					submitted = Pipeline.EndFrame();
+				}
 
-			if (Graphics.BeginDraw())
+				if(!submitted)
+				{
+					Exit();
+					break;
+				}
+
+				sample.EndDrawTime = endDrawTimer.GetElapsedTime();
+
+				// the previous frame has been presented by now
+				if(const std::optional<Time>& presented = Pipeline.GetPresentTimestamp())
+				{
+					RecordPresentLatency(SubmittedEvents, *presented);
+				}
+
+				std::swap(FrameEvents, SubmittedEvents);
+			}
+			else if (Graphics.BeginDraw())
 			{
 				// render user data
-				Sketch->OnDraw(deltaTime.ToSeconds<float>());
+				const Stopwatch drawTimer = Stopwatch::StartNew();
+				DrawSketch(deltaTime);
+				sample.DrawTime = drawTimer.GetElapsedTime();
+
+				const Stopwatch endDrawTimer = Stopwatch::StartNew();
+				bool presented;
+				{
+					CORE_PROFILE_SCOPE("EndDraw");
+					presented = Graphics.EndDraw();
+				}
 
-				if(!Graphics.EndDraw())
+				if(!presented)
 				{
-					IsRendering = false;
+					Exit();
 					break;
 				}
+
+				sample.EndDrawTime = endDrawTimer.GetElapsedTime();
+
+				RecordPresentLatency(FrameEvents, Stopwatch::GetTimestamp());
 			}
-			
+
+			sample.FrameTime = frameTimer.GetElapsedTime();
+
+			const Stopwatch sleepTimer = Stopwatch::StartNew();
 			HandleFps(deltaTime);
+			sample.SleepTime = sleepTimer.GetElapsedTime();
+
+			Statistics.Record(sample);
 		}
 
+		// present the frame in flight
+		Pipeline.Stop();
+
 		Sketch->OnDestroy();
+		Recorder.Close();
+	}
 
-		// remove all event listeners
-		Window.RemoveAllEventListeners();
+	////////////////////////////////////////////////////////////
+	void Application::DispatchRenderEvents()
+	{
+		CORE_PROFILE_FUNCTION();
+
+		WindowEvent event;
+
+		// all events seen from here on are consumed by this frame
+		const Time frameStart = Stopwatch::GetTimestamp();
+		FrameEvents.clear();
+
+		// the edges of the input snapshot only cover this frame
+		Input.BeginFrame();
+
+		while(RenderEvents.TryPop(event))
+		{
+			InputLatency.Record(frameStart - event.Timestamp);
+			FrameEvents.push_back(event);
+
+			Input.OnEvent(event);
+			Graphics.OnEvent(event);
+			Sketch->OnEvent(event);
+		}
+
+		// take over the globals written by the main thread
+		GlobalUpdatingService::Latch();
+	}
+
+	////////////////////////////////////////////////////////////
+	bool Application::WaitForRedraw()
+	{
+		const auto hasWork = [this]
+		{
+			return !IsRendering || LoopEnabled || RedrawRequested || !RenderEvents.IsEmpty() || AnimationCounter::GetCount() != 0;
+		};
+
+		std::unique_lock lock(RedrawMutex);
+
+		// announce the sleep before looking for work, pairs with the fence in WakeRenderThread()
+		RenderThreadSleeping.store(true, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+
+		const bool mustSleep = !hasWork();
+
+		if(mustSleep)
+		{
+			RedrawCondition.wait(lock, hasWork);
+		}
+
+		RenderThreadSleeping.store(false, std::memory_order_relaxed);
+		RedrawRequested = false;
+		return mustSleep;
+	}
+
+	////////////////////////////////////////////////////////////
+	void Application::DrawSketch(const Time& deltaTime)
+	{
+		{
+			CORE_PROFILE_SCOPE("OnDraw");
+			Sketch->OnDraw(deltaTime.ToSeconds<float>());
+		}
+
+		{
+			CORE_PROFILE_SCOPE("OnDrawGui");
+			Sketch->OnDrawGui();
+		}
+
+		// on top of everything, with the numbers of the finished frames
+		if(OverlayEnabled)
+		{
+			Overlay.Draw(Graphics, Statistics, Graphics.GetPreviousRenderStats(), FramesPerSecond);
+		}
+	}
+
+	////////////////////////////////////////////////////////////
+	void Application::RunFixedUpdates(const Time& deltaTime)
+	{
+		if(TickRate == 0)
+		{
+			InterpolationAlpha = 0.0f;
+			return;
+		}
+
+		const Time tick = Seconds(1.0 / (double)TickRate);
+		const float fixedDelta = tick.ToSeconds<float>();
+
+		UpdateAccumulator = UpdateAccumulator + deltaTime;
+
+		for(u32 updates = 0; UpdateAccumulator >= tick; ++updates)
+		{
+			if(updates == MaxUpdatesPerFrame)
+			{
+				// spiral of death: drop the whole ticks, keep the fraction
+				const i64 backlog = UpdateAccumulator.ToNanoseconds<i64>();
+				const i64 tickLength = tick.ToNanoseconds<i64>();
+
+				DroppedUpdates += (u64)(backlog / tickLength);
+				UpdateAccumulator = Nanoseconds(backlog % tickLength);
+				break;
+			}
+
+			CORE_PROFILE_SCOPE("OnUpdate");
+			Sketch->OnUpdate(fixedDelta);
+			UpdateAccumulator = UpdateAccumulator - tick;
+		}
+
+		InterpolationAlpha = UpdateAccumulator.ToSeconds<float>() / fixedDelta;
+	}
+
+	////////////////////////////////////////////////////////////
+	void Application::WakeRenderThread()
+	{
+		// either the work published by the caller is seen by the rendering thread before
+		// it sleeps, or the sleep is seen here, so a thread that is awake needs nothing
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		if(!RenderThreadSleeping.load(std::memory_order_relaxed))
+		{
+			return;
+		}
+
+		// taking the lock orders the notification after the predicate check of the sleeping thread
+		{
+			std::lock_guard lock(RedrawMutex);
+		}
+
+		RedrawCondition.notify_one();
+	}
+
+	////////////////////////////////////////////////////////////
+	void Application::RecordPresentLatency(const std::vector<WindowEvent>& events, const Time& presented)
+	{
+		for(const WindowEvent& event : events)
+		{
+			PresentLatency.Record(presented - event.Timestamp);
+		}
+	}
+
+	////////////////////////////////////////////////////////////
+	void Application::RestartJobs()
+	{
+		if(!WorkerCountChanged.exchange(false))
+			return;
+
+		// waits for the jobs in flight, jobs submitted meanwhile run on the submitting thread
+		Jobs::Stop();
+		Jobs::Start(WorkerCount);
+	}
+
+	////////////////////////////////////////////////////////////
+	void Application::BeginFrame()
+	{
+		// the sketch runs on this thread, so a new worker count takes effect with the next frame
+		RestartJobs();
+
+		Graphics.ResetRenderStats();
+	}
+
+	////////////////////////////////////////////////////////////
+	void Application::Update(const Time& deltaTime)
+	{
+		RunFixedUpdates(deltaTime);
+	}
+
+	////////////////////////////////////////////////////////////
+	bool Application::BeginDraw()
+	{
+		return IsRendering && Graphics.BeginDraw();
+	}
+
+	////////////////////////////////////////////////////////////
+	void Application::Draw(const Time& deltaTime)
+	{
+		DrawSketch(deltaTime);
 	}
 
+	////////////////////////////////////////////////////////////
+	bool Application::EndDraw()
+	{
+		return Graphics.EndDraw();
+	}
+
+	////////////////////////////////////////////////////////////
+	const RenderStats& Application::GetRenderStats() const
+	{
+		return Graphics.GetRenderStats();
+	}
+
+	////////////////////////////////////////////////////////////
 	void Application::HandleFps(const Time& deltaTime)
 	{
 		++FrameCount;
@@ -172,13 +569,17 @@ namespace Core
 
 		if(TargetFps != 0)
 		{
-			const Time limitTime = Seconds(1.0f / (float)TargetFps);
-			const Time sleepDuration = limitTime - FrameTimer.GetElapsedTime();
-			
-			// sleep for the given duration
-			Sleep::Perform(sleepDuration);
+			const Time limitTime = Seconds(1.0 / (double)TargetFps);
+
+			// pick up changes of the frame rate limit
+			if(Pacer.GetInterval() != limitTime)
+			{
+				Pacer.SetInterval(limitTime);
+				Statistics.SetBudget(limitTime);
+			}
 
-			FrameTimer.Restart();
+			// wait for the end of the frame slot
+			Pacer.Wait();
 		}
 	}
 }
@@ -0,0 +1,389 @@
+﻿// 
+// Benchmark.cpp
+// Core
+// 
+// Created by Felix Busch on 19.10.2026.
+// Copyright © 2026 Felix Busch. All rights reserved.
+// 
+
+#include <Core/Application/Benchmark.hpp>
+#include <Core/Application/Globals.hpp>
+#include <Core/Application/Input.hpp>
+#include <Core/Application/InputReplay.hpp>
+#include <Core/Application/Sketch.hpp>
+
+#include <Core/System/Error.hpp>
+#include <Core/System/Profiler.hpp>
+#include <Core/System/Stopwatch.hpp>
+
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <numbers>
+#include <string_view>
+
+namespace Core
+{
+	////////////////////////////////////////////////////////////
+	/// \brief The period of the mouse clicks, presses and wheel
+	///		   scrolls of the synthetic input in frames
+	/// 
+	////////////////////////////////////////////////////////////
+	inline static constexpr u32 ClickInterval	= 30;
+	inline static constexpr u32 KeyInterval		= 90;
+	inline static constexpr u32 ScrollInterval	= 45;
+
+	////////////////////////////////////////////////////////////
+	/// \brief Parse a whole argument as a number
+	/// 
+	////////////////////////////////////////////////////////////
+	template<typename T>
+	static bool ParseNumber(std::string_view text, T& value)
+	{
+		const auto [end, error] = std::from_chars(text.data(), text.data() + text.size(), value);
+		return error == std::errc() && end == text.data() + text.size();
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Scramble the seed and the frame into a random
+	///		   number (xorshift)
+	/// 
+	////////////////////////////////////////////////////////////
+	static u32 Scramble(u32 seed, u32 frame)
+	{
+		u32 x = seed * 0x9E3779B9u ^ (frame + 1) * 0x85EBCA6Bu;
+		x ^= x << 13;
+		x ^= x >> 17;
+		x ^= x << 5;
+		return x;
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Get the position of the synthetic mouse
+	/// 
+	////////////////////////////////////////////////////////////
+	static void GetMousePosition(u32 frame, const Benchmark::Options& options, i32& x, i32& y)
+	{
+		const double t = (double)frame / 120.0 * std::numbers::pi;
+		const double halfWidth = (double)options.Width * 0.5;
+		const double halfHeight = (double)options.Height * 0.5;
+
+		// a few pixels of jitter, so hover tests don't see the same path each lap
+		const u32 jitter = Scramble(options.Seed, frame);
+
+		x = (i32)(halfWidth + std::sin(3.0 * t) * halfWidth * 0.9) + (i32)(jitter & 7) - 3;
+		y = (i32)(halfHeight + std::sin(2.0 * t) * halfHeight * 0.9) + (i32)((jitter >> 3) & 7) - 3;
+	}
+
+	////////////////////////////////////////////////////////////
+	bool Benchmark::IsRequested(int argc, char* argv[])
+	{
+		for(int i = 1; i < argc; ++i)
+		{
+			if(std::strcmp(argv[i], "--benchmark") == 0)
+			{
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	////////////////////////////////////////////////////////////
+	bool Benchmark::ParseArguments(int argc, char* argv[], Options& options)
+	{
+		for(int i = 1; i < argc; ++i)
+		{
+			const std::string_view argument = argv[i];
+
+			if(argument == "--benchmark")
+			{
+				continue;
+			}
+
+			if(i + 1 >= argc)
+			{
+				Err() << "Missing value for benchmark argument " << argument << std::endl;
+				return false;
+			}
+
+			const std::string_view value = argv[++i];
+			bool valid = true;
+
+			if(argument == "--frames")
+			{
+				valid = ParseNumber(value, options.FrameCount) && options.FrameCount != 0;
+			}
+			else if(argument == "--warmup")
+			{
+				valid = ParseNumber(value, options.WarmupFrames);
+			}
+			else if(argument == "--size")
+			{
+				const usize separator = value.find('x');
+				valid = separator != std::string_view::npos
+					&& ParseNumber(value.substr(0, separator), options.Width)
+					&& ParseNumber(value.substr(separator + 1), options.Height)
+					&& options.Width != 0 && options.Height != 0;
+			}
+			else if(argument == "--delta-ms")
+			{
+				double milliseconds = 0.0;
+				valid = ParseNumber(value, milliseconds) && milliseconds > 0.0;
+				options.FixedDelta = Microseconds((i64)(milliseconds * 1000.0));
+			}
+			else if(argument == "--seed")
+			{
+				valid = ParseNumber(value, options.Seed);
+			}
+			else if(argument == "--input")
+			{
+				options.InputPath = value;
+			}
+			else if(argument == "--output")
+			{
+				options.OutputPath = value;
+			}
+			else
+			{
+				Err() << "Unknown benchmark argument " << argument << std::endl;
+				return false;
+			}
+
+			if(!valid)
+			{
+				Err() << "Invalid value '" << value << "' for benchmark argument " << argument << std::endl;
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	////////////////////////////////////////////////////////////
+	void Benchmark::GenerateEvents(u32 frame, const Options& options, std::vector<WindowEvent>& events)
+	{
+		events.clear();
+
+		i32 mouseX, mouseY;
+		GetMousePosition(frame, options, mouseX, mouseY);
+
+		WindowEvent move(WindowEvent::MouseMoved);
+		move.MouseMove = { mouseX, mouseY };
+		events.push_back(move);
+
+		// click and release two frames later
+		if(const u32 phase = frame % ClickInterval; phase == 0 || phase == 2)
+		{
+			WindowEvent click(phase == 0 ? WindowEvent::MousePressed : WindowEvent::MouseReleased);
+			click.MouseButton = { MouseButton::Left, mouseX, mouseY };
+			events.push_back(click);
+		}
+
+		// press and release three frames later
+		if(const u32 phase = frame % KeyInterval; phase == 0 || phase == 3)
+		{
+			WindowEvent key(phase == 0 ? WindowEvent::KeyPressed : WindowEvent::KeyReleased);
+			key.Key = { KeyCode::Space, false, false, false, false };
+			events.push_back(key);
+		}
+
+		if(frame % ScrollInterval == 0)
+		{
+			WindowEvent scroll(WindowEvent::MouseWheelScrolled);
+			scroll.MouseWheel = { MouseWheel::Vertical, (Scramble(options.Seed, frame) & 1) ? 1.0f : -1.0f, mouseX, mouseY };
+			events.push_back(scroll);
+		}
+	}
+
+	////////////////////////////////////////////////////////////
+	bool Benchmark::WriteReport(const Options& options, const FrameStatistics& statistics, const RenderStats& total, const RenderStats& peak, u64 eventCount)
+	{
+		std::ofstream file;
+
+		if(!options.OutputPath.empty())
+		{
+			file.open(options.OutputPath);
+			if(!file)
+			{
+				Err() << "Failed to open benchmark report " << options.OutputPath << std::endl;
+				return false;
+			}
+		}
+
+		std::ostream& out = file.is_open() ? (std::ostream&)file : std::cout;
+		const usize frames = statistics.GetSize();
+
+		const auto writeTiming = [&](const char* name, FrameStatistics::Metric metric)
+		{
+			const FrameStatistics::Summary summary = statistics.GetSummary(metric, frames);
+
+			out << "  \"" << name << "\": {"
+				<< "\"min\": " << summary.Min.ToMilliseconds<double>()
+				<< ", \"mean\": " << summary.Mean.ToMilliseconds<double>()
+				<< ", \"p50\": " << summary.P50.ToMilliseconds<double>()
+				<< ", \"p95\": " << summary.P95.ToMilliseconds<double>()
+				<< ", \"p99\": " << summary.P99.ToMilliseconds<double>()
+				<< ", \"max\": " << summary.Max.ToMilliseconds<double>()
+				<< "},\n";
+		};
+
+		const auto writeCounter = [&](const char* name, u64 sum, u64 max, bool last = false)
+		{
+			out << "    \"" << name << "\": {\"mean\": " << (frames != 0 ? (double)sum / (double)frames : 0.0) << ", \"max\": " << max << "}" << (last ? "\n" : ",\n");
+		};
+
+		out << std::fixed << std::setprecision(4)
+			<< "{\n"
+			<< "  \"frames\": " << frames << ",\n"
+			<< "  \"warmupFrames\": " << options.WarmupFrames << ",\n"
+			<< "  \"fixedDeltaMs\": " << options.FixedDelta.ToMilliseconds<double>() << ",\n"
+			<< "  \"width\": " << options.Width << ",\n"
+			<< "  \"height\": " << options.Height << ",\n"
+			<< "  \"events\": " << eventCount << ",\n";
+
+		writeTiming("frameTime", FrameStatistics::Frame);
+		writeTiming("drawTime", FrameStatistics::Draw);
+		writeTiming("endDrawTime", FrameStatistics::EndDraw);
+
+		out << "  \"renderStats\": {\n";
+		writeCounter("clears", total.Clears, peak.Clears);
+		writeCounter("rectangles", total.Rectangles, peak.Rectangles);
+		writeCounter("ellipses", total.Ellipses, peak.Ellipses);
+		writeCounter("lines", total.Lines, peak.Lines);
+		writeCounter("geometries", total.Geometries, peak.Geometries);
+		writeCounter("bitmaps", total.Bitmaps, peak.Bitmaps);
+		writeCounter("transformChanges", total.TransformChanges, peak.TransformChanges);
+		writeCounter("brushCreations", total.BrushCreations, peak.BrushCreations);
+		writeCounter("strokeStyleCreations", total.StrokeStyleCreations, peak.StrokeStyleCreations);
+		writeCounter("pathGeometryCreations", total.PathGeometryCreations, peak.PathGeometryCreations);
+		writeCounter("culledPrimitives", total.CulledPrimitives, peak.CulledPrimitives);
+		writeCounter("uploadedBytes", total.UploadedBytes, peak.UploadedBytes, true);
+		out << "  }\n"
+			<< "}\n";
+
+		out.flush();
+		return (bool)out;
+	}
+
+	////////////////////////////////////////////////////////////
+	bool Benchmark::Run(const Options& options, Sketch& sketch, Input& input, Host& host)
+	{
+		InputReplay replay;
+		const bool replaying = !options.InputPath.empty();
+
+		if(replaying && !replay.Open(options.InputPath))
+		{
+			return false;
+		}
+
+		if(!sketch.OnPreload())
+		{
+			Err() << "OnPreload() returned false" << std::endl;
+			return false;
+		}
+
+		sketch.OnSetup();
+
+		// the globals are only written here, there is no main thread to race with
+		GlobalUpdatingService globals;
+		WindowEvent resize(WindowEvent::Resized);
+		resize.Size = { options.Width, options.Height };
+		globals.OnEvent(resize);
+
+		FrameStatistics statistics(options.FrameCount);
+		RenderStats total, peak;
+		u64 eventCount = 0;
+		Time recordedDelta;
+		std::vector<WindowEvent> events;
+
+		for(u32 frame = 0; frame < options.WarmupFrames + options.FrameCount; ++frame)
+		{
+			CORE_PROFILE_SCOPE("Frame");
+
+			const Stopwatch frameTimer = Stopwatch::StartNew();
+			FrameStatistics::Sample sample = {};
+
+			host.BeginFrame();
+
+			// a recording ends early, the synthetic input never does
+			if(replaying)
+			{
+				if(!replay.ReadFrame(recordedDelta, events))
+				{
+					break;
+				}
+			}
+			else
+			{
+				GenerateEvents(frame, options, events);
+			}
+
+			input.BeginFrame();
+
+			for(const WindowEvent& event : events)
+			{
+				globals.OnEvent(event);
+				input.OnEvent(event);
+				sketch.OnEvent(event);
+			}
+
+			GlobalUpdatingService::Latch();
+
+			host.Update(options.FixedDelta);
+
+			if(!host.BeginDraw())
+			{
+				break;
+			}
+
+			const Stopwatch drawTimer = Stopwatch::StartNew();
+			host.Draw(options.FixedDelta);
+			sample.DrawTime = drawTimer.GetElapsedTime();
+
+			const Stopwatch endDrawTimer = Stopwatch::StartNew();
+			if(!host.EndDraw())
+			{
+				break;
+			}
+			sample.EndDrawTime = endDrawTimer.GetElapsedTime();
+			sample.FrameTime = frameTimer.GetElapsedTime();
+
+			if(frame < options.WarmupFrames)
+			{
+				continue;
+			}
+
+			statistics.Record(sample);
+			eventCount += events.size();
+
+			const RenderStats& stats = host.GetRenderStats();
+			const auto accumulate = [](auto& sum, auto& max, auto value)
+			{
+				sum += value;
+				max = std::max(max, value);
+			};
+
+			accumulate(total.Clears, peak.Clears, stats.Clears);
+			accumulate(total.Rectangles, peak.Rectangles, stats.Rectangles);
+			accumulate(total.Ellipses, peak.Ellipses, stats.Ellipses);
+			accumulate(total.Lines, peak.Lines, stats.Lines);
+			accumulate(total.Geometries, peak.Geometries, stats.Geometries);
+			accumulate(total.Bitmaps, peak.Bitmaps, stats.Bitmaps);
+			accumulate(total.TransformChanges, peak.TransformChanges, stats.TransformChanges);
+			accumulate(total.BrushCreations, peak.BrushCreations, stats.BrushCreations);
+			accumulate(total.StrokeStyleCreations, peak.StrokeStyleCreations, stats.StrokeStyleCreations);
+			accumulate(total.PathGeometryCreations, peak.PathGeometryCreations, stats.PathGeometryCreations);
+			accumulate(total.CulledPrimitives, peak.CulledPrimitives, stats.CulledPrimitives);
+			accumulate(total.UploadedBytes, peak.UploadedBytes, stats.UploadedBytes);
+		}
+
+		sketch.OnDestroy();
+
+		return WriteReport(options, statistics, total, peak, eventCount);
+	}
+}
\ No newline at end of file
@@ -16,6 +16,7 @@
 #include <stb/stb_image.h>
 
 #include <Core/Application/Application.hpp>
+#include <Core/Application/Benchmark.hpp>
 #include <Core/Window/Dpi.hpp>
 #include <Core/Application/Factories.hpp>
 
@@ -40,8 +41,17 @@ void DisableConsoleCloseButton()
 /// \brief Entry point
 /// 
 ////////////////////////////////////////////////////////////
-int main([[maybe_unused]] int argc, [[maybe_unused]] char* argv[])
+int main(int argc, char* argv[])
 {
+	// read the benchmark settings before anything is created
+	Core::Benchmark::Options benchmarkOptions;
+	const bool benchmark = Core::Benchmark::IsRequested(argc, argv);
+
+	if(benchmark && !Core::Benchmark::ParseArguments(argc, argv, benchmarkOptions))
+	{
+		return EXIT_FAILURE;
+	}
+
 	// Initialize the factories and COM-interface
 	if(!Core::Factories::Setup())
 	{
@@ -53,16 +63,25 @@ int main([[maybe_unused]] int argc, [[maybe_unused]] char* argv[])
 	DisableConsoleCloseButton();
 
 	// we don't really care about the configuration of the dpi scale
-	[[maybe_unused]] const bool success = Core::Dpi::ConfigureDpi();
+	[[maybe_unused]] const bool dpiConfigured = Core::Dpi::ConfigureDpi();
 	
+	bool success = true;
+
 	// create application
 	if(auto* app = new(std::nothrow) Core::Application())
 	{
 		// link app instance
 		Core::Application::Instance = app;
 
-		// start the application
-		app->Start();
+		// start the application, or run the sketch headless
+		if(benchmark)
+		{
+			success = app->StartBenchmark(benchmarkOptions);
+		}
+		else
+		{
+			app->Start();
+		}
 
 		// cleanup
 		delete app;
@@ -71,5 +90,5 @@ int main([[maybe_unused]] int argc, [[maybe_unused]] char* argv[])
 	// release the factory handles
 	Core::Factories::Cleanup();
 	
-	return EXIT_SUCCESS;
+	return success ? EXIT_SUCCESS : EXIT_FAILURE;
 }
\ No newline at end of file
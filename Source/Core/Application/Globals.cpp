@@ -8,10 +8,28 @@
 
 #include <Core/Application/Globals.hpp>
 
+#include <Core/System/TripleBuffer.hpp>
+
 namespace Core
 {
 	namespace Internal
 	{
+		////////////////////////////////////////////////////////////
+		/// \brief The values written by the main thread
+		/// 
+		////////////////////////////////////////////////////////////
+		struct Snapshot
+		{
+			i32 Width	= 0;
+			i32 Height	= 0;
+			i32 MouseX	= 0;
+			i32 MouseY	= 0;
+		};
+
+		static Snapshot current;					// owned by the main thread
+		static TripleBuffer<Snapshot> snapshots;	// main thread -> rendering thread
+
+		// owned by the rendering thread
 		static i32 width = 0;
 		static i32 height = 0;
 		static i32 mouseX = 0;
@@ -37,21 +55,40 @@ namespace Core
 			// the window has been resized
 			case WindowEvent::Resized:
 			{
-				width  = (i32)event.Size.Width;
-				height = (i32)event.Size.Height;
+				current.Width  = (i32)event.Size.Width;
+				current.Height = (i32)event.Size.Height;
 			} break;
 
 			// the mouse has been moved
 			case WindowEvent::MouseMoved:
 			{
-				pMouseX = mouseX;
-				pMouseY = mouseY;
-				mouseX = event.MouseMove.MouseX;
-				mouseY = event.MouseMove.MouseY;
+				current.MouseX = event.MouseMove.MouseX;
+				current.MouseY = event.MouseMove.MouseY;
 			} break;
 
 			default:
-				break;
+				return;
+		}
+
+		Internal::snapshots.Publish(Internal::current);
+	}
+
+	////////////////////////////////////////////////////////////
+	void GlobalUpdatingService::Latch()
+	{
+		using namespace Internal;
+
+		// the previous values are the ones of the last frame
+		pMouseX = mouseX;
+		pMouseY = mouseY;
+
+		if(snapshots.Update())
+		{
+			const Snapshot& snapshot = snapshots.Get();
+			width  = snapshot.Width;
+			height = snapshot.Height;
+			mouseX = snapshot.MouseX;
+			mouseY = snapshot.MouseY;
 		}
 	}
 
@@ -0,0 +1,188 @@
+﻿// 
+// Input.cpp
+// Core
+// 
+// Created by Felix Busch on 19.10.2026.
+// Copyright © 2026 Felix Busch. All rights reserved.
+// 
+
+#include <Core/Application/Input.hpp>
+
+namespace Core
+{
+	////////////////////////////////////////////////////////////
+	Input::Input():
+		buttonsDown(0),
+		buttonsPressed(0),
+		buttonsReleased(0),
+		wheelDeltas{},
+		hasMousePosition(false)
+	{
+	}
+
+	////////////////////////////////////////////////////////////
+	void Input::BeginFrame()
+	{
+		keysPressed.reset();
+		keysReleased.reset();
+		buttonsPressed = 0;
+		buttonsReleased = 0;
+		wheelDeltas = {};
+		mouseDelta = Int2(0, 0);
+	}
+
+	////////////////////////////////////////////////////////////
+	void Input::OnEvent(const WindowEvent& event)
+	{
+		switch(event.Type)
+		{
+			case WindowEvent::KeyPressed:
+			{
+				const usize index = GetKeyIndex(event.Key.Code);
+				if(index == 0)
+					break;
+
+				// repeated presses don't produce a new edge
+				keysPressed[index] = keysPressed[index] || !keysDown[index];
+				keysDown[index] = true;
+			} break;
+
+			case WindowEvent::KeyReleased:
+			{
+				const usize index = GetKeyIndex(event.Key.Code);
+				if(index == 0)
+					break;
+
+				keysDown[index] = false;
+				keysReleased[index] = true;
+			} break;
+
+			case WindowEvent::MousePressed:
+			{
+				const u32 mask = GetButtonMask(event.MouseButton.Button);
+				buttonsPressed |= mask & ~buttonsDown;
+				buttonsDown |= mask;
+			} break;
+
+			case WindowEvent::MouseReleased:
+			{
+				const u32 mask = GetButtonMask(event.MouseButton.Button);
+				buttonsDown &= ~mask;
+				buttonsReleased |= mask;
+			} break;
+
+			case WindowEvent::MouseWheelScrolled:
+			{
+				const usize index = (usize)event.MouseWheel.Wheel;
+				if(index >= wheelDeltas.size())
+					break;
+
+				wheelDeltas[index] += event.MouseWheel.Delta;
+			} break;
+
+			case WindowEvent::MouseMoved:
+			{
+				const Int2 position(event.MouseMove.MouseX, event.MouseMove.MouseY);
+
+				// the first position is no movement
+				if(hasMousePosition)
+				{
+					mouseDelta += position - mousePosition;
+				}
+
+				mousePosition = position;
+				hasMousePosition = true;
+			} break;
+
+			case WindowEvent::FocusLost:
+			{
+				// the window won't receive the matching release events
+				keysReleased |= keysDown;
+				keysDown.reset();
+				buttonsReleased |= buttonsDown;
+				buttonsDown = 0;
+			} break;
+
+			default:
+				break;
+		}
+	}
+
+	////////////////////////////////////////////////////////////
+	bool Input::IsKeyDown(KeyCode key) const
+	{
+		return keysDown[GetKeyIndex(key)];
+	}
+
+	////////////////////////////////////////////////////////////
+	bool Input::IsKeyPressed(KeyCode key) const
+	{
+		return keysPressed[GetKeyIndex(key)];
+	}
+
+	////////////////////////////////////////////////////////////
+	bool Input::IsKeyReleased(KeyCode key) const
+	{
+		return keysReleased[GetKeyIndex(key)];
+	}
+
+	////////////////////////////////////////////////////////////
+	bool Input::IsMouseButtonDown(MouseButton button) const
+	{
+		return (buttonsDown & GetButtonMask(button)) != 0;
+	}
+
+	////////////////////////////////////////////////////////////
+	bool Input::IsMouseButtonPressed(MouseButton button) const
+	{
+		return (buttonsPressed & GetButtonMask(button)) != 0;
+	}
+
+	////////////////////////////////////////////////////////////
+	bool Input::IsMouseButtonReleased(MouseButton button) const
+	{
+		return (buttonsReleased & GetButtonMask(button)) != 0;
+	}
+
+	////////////////////////////////////////////////////////////
+	float Input::GetMouseWheelDelta(MouseWheel wheel) const
+	{
+		const usize index = (usize)wheel;
+		return index < wheelDeltas.size() ? wheelDeltas[index] : 0.0f;
+	}
+
+	////////////////////////////////////////////////////////////
+	const Int2& Input::GetMousePosition() const
+	{
+		return mousePosition;
+	}
+
+	////////////////////////////////////////////////////////////
+	const Int2& Input::GetMouseDelta() const
+	{
+		return mouseDelta;
+	}
+
+	////////////////////////////////////////////////////////////
+	usize Input::GetKeyIndex(KeyCode key)
+	{
+		// unknown keys and anything a bad cast produced share the unused bit
+		if((i32)key < 0 || (i32)key >= (i32)KeyCode::Count)
+		{
+			return 0;
+		}
+
+		return (usize)((i32)key + 1);
+	}
+
+	////////////////////////////////////////////////////////////
+	u32 Input::GetButtonMask(MouseButton button)
+	{
+		if((u32)button >= (u32)MouseButton::Count)
+		{
+			return 0;
+		}
+
+		return 1u << (u32)button;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,107 @@
+﻿// 
+// InputRecorder.cpp
+// Core
+// 
+// Created by Felix Busch on 19.10.2026.
+// Copyright © 2026 Felix Busch. All rights reserved.
+// 
+
+#include <Core/Application/InputRecorder.hpp>
+#include <Core/System/Error.hpp>
+
+#include <algorithm>
+#include <cstring>
+
+namespace Core
+{
+	////////////////////////////////////////////////////////////
+	usize InputRecorder::GetPayloadSize(WindowEvent::EventType type)
+	{
+		switch(type)
+		{
+			case WindowEvent::Resized:				return sizeof(WindowEvent::SizeEvent);
+			case WindowEvent::MouseWheelScrolled:	return sizeof(WindowEvent::MouseWheelScrollEvent);
+			case WindowEvent::MouseMoved:			return sizeof(WindowEvent::MouseMoveEvent);
+			case WindowEvent::MousePressed:
+			case WindowEvent::MouseReleased:		return sizeof(WindowEvent::MouseButtonEvent);
+			case WindowEvent::KeyPressed:
+			case WindowEvent::KeyReleased:			return sizeof(WindowEvent::KeyEvent);
+			case WindowEvent::TextEntered:			return sizeof(WindowEvent::TextEvent);
+			default:								return 0;
+		}
+	}
+
+	////////////////////////////////////////////////////////////
+	bool InputRecorder::Open(const std::filesystem::path& filepath)
+	{
+		Close();
+
+		file.open(filepath, std::ios::binary | std::ios::trunc);
+		if(!file)
+		{
+			Err() << "Failed to create input recording " << filepath << std::endl;
+			return false;
+		}
+
+		file.write(Magic, sizeof(Magic));
+		file.write(reinterpret_cast<const char*>(&Version), sizeof(Version));
+		return true;
+	}
+
+	////////////////////////////////////////////////////////////
+	void InputRecorder::Close()
+	{
+		if(file.is_open())
+		{
+			file.close();
+		}
+	}
+
+	////////////////////////////////////////////////////////////
+	bool InputRecorder::IsOpen() const
+	{
+		return file.is_open();
+	}
+
+	////////////////////////////////////////////////////////////
+	void InputRecorder::WriteFrame(const Time& deltaTime, std::span<const WindowEvent> events)
+	{
+		if(!file.is_open())
+		{
+			return;
+		}
+
+		const i64 nanoseconds = deltaTime.ToNanoseconds<i64>();
+		const u32 count = (u32)std::ranges::count_if(events, [](const WindowEvent& event) { return event.Type != WindowEvent::Generic; });
+
+		buffer.clear();
+		Append(&nanoseconds, sizeof(nanoseconds));
+		Append(&count, sizeof(count));
+
+		for(const WindowEvent& event : events)
+		{
+			if(event.Type == WindowEvent::Generic)
+				continue;
+
+			// all data members of the union start at its address
+			const u8 type = (u8)event.Type;
+			Append(&type, sizeof(type));
+			Append(&event.Size, GetPayloadSize(event.Type));
+		}
+
+		// a single write per frame
+		if(!file.write(buffer.data(), (std::streamsize)buffer.size()))
+		{
+			Err() << "Failed to write input recording, recording stopped" << std::endl;
+			Close();
+		}
+	}
+
+	////////////////////////////////////////////////////////////
+	void InputRecorder::Append(const void* data, usize size)
+	{
+		const usize offset = buffer.size();
+		buffer.resize(offset + size);
+		std::memcpy(buffer.data() + offset, data, size);
+	}
+}
\ No newline at end of file
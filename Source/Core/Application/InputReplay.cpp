@@ -0,0 +1,138 @@
+﻿// 
+// InputReplay.cpp
+// Core
+// 
+// Created by Felix Busch on 19.10.2026.
+// Copyright © 2026 Felix Busch. All rights reserved.
+// 
+
+#include <Core/Application/InputReplay.hpp>
+#include <Core/Application/InputRecorder.hpp>
+
+#include <Core/System/Stopwatch.hpp>
+#include <Core/System/Error.hpp>
+
+#include <algorithm>
+
+namespace Core
+{
+	////////////////////////////////////////////////////////////
+	bool InputReplay::Open(const std::filesystem::path& filepath)
+	{
+		Close();
+
+		file.open(filepath, std::ios::binary);
+		if(!file)
+		{
+			Err() << "Failed to open input recording " << filepath << std::endl;
+			return false;
+		}
+
+		char magic[sizeof(InputRecorder::Magic)] = {};
+		u32 version = 0;
+		file.read(magic, sizeof(magic));
+		file.read(reinterpret_cast<char*>(&version), sizeof(version));
+
+		if(!file || !std::equal(std::begin(magic), std::end(magic), std::begin(InputRecorder::Magic)) || version != InputRecorder::Version)
+		{
+			Err() << filepath << " is not a supported input recording" << std::endl;
+			Close();
+			return false;
+		}
+
+		return true;
+	}
+
+	////////////////////////////////////////////////////////////
+	void InputReplay::Close()
+	{
+		if(file.is_open())
+		{
+			file.close();
+		}
+	}
+
+	////////////////////////////////////////////////////////////
+	bool InputReplay::ReadFrame(Time& deltaTime, std::vector<WindowEvent>& events)
+	{
+		events.clear();
+
+		i64 nanoseconds = 0;
+		u32 count = 0;
+		file.read(reinterpret_cast<char*>(&nanoseconds), sizeof(nanoseconds));
+		file.read(reinterpret_cast<char*>(&count), sizeof(count));
+
+		if(!file)
+		{
+			// regular end of the recording
+			return false;
+		}
+
+		deltaTime = Nanoseconds(nanoseconds);
+
+		for(u32 i = 0; i < count; ++i)
+		{
+			u8 type = 0;
+			file.read(reinterpret_cast<char*>(&type), sizeof(type));
+
+			if(!file || type >= WindowEvent::TypeCount)
+			{
+				Err() << "The input recording is damaged" << std::endl;
+				return false;
+			}
+
+			// all data members of the union start at its address
+			WindowEvent event = (WindowEvent::EventType)type;
+			file.read(reinterpret_cast<char*>(&event.Size), (std::streamsize)InputRecorder::GetPayloadSize(event.Type));
+			events.push_back(event);
+		}
+
+		if(!file)
+		{
+			Err() << "The input recording is truncated" << std::endl;
+			return false;
+		}
+
+		return true;
+	}
+
+	////////////////////////////////////////////////////////////
+	InputReplay::Statistics InputReplay::Run(Sketch& sketch, Input* input, Timestep timestep, const Time& fixedDelta)
+	{
+		Statistics statistics;
+
+		Time recordedDelta;
+		std::vector<WindowEvent> events;
+
+		while(ReadFrame(recordedDelta, events))
+		{
+			const Time deltaTime = timestep == Fixed ? fixedDelta : recordedDelta;
+			const Stopwatch frameTimer = Stopwatch::StartNew();
+
+			if(input)
+			{
+				input->BeginFrame();
+			}
+
+			for(const WindowEvent& event : events)
+			{
+				if(input)
+				{
+					input->OnEvent(event);
+				}
+
+				sketch.OnEvent(event);
+			}
+
+			sketch.OnDraw(deltaTime.ToSeconds<float>());
+
+			const Time frameTime = frameTimer.GetElapsedTime();
+			statistics.FrameTimes.Record(frameTime);
+			statistics.TotalTime = statistics.TotalTime + frameTime;
+			statistics.EventCount += events.size();
+			++statistics.FrameCount;
+		}
+
+		return statistics;
+	}
+}
\ No newline at end of file
@@ -27,6 +27,11 @@ namespace Core
 	{
 	}
 
+	////////////////////////////////////////////////////////////
+	void Sketch::OnUpdate(float fixedDelta)
+	{
+	}
+
 	////////////////////////////////////////////////////////////
 	void Sketch::OnDraw(float deltaTime)
 	{
@@ -0,0 +1,291 @@
+﻿// 
+// CommandList.cpp
+// Core
+// 
+// Created by Felix Busch on 19.10.2026.
+// Copyright © 2026 Felix Busch. All rights reserved.
+// 
+
+#include <Core/Graphics/CommandList.hpp>
+#include <Core/System/Profiler.hpp>
+
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <d2d1.h>
+
+#include <cstring>
+
+namespace Core
+{
+	////////////////////////////////////////////////////////////
+	/// \brief Convert a color into the Direct2D representation.
+	/// 
+	////////////////////////////////////////////////////////////
+	static D2D1_COLOR_F ToColorF(const Color& color, float alpha)
+	{
+		return D2D1::ColorF((float)color.R / 255.0f, (float)color.G / 255.0f, (float)color.B / 255.0f, alpha);
+	}
+
+	////////////////////////////////////////////////////////////
+	CommandList::CommandList():
+		brush(nullptr),
+		brushTarget(nullptr)
+	{
+	}
+
+	////////////////////////////////////////////////////////////
+	CommandList::~CommandList()
+	{
+		Reset();
+
+		if(brush)
+		{
+			brush->Release();
+		}
+	}
+
+	////////////////////////////////////////////////////////////
+	void CommandList::Reset()
+	{
+		for(const Command& command : commands)
+		{
+			if(command.Resource)
+			{
+				command.Resource->Release();
+			}
+
+			if(command.Style.StrokeStyle)
+			{
+				command.Style.StrokeStyle->Release();
+			}
+		}
+
+		// keeps the capacity for the next frame
+		commands.clear();
+	}
+
+	////////////////////////////////////////////////////////////
+	void CommandList::Background(const Color& color)
+	{
+		Command command = {};
+		command.Type = Command::Background;
+		command.Style.Fill = color;
+		Record(command);
+	}
+
+	////////////////////////////////////////////////////////////
+	void CommandList::RoundedRectangle(const Matrix3x2& transform, const FloatRect& rectangle, float cornerX, float cornerY, const Paint& paint)
+	{
+		Command command = {};
+		command.Type = Command::RoundedRectangle;
+		command.Transform = transform;
+		command.Values[0] = rectangle.Left;
+		command.Values[1] = rectangle.Top;
+		command.Values[2] = rectangle.Left + rectangle.Width;
+		command.Values[3] = rectangle.Top + rectangle.Height;
+		command.Values[4] = cornerX;
+		command.Values[5] = cornerY;
+		command.Style = paint;
+		Record(command);
+	}
+
+	////////////////////////////////////////////////////////////
+	void CommandList::Ellipse(const Matrix3x2& transform, float centerX, float centerY, float radiusX, float radiusY, const Paint& paint)
+	{
+		Command command = {};
+		command.Type = Command::Ellipse;
+		command.Transform = transform;
+		command.Values[0] = centerX;
+		command.Values[1] = centerY;
+		command.Values[2] = radiusX;
+		command.Values[3] = radiusY;
+		command.Style = paint;
+		Record(command);
+	}
+
+	////////////////////////////////////////////////////////////
+	void CommandList::Line(const Matrix3x2& transform, float x1, float y1, float x2, float y2, const Paint& paint)
+	{
+		Command command = {};
+		command.Type = Command::Line;
+		command.Transform = transform;
+		command.Values[0] = x1;
+		command.Values[1] = y1;
+		command.Values[2] = x2;
+		command.Values[3] = y2;
+		command.Style = paint;
+		Record(command);
+	}
+
+	////////////////////////////////////////////////////////////
+	void CommandList::Geometry(const Matrix3x2& transform, ID2D1Geometry* geometry, const Paint& paint)
+	{
+		Command command = {};
+		command.Type = Command::Geometry;
+		command.Transform = transform;
+		command.Style = paint;
+		command.Resource = geometry;
+		Record(command);
+	}
+
+	////////////////////////////////////////////////////////////
+	void CommandList::Bitmap(ID2D1Bitmap* bitmap, const FloatRect& destination, float opacity, Texture::SampleMode sampleMode, const FloatRect& source)
+	{
+		Command command = {};
+		command.Type = Command::Bitmap;
+		command.Values[0] = destination.Left;
+		command.Values[1] = destination.Top;
+		command.Values[2] = destination.Left + destination.Width;
+		command.Values[3] = destination.Top + destination.Height;
+		command.Values[4] = opacity;
+		command.Values[5] = (float)sampleMode;
+		command.Source = source;
+		command.Resource = bitmap;
+		Record(command);
+	}
+
+	////////////////////////////////////////////////////////////
+	void CommandList::Transform(const Matrix3x2& transform)
+	{
+		Command command = {};
+		command.Type = Command::SetTransform;
+		command.Transform = transform;
+		Record(command);
+	}
+
+	////////////////////////////////////////////////////////////
+	void CommandList::Execute(ID2D1RenderTarget& target)
+	{
+		CORE_PROFILE_SCOPE("CommandList::Execute");
+
+		const Matrix3x2* applied = nullptr;
+
+		for(const Command& command : commands)
+		{
+			const Paint& paint = command.Style;
+			const float* values = command.Values;
+
+			// bitmaps are drawn with the transformation of the previous command, just like RenderTarget::Image() does
+			if(command.Type != Command::Background && command.Type != Command::Bitmap)
+			{
+				// consecutive commands mostly share their transformation
+				if(!applied || std::memcmp(applied->Data, command.Transform.Data, sizeof(command.Transform.Data)) != 0)
+				{
+					target.SetTransform(reinterpret_cast<const D2D1_MATRIX_3X2_F&>(command.Transform));
+					applied = &command.Transform;
+				}
+			}
+
+			switch(command.Type)
+			{
+				case Command::Background:
+				{
+					target.Clear(ToColorF(paint.Fill, 1.0f));
+				} break;
+
+				case Command::RoundedRectangle:
+				{
+					const D2D1_ROUNDED_RECT rectangle = D2D1::RoundedRect(D2D1::RectF(values[0], values[1], values[2], values[3]), values[4], values[5]);
+
+					if(paint.HasFill)
+						target.FillRoundedRectangle(rectangle, GetBrush(target, paint.Fill));
+
+					if(paint.HasStroke)
+						target.DrawRoundedRectangle(rectangle, GetBrush(target, paint.Stroke), paint.StrokeWeight, paint.StrokeStyle);
+				} break;
+
+				case Command::Ellipse:
+				{
+					const D2D1_ELLIPSE ellipse = D2D1::Ellipse(D2D1::Point2F(values[0], values[1]), values[2], values[3]);
+
+					if(paint.HasFill)
+						target.FillEllipse(ellipse, GetBrush(target, paint.Fill));
+
+					if(paint.HasStroke)
+						target.DrawEllipse(ellipse, GetBrush(target, paint.Stroke), paint.StrokeWeight, paint.StrokeStyle);
+				} break;
+
+				case Command::Line:
+				{
+					if(paint.HasStroke)
+						target.DrawLine(D2D1::Point2F(values[0], values[1]), D2D1::Point2F(values[2], values[3]), GetBrush(target, paint.Stroke), paint.StrokeWeight, paint.StrokeStyle);
+				} break;
+
+				case Command::Geometry:
+				{
+					ID2D1Geometry* geometry = static_cast<ID2D1Geometry*>(command.Resource);
+
+					if(paint.HasFill)
+						target.FillGeometry(geometry, GetBrush(target, paint.Fill));
+
+					if(paint.HasStroke)
+						target.DrawGeometry(geometry, GetBrush(target, paint.Stroke), paint.StrokeWeight, paint.StrokeStyle);
+				} break;
+
+				case Command::Bitmap:
+				{
+					const FloatRect& source = command.Source;
+
+					target.DrawBitmap(
+						static_cast<ID2D1Bitmap*>(command.Resource),
+						D2D1::RectF(values[0], values[1], values[2], values[3]),
+						values[4],
+						(D2D1_BITMAP_INTERPOLATION_MODE)values[5],
+						D2D1::RectF(source.Left, source.Top, source.Left + source.Width, source.Top + source.Height)
+					);
+				} break;
+
+				case Command::SetTransform:
+				{
+					// applied above
+				} break;
+			}
+		}
+	}
+
+	////////////////////////////////////////////////////////////
+	usize CommandList::GetSize() const
+	{
+		return commands.size();
+	}
+
+	////////////////////////////////////////////////////////////
+	void CommandList::Record(const Command& command)
+	{
+		// the resources must outlive the replay, even if the sketch releases them in the meantime
+		if(command.Resource)
+		{
+			command.Resource->AddRef();
+		}
+
+		if(command.Style.StrokeStyle)
+		{
+			command.Style.StrokeStyle->AddRef();
+		}
+
+		commands.push_back(command);
+	}
+
+	////////////////////////////////////////////////////////////
+	ID2D1SolidColorBrush* CommandList::GetBrush(ID2D1RenderTarget& target, const Color& color)
+	{
+		const D2D1_COLOR_F d2dColor = ToColorF(color, (float)color.A / 255.0f);
+
+		// brushes belong to the render target they were created with
+		if(brush && brushTarget == &target)
+		{
+			brush->SetColor(d2dColor);
+			return brush;
+		}
+
+		if(brush)
+		{
+			brush->Release();
+			brush = nullptr;
+		}
+
+		target.CreateSolidColorBrush(d2dColor, &brush);
+		brushTarget = &target;
+		return brush;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,420 @@
+﻿// 
+// CpuRenderTarget.cpp
+// Core
+// 
+// Created by Felix Busch on 19.10.2026.
+// Copyright © 2026 Felix Busch. All rights reserved.
+// 
+
+#include <Core/Graphics/CpuRenderTarget.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <numbers>
+
+namespace Core
+{
+	namespace
+	{
+		////////////////////////////////////////////////////////////
+		/// The number of corners of the polygon an ellipse is drawn
+		/// as
+		/// 
+		////////////////////////////////////////////////////////////
+		constexpr u32 EllipseSegments = 32;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Map a point through a transformation.
+		/// 
+		////////////////////////////////////////////////////////////
+		Float2 TransformPoint(const Matrix3x2& matrix, const Float2& point)
+		{
+			const float* m = matrix.Data;
+			return { point.X * m[0] + point.Y * m[2] + m[4], point.X * m[1] + point.Y * m[3] + m[5] };
+		}
+
+		////////////////////////////////////////////////////////////
+		/// \brief Draw a premultiplied pixel over another one.
+		/// 
+		////////////////////////////////////////////////////////////
+		u32 Blend(u32 destination, u32 source, u32 inverseAlpha)
+		{
+			u32 result = 0;
+			for(u32 shift = 0; shift < 32; shift += 8)
+			{
+				const u32 d = (destination >> shift) & 0xFF;
+				const u32 s = (source >> shift) & 0xFF;
+				result |= (s + (d * inverseAlpha + 127) / 255) << shift;
+			}
+
+			return result;
+		}
+	}
+
+	////////////////////////////////////////////////////////////
+	CpuRenderTarget::CpuRenderTarget():
+		transform(),
+		transformSet(false)
+	{
+		// push the initial rendering style
+		PushStyle();
+	}
+
+	////////////////////////////////////////////////////////////
+	void CpuRenderTarget::Resize(u32 width, u32 height)
+	{
+		pixels.Resize(width, height);
+	}
+
+	////////////////////////////////////////////////////////////
+	bool CpuRenderTarget::BeginDraw()
+	{
+		return !pixels.IsEmpty();
+	}
+
+	////////////////////////////////////////////////////////////
+	bool CpuRenderTarget::EndDraw()
+	{
+		return true;
+	}
+
+	////////////////////////////////////////////////////////////
+	void CpuRenderTarget::Background(const Color& color)
+	{
+		++stats.Clears;
+
+		const u32 pixel = PixelBuffer::Pack(Color(color.R, color.G, color.B, 255));
+		u32* data = pixels.GetPixels();
+		std::fill(data, data + (usize)pixels.GetWidth() * pixels.GetHeight(), pixel);
+	}
+
+	////////////////////////////////////////////////////////////
+	void CpuRenderTarget::Fill(const Color& color)
+	{
+		Style& style = styles.top();
+		style.FillColor = color;
+		style.HasFill = true;
+	}
+
+	////////////////////////////////////////////////////////////
+	void CpuRenderTarget::NoFill()
+	{
+		styles.top().HasFill = false;
+	}
+
+	////////////////////////////////////////////////////////////
+	void CpuRenderTarget::Stroke(const Color& color)
+	{
+		Style& style = styles.top();
+		style.StrokeColor = color;
+		style.HasStroke = true;
+	}
+
+	////////////////////////////////////////////////////////////
+	void CpuRenderTarget::NoStroke()
+	{
+		styles.top().HasStroke = false;
+	}
+
+	////////////////////////////////////////////////////////////
+	void CpuRenderTarget::StrokeWeight(float weight)
+	{
+		styles.top().StrokeWeight = weight;
+	}
+
+	////////////////////////////////////////////////////////////
+	void CpuRenderTarget::RectMode(DrawMode mode)
+	{
+		styles.top().RectMode = mode;
+	}
+
+	////////////////////////////////////////////////////////////
+	void CpuRenderTarget::Rect(float x1, float y1, float x2, float y2, [[maybe_unused]] float cornerX, [[maybe_unused]] float cornerY)
+	{
+		const Style& style = styles.top();
+
+		float left, top, right, bottom;
+		switch(style.RectMode)
+		{
+			default:
+			case Corner: left = x1; top = y1; right = x1 + x2; bottom = y1 + y2; break;
+			case Corners: left = x1; top = y1; right = x2; bottom = y2; break;
+			case Center: left = x1 - x2 / 2.0f; top = y1 - y2 / 2.0f; right = x1 + x2 / 2.0f; bottom = y1 + y2 / 2.0f; break;
+			case Radius: left = x1 - x2; top = y1 - y2; right = x1 + x2; bottom = y1 + y2; break;
+		}
+
+		if(!CountDraw(stats.Rectangles, style.HasFill, style.HasStroke))
+			return;
+
+		shape.assign({ { left, top }, { right, top }, { right, bottom }, { left, bottom } });
+		DrawShape(style);
+	}
+
+	////////////////////////////////////////////////////////////
+	void CpuRenderTarget::EllipseMode(DrawMode mode)
+	{
+		styles.top().EllipseMode = mode;
+	}
+
+	////////////////////////////////////////////////////////////
+	void CpuRenderTarget::Ellipse(float a, float b, float c, float d)
+	{
+		const Style& style = styles.top();
+
+		Float2 center, radius;
+		switch(style.EllipseMode)
+		{
+			case Corner: radius = { c / 2.0f, d / 2.0f }; center = { a + radius.X, b + radius.Y }; break;
+			case Corners: radius = { (c - a) / 2.0f, (d - b) / 2.0f }; center = { a + radius.X, b + radius.Y }; break;
+			default:
+			case Center: center = { a, b }; radius = { c / 2.0f, d / 2.0f }; break;
+			case Radius: center = { a, b }; radius = { c, d }; break;
+		}
+
+		if(!CountDraw(stats.Ellipses, style.HasFill, style.HasStroke))
+			return;
+
+		shape.clear();
+		for(u32 i = 0; i < EllipseSegments; ++i)
+		{
+			const float angle = (float)i / (float)EllipseSegments * 2.0f * std::numbers::pi_v<float>;
+			shape.emplace_back(center.X + std::cos(angle) * radius.X, center.Y + std::sin(angle) * radius.Y);
+		}
+
+		DrawShape(style);
+	}
+
+	////////////////////////////////////////////////////////////
+	void CpuRenderTarget::Line(float x1, float y1, float x2, float y2)
+	{
+		const Style& style = styles.top();
+
+		// lines have no fill
+		if(!CountDraw(stats.Lines, false, style.HasStroke))
+			return;
+
+		ChangeTransform();
+		StrokeSegment({ x1, y1 }, { x2, y2 }, style.StrokeWeight, style.StrokeColor);
+	}
+
+	////////////////////////////////////////////////////////////
+	void CpuRenderTarget::PushTransform(bool advance)
+	{
+		Style& style = styles.top();
+		style.Transform.push(advance && !style.Transform.empty() ? style.Transform.top() : Transformation());
+	}
+
+	////////////////////////////////////////////////////////////
+	void CpuRenderTarget::PopTransform()
+	{
+		Style& style = styles.top();
+		if(style.Transform.size() > 1)
+		{
+			style.Transform.pop();
+		}
+	}
+
+	////////////////////////////////////////////////////////////
+	void CpuRenderTarget::ResetTransform()
+	{
+		Transformation& transform = GetTransform();
+		transform.SetPosition(0.0f, 0.0f);
+		transform.SetRotation(Angle::Zero);
+		transform.SetScale(1.0f, 1.0f);
+	}
+
+	////////////////////////////////////////////////////////////
+	void CpuRenderTarget::Translate(float x, float y)
+	{
+		GetTransform().Move(x, y);
+	}
+
+	////////////////////////////////////////////////////////////
+	void CpuRenderTarget::Rotate(const Angle& rotation)
+	{
+		GetTransform().Rotate(rotation);
+	}
+
+	////////////////////////////////////////////////////////////
+	void CpuRenderTarget::Scale(float factorX, float factorY)
+	{
+		GetTransform().Scale(factorX, factorY);
+	}
+
+	////////////////////////////////////////////////////////////
+	const Transformation& CpuRenderTarget::GetTransform() const
+	{
+		return styles.top().Transform.top();
+	}
+
+	Transformation& CpuRenderTarget::GetTransform()
+	{
+		return styles.top().Transform.top();
+	}
+
+	////////////////////////////////////////////////////////////
+	void CpuRenderTarget::PushStyle()
+	{
+		styles.push(Style());
+		PushTransform(false);
+	}
+
+	////////////////////////////////////////////////////////////
+	void CpuRenderTarget::PopStyle()
+	{
+		if(styles.size() > 1)
+		{
+			styles.pop();
+		}
+	}
+
+	////////////////////////////////////////////////////////////
+	const PixelBuffer& CpuRenderTarget::GetPixelBuffer() const
+	{
+		return pixels;
+	}
+
+	////////////////////////////////////////////////////////////
+	const RenderStats& CpuRenderTarget::GetRenderStats() const
+	{
+		return stats;
+	}
+
+	////////////////////////////////////////////////////////////
+	const RenderStats& CpuRenderTarget::GetPreviousRenderStats() const
+	{
+		return previousStats;
+	}
+
+	////////////////////////////////////////////////////////////
+	void CpuRenderTarget::ResetRenderStats()
+	{
+		previousStats = stats;
+		stats = RenderStats();
+		transformSet = false;
+	}
+
+	////////////////////////////////////////////////////////////
+	void CpuRenderTarget::DrawShape(const Style& style)
+	{
+		ChangeTransform();
+
+		if(style.HasFill)
+		{
+			FillPolygon(shape.data(), shape.size(), style.FillColor);
+		}
+
+		if(style.HasStroke)
+		{
+			for(usize i = 0; i < shape.size(); ++i)
+			{
+				StrokeSegment(shape[i], shape[(i + 1) % shape.size()], style.StrokeWeight, style.StrokeColor);
+			}
+		}
+	}
+
+	////////////////////////////////////////////////////////////
+	void CpuRenderTarget::FillPolygon(const Float2* points, usize count, const Color& color)
+	{
+		if(count < 3 || color.A == 0 || pixels.IsEmpty())
+			return;
+
+		const Matrix3x2& matrix = GetTransform().GetTransform();
+
+		polygon.clear();
+		float minY = INFINITY, maxY = -INFINITY;
+		for(usize i = 0; i < count; ++i)
+		{
+			const Float2 point = TransformPoint(matrix, points[i]);
+			minY = std::min(minY, point.Y);
+			maxY = std::max(maxY, point.Y);
+			polygon.push_back(point);
+		}
+
+		// sample each row at its center
+		const i64 firstRow = std::max<i64>((i64)std::ceil(minY - 0.5f), 0);
+		const i64 lastRow = std::min<i64>((i64)std::floor(maxY - 0.5f), (i64)pixels.GetHeight() - 1);
+
+		const u32 pixel = PixelBuffer::Pack(color);
+		const u32 inverseAlpha = 255 - color.A;
+		const i64 width = pixels.GetWidth();
+
+		for(i64 y = firstRow; y <= lastRow; ++y)
+		{
+			const float sampleY = (float)y + 0.5f;
+
+			crossings.clear();
+			for(usize i = 0; i < polygon.size(); ++i)
+			{
+				const Float2& from = polygon[i];
+				const Float2& to = polygon[(i + 1) % polygon.size()];
+
+				if((from.Y <= sampleY) != (to.Y <= sampleY))
+				{
+					crossings.push_back(from.X + (sampleY - from.Y) * (to.X - from.X) / (to.Y - from.Y));
+				}
+			}
+
+			std::sort(crossings.begin(), crossings.end());
+
+			u32* row = pixels.GetRow((u32)y);
+			for(usize i = 0; i + 1 < crossings.size(); i += 2)
+			{
+				const i64 left = std::clamp<i64>((i64)std::ceil(crossings[i] - 0.5f), 0, width);
+				const i64 right = std::clamp<i64>((i64)std::ceil(crossings[i + 1] - 0.5f), 0, width);
+
+				if(inverseAlpha == 0)
+				{
+					std::fill(row + left, row + right, pixel);
+					continue;
+				}
+
+				for(i64 x = left; x < right; ++x)
+				{
+					row[x] = Blend(row[x], pixel, inverseAlpha);
+				}
+			}
+		}
+	}
+
+	////////////////////////////////////////////////////////////
+	void CpuRenderTarget::StrokeSegment(const Float2& from, const Float2& to, float weight, const Color& color)
+	{
+		const Float2 direction = to - from;
+		const float length = direction.Length();
+		if(length <= 0.0f)
+			return;
+
+		const float halfWidth = weight / 2.0f / length;
+		const Float2 normal(-direction.Y * halfWidth, direction.X * halfWidth);
+
+		const Float2 quad[4] = { from + normal, to + normal, to - normal, from - normal };
+		FillPolygon(quad, 4, color);
+	}
+
+	////////////////////////////////////////////////////////////
+	bool CpuRenderTarget::CountDraw(u32& counter, bool hasFill, bool hasStroke)
+	{
+		if(!hasFill && !hasStroke)
+		{
+			++stats.CulledPrimitives;
+			return false;
+		}
+
+		counter += (u32)hasFill + (u32)hasStroke;
+		return true;
+	}
+
+	////////////////////////////////////////////////////////////
+	void CpuRenderTarget::ChangeTransform()
+	{
+		const Matrix3x2& current = GetTransform().GetTransform();
+		if(transformSet && std::memcmp(transform.Data, current.Data, sizeof(current.Data)) == 0)
+			return;
+
+		transform = current;
+		transformSet = true;
+		++stats.TransformChanges;
+	}
+}
\ No newline at end of file
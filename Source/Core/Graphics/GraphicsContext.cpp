@@ -15,6 +15,7 @@
 #define NOMINMAX
 #include <wrl/client.h>
 #include <d2d1.h>
+#include <wincodec.h>
 
 namespace Core
 {
@@ -29,7 +30,9 @@ namespace Core
 	{
 	public:
 		
-		Microsoft::WRL::ComPtr<ID2D1HwndRenderTarget> RenderTarget;	///< The actual render target used to render content on screen.
+		Microsoft::WRL::ComPtr<ID2D1RenderTarget>		RenderTarget;		///< The actual render target used to render content.
+		Microsoft::WRL::ComPtr<ID2D1HwndRenderTarget>	WindowTarget;		///< The same render target if it presents to a window, nullptr otherwise.
+		Microsoft::WRL::ComPtr<IWICBitmap>				Framebuffer;		///< The pixels of an offscreen render target.
 
 	};
 
@@ -77,13 +80,49 @@ namespace Core
 		);
 
 		// create the render target
-		const HRESULT success = d2dFactory->CreateHwndRenderTarget(rtProperties, rtHwndProperties, &impl->RenderTarget);
+		const HRESULT success = d2dFactory->CreateHwndRenderTarget(rtProperties, rtHwndProperties, &impl->WindowTarget);
 		if(FAILED(success))
 		{
 			Err() << "Failed to create an ID2D1HwndRenderTarget instance." << std::endl;
 			return false;
 		}
 
+		impl->RenderTarget = impl->WindowTarget;
+		return true;
+	}
+
+	////////////////////////////////////////////////////////////
+	bool GraphicsContext::CreateOffscreen(u32 width, u32 height)
+	{
+		ID2D1Factory* d2dFactory = Factories::D2DFactory.Get();
+		IWICImagingFactory* imagingFactory = Factories::ImagingFactory.Get();
+		if(d2dFactory == nullptr || imagingFactory == nullptr)
+		{
+			Err() << "There is no ID2D1Factory or imaging factory instance. Make sure to setup the factories before creating a graphics context." << std::endl;
+			return false;
+		}
+
+		HRESULT success = imagingFactory->CreateBitmap(width, height, GUID_WICPixelFormat32bppPBGRA, WICBitmapCacheOnLoad, &impl->Framebuffer);
+		if(FAILED(success))
+		{
+			Err() << "Failed to create the framebuffer of an offscreen render target." << std::endl;
+			return false;
+		}
+
+		// rendered on the CPU, so the timings don't depend on the graphics card
+		const D2D1_RENDER_TARGET_PROPERTIES rtProperties = D2D1::RenderTargetProperties(
+			D2D1_RENDER_TARGET_TYPE_SOFTWARE,
+			D2D1::PixelFormat(DXGI_FORMAT_B8G8R8A8_UNORM, D2D1_ALPHA_MODE_PREMULTIPLIED)
+		);
+
+		success = d2dFactory->CreateWicBitmapRenderTarget(impl->Framebuffer.Get(), rtProperties, &impl->RenderTarget);
+		if(FAILED(success))
+		{
+			Err() << "Failed to create an offscreen render target." << std::endl;
+			impl->Framebuffer.Reset();
+			return false;
+		}
+
 		return true;
 	}
 
@@ -91,30 +130,52 @@ namespace Core
 	void GraphicsContext::Destroy()
 	{
 		impl->RenderTarget.Reset();
+		impl->WindowTarget.Reset();
+		impl->Framebuffer.Reset();
 	}
 
 	////////////////////////////////////////////////////////////
 	bool GraphicsContext::BeginDraw()
 	{
-		ID2D1HwndRenderTarget* renderTarget = impl->RenderTarget.Get();
+		ID2D1HwndRenderTarget* windowTarget = impl->WindowTarget.Get();
 
-		if (sizeCache.NeedsResize)
+		// an offscreen target keeps its size and is never occluded
+		if(!windowTarget)
 		{
-			const HRESULT success = renderTarget->Resize(D2D1::SizeU(sizeCache.ProjectionWidth, sizeCache.ProjectionHeight));
+			impl->RenderTarget->BeginDraw();
+			return true;
+		}
+
+		SizeCache size;
+		{
+			std::lock_guard lock(sizeMutex);
+			size = sizeCache;
+			sizeCache.NeedsResize = false;
+		}
+
+		if (size.NeedsResize)
+		{
+			const HRESULT success = windowTarget->Resize(D2D1::SizeU(size.ProjectionWidth, size.ProjectionHeight));
 
 			if(FAILED(success))
 			{
 				Err() << "Failed to resize the render target" << std::endl;
+
+				// try again next frame
+				std::lock_guard lock(sizeMutex);
+				if(!sizeCache.NeedsResize)
+				{
+					sizeCache = size;
+				}
+
 				return false;
 			}
-
-			sizeCache.NeedsResize = false;
 		}
 		
-		if (renderTarget->CheckWindowState() & D2D1_WINDOW_STATE_OCCLUDED)
+		if (windowTarget->CheckWindowState() & D2D1_WINDOW_STATE_OCCLUDED)
 			return false;
 
-		renderTarget->BeginDraw();
+		windowTarget->BeginDraw();
 		return true;
 	}
 
@@ -138,6 +199,7 @@ namespace Core
 		// check for resize events
 		if(event.Type == WindowEvent::Resized)
 		{
+			std::lock_guard lock(sizeMutex);
 			sizeCache.ProjectionWidth	= event.Size.Width;
 			sizeCache.ProjectionHeight	= event.Size.Height;
 			sizeCache.NeedsResize		= true;
@@ -0,0 +1,934 @@
+﻿// 
+// ImageFilter.cpp
+// Core
+// 
+// Created by Felix Busch on 19.10.2026.
+// Copyright © 2026 Felix Busch. All rights reserved.
+// 
+
+#include <Core/Graphics/ImageFilter.hpp>
+#include <Core/System/Parallel.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#if defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2) || defined(__SSE2__)
+	#define CORE_FILTER_SSE2
+	#include <emmintrin.h>
+#endif
+
+namespace Core
+{
+	namespace
+	{
+		////////////////////////////////////////////////////////////
+		/// The minimum number of rows handed to a single thread
+		/// 
+		////////////////////////////////////////////////////////////
+		constexpr u32 RowsPerTask = 16;
+
+#ifdef CORE_FILTER_SSE2
+
+		////////////////////////////////////////////////////////////
+		/// \brief The four channels of a pixel in BGRA order.
+		/// 
+		///	Wrapped in a struct, so std::vector keeps the alignment
+		///	of the vector type instead of dropping its attributes.
+		/// 
+		////////////////////////////////////////////////////////////
+		struct Channels
+		{
+			__m128 V;
+		};
+
+		inline Channels Zero()											{ return { _mm_setzero_ps() }; }
+		inline Channels Splat(float value)								{ return { _mm_set1_ps(value) }; }
+		inline Channels Add(Channels a, Channels b)						{ return { _mm_add_ps(a.V, b.V) }; }
+		inline Channels Sub(Channels a, Channels b)						{ return { _mm_sub_ps(a.V, b.V) }; }
+		inline Channels Mul(Channels a, Channels b)						{ return { _mm_mul_ps(a.V, b.V) }; }
+		inline Channels MulAdd(Channels sum, Channels a, Channels b)	{ return { _mm_add_ps(sum.V, _mm_mul_ps(a.V, b.V)) }; }
+
+		////////////////////////////////////////////////////////////
+		/// \brief Widen the bytes of a pixel into floats.
+		/// 
+		////////////////////////////////////////////////////////////
+		inline Channels Expand(u32 pixel)
+		{
+			const __m128i zero = _mm_setzero_si128();
+			__m128i value = _mm_cvtsi32_si128((int)pixel);
+			value = _mm_unpacklo_epi8(value, zero);
+			value = _mm_unpacklo_epi16(value, zero);
+			return { _mm_cvtepi32_ps(value) };
+		}
+
+		////////////////////////////////////////////////////////////
+		/// \brief Round and saturate the channels into a pixel.
+		/// 
+		///	The color channels are clamped to the alpha channel to
+		///	keep the pixel a valid premultiplied color.
+		/// 
+		////////////////////////////////////////////////////////////
+		inline u32 Pack(Channels channels)
+		{
+			__m128i value = _mm_cvtps_epi32(channels.V);
+			value = _mm_packs_epi32(value, value);
+			value = _mm_packus_epi16(value, value);
+
+			const u32 alpha = (u32)_mm_cvtsi128_si32(value) >> 24;
+			const __m128i limit = _mm_cvtsi32_si128((int)(alpha * 0x01010101u));
+			return (u32)_mm_cvtsi128_si32(_mm_min_epu8(value, limit));
+		}
+
+		////////////////////////////////////////////////////////////
+		/// \brief Scale straight color channels by an alpha and put
+		///		   the alpha into the alpha channel.
+		/// 
+		////////////////////////////////////////////////////////////
+		inline Channels Premultiply(Channels color, u32 alpha)
+		{
+			const float scale = (float)alpha / 255.0f;
+			return { _mm_add_ps(_mm_mul_ps(color.V, _mm_set_ps(0.0f, scale, scale, scale)), _mm_set_ps((float)alpha, 0.0f, 0.0f, 0.0f)) };
+		}
+
+		////////////////////////////////////////////////////////////
+		/// \brief Compute 77 * R + 150 * G + 29 * B for four
+		///		   pixels at once.
+		/// 
+		////////////////////////////////////////////////////////////
+		inline __m128i Luminance(__m128i pixels)
+		{
+			// every product fits into 16 bits, so the upper half of each lane stays zero
+			const __m128i mask = _mm_set1_epi32(0xFF);
+			const __m128i r = _mm_mullo_epi16(_mm_and_si128(_mm_srli_epi32(pixels, 16), mask), _mm_set1_epi32(77));
+			const __m128i g = _mm_mullo_epi16(_mm_and_si128(_mm_srli_epi32(pixels, 8), mask), _mm_set1_epi32(150));
+			const __m128i b = _mm_mullo_epi16(_mm_and_si128(pixels, mask), _mm_set1_epi32(29));
+			return _mm_add_epi32(r, _mm_add_epi32(g, b));
+		}
+
+		////////////////////////////////////////////////////////////
+		/// \brief Replicate the low byte of four lanes into their
+		///		   color channels, leaving the alpha byte zero.
+		/// 
+		////////////////////////////////////////////////////////////
+		inline __m128i Replicate(__m128i alpha)
+		{
+			return _mm_or_si128(alpha, _mm_or_si128(_mm_slli_epi32(alpha, 8), _mm_slli_epi32(alpha, 16)));
+		}
+
+#else
+
+		////////////////////////////////////////////////////////////
+		/// \brief The four channels of a pixel in BGRA order.
+		/// 
+		////////////////////////////////////////////////////////////
+		struct Channels
+		{
+			float V[4];
+		};
+
+		inline Channels Zero()											{ return { 0.0f, 0.0f, 0.0f, 0.0f }; }
+		inline Channels Splat(float value)								{ return { value, value, value, value }; }
+		inline Channels Add(Channels a, Channels b)						{ return { a.V[0] + b.V[0], a.V[1] + b.V[1], a.V[2] + b.V[2], a.V[3] + b.V[3] }; }
+		inline Channels Sub(Channels a, Channels b)						{ return { a.V[0] - b.V[0], a.V[1] - b.V[1], a.V[2] - b.V[2], a.V[3] - b.V[3] }; }
+		inline Channels Mul(Channels a, Channels b)						{ return { a.V[0] * b.V[0], a.V[1] * b.V[1], a.V[2] * b.V[2], a.V[3] * b.V[3] }; }
+		inline Channels MulAdd(Channels sum, Channels a, Channels b)	{ return Add(sum, Mul(a, b)); }
+
+		inline Channels Expand(u32 pixel)
+		{
+			return {
+				(float)(pixel & 0xFF),
+				(float)((pixel >> 8) & 0xFF),
+				(float)((pixel >> 16) & 0xFF),
+				(float)(pixel >> 24)
+			};
+		}
+
+		inline u32 Pack(Channels channels)
+		{
+			const u32 alpha = (u32)std::clamp(std::lround(channels.V[3]), 0l, 255l);
+
+			u32 pixel = alpha << 24;
+			for(u32 i = 0; i < 3; ++i)
+			{
+				pixel |= (u32)std::clamp(std::lround(channels.V[i]), 0l, (long)alpha) << (8 * i);
+			}
+
+			return pixel;
+		}
+
+		inline Channels Premultiply(Channels color, u32 alpha)
+		{
+			const float scale = (float)alpha / 255.0f;
+			return { color.V[0] * scale, color.V[1] * scale, color.V[2] * scale, (float)alpha };
+		}
+
+#endif
+
+		////////////////////////////////////////////////////////////
+		/// \brief Divide the color channels of premultiplied pixels
+		///		   by their alpha.
+		/// 
+		////////////////////////////////////////////////////////////
+		void UnpremultiplyPixels(u32* pixels, usize count)
+		{
+			for(usize i = 0; i < count; ++i)
+			{
+				const u32 pixel = pixels[i];
+				const u32 alpha = pixel >> 24;
+
+				if(alpha == 0 || alpha == 255)
+				{
+					continue;
+				}
+
+				u32 straight = alpha << 24;
+				for(u32 shift = 0; shift < 24; shift += 8)
+				{
+					const u32 channel = (pixel >> shift) & 0xFF;
+					straight |= std::min((channel * 255 + alpha / 2) / alpha, 255u) << shift;
+				}
+
+				pixels[i] = straight;
+			}
+		}
+
+		////////////////////////////////////////////////////////////
+		/// \brief Clamp a coordinate into [0, size).
+		/// 
+		////////////////////////////////////////////////////////////
+		inline u32 ClampIndex(i64 index, u32 size)
+		{
+			return (u32)std::clamp<i64>(index, 0, (i64)size - 1);
+		}
+
+		////////////////////////////////////////////////////////////
+		/// \brief Compute 77 * R + 150 * G + 29 * B of a pixel.
+		/// 
+		////////////////////////////////////////////////////////////
+		inline u32 Luminance(u32 pixel)
+		{
+			return 77 * ((pixel >> 16) & 0xFF) + 150 * ((pixel >> 8) & 0xFF) + 29 * (pixel & 0xFF);
+		}
+
+		////////////////////////////////////////////////////////////
+		/// \brief Copy a row and repeat its edge pixels radius
+		///		   times on both sides.
+		/// 
+		////////////////////////////////////////////////////////////
+		void PadRow(const u32* row, u32 width, u32 radius, std::vector<u32>& padded)
+		{
+			padded.resize((usize)width + 2 * (usize)radius);
+			std::fill_n(padded.begin(), radius, row[0]);
+			std::copy_n(row, width, padded.begin() + radius);
+			std::fill_n(padded.begin() + radius + width, radius, row[width - 1]);
+		}
+
+		////////////////////////////////////////////////////////////
+		/// \brief Convolve the rows [begin, end) horizontally.
+		/// 
+		////////////////////////////////////////////////////////////
+		void ConvolveRows(const u32* source, u32* destination, u32 width, u32 begin, u32 end, const std::vector<Channels>& weights)
+		{
+			const u32 radius = (u32)weights.size() / 2;
+			std::vector<u32> padded;
+
+			for(u32 y = begin; y < end; ++y)
+			{
+				PadRow(source + (usize)y * width, width, radius, padded);
+				u32* output = destination + (usize)y * width;
+
+				for(u32 x = 0; x < width; ++x)
+				{
+					Channels sum = Zero();
+					for(usize k = 0; k < weights.size(); ++k)
+					{
+						sum = MulAdd(sum, Expand(padded[x + k]), weights[k]);
+					}
+
+					output[x] = Pack(sum);
+				}
+			}
+		}
+
+		////////////////////////////////////////////////////////////
+		/// \brief Convolve the rows [begin, end) vertically.
+		/// 
+		///	Whole source rows are accumulated at once to walk the
+		///	memory linearly.
+		/// 
+		////////////////////////////////////////////////////////////
+		void ConvolveColumns(const u32* source, u32* destination, u32 width, u32 height, u32 begin, u32 end, const std::vector<Channels>& weights)
+		{
+			const i64 radius = (i64)weights.size() / 2;
+			std::vector<Channels> sums(width);
+
+			for(u32 y = begin; y < end; ++y)
+			{
+				std::fill(sums.begin(), sums.end(), Zero());
+
+				for(usize k = 0; k < weights.size(); ++k)
+				{
+					const u32* row = source + (usize)ClampIndex((i64)y + (i64)k - radius, height) * width;
+					for(u32 x = 0; x < width; ++x)
+					{
+						sums[x] = MulAdd(sums[x], Expand(row[x]), weights[k]);
+					}
+				}
+
+				u32* output = destination + (usize)y * width;
+				for(u32 x = 0; x < width; ++x)
+				{
+					output[x] = Pack(sums[x]);
+				}
+			}
+		}
+
+		////////////////////////////////////////////////////////////
+		/// \brief Box blur the rows [begin, end) horizontally
+		///		   using a running sum.
+		/// 
+		////////////////////////////////////////////////////////////
+		void BoxRows(const u32* source, u32* destination, u32 width, u32 begin, u32 end, u32 radius)
+		{
+			const u32 diameter = 2 * radius + 1;
+			const Channels scale = Splat(1.0f / (float)diameter);
+			std::vector<u32> padded;
+
+			for(u32 y = begin; y < end; ++y)
+			{
+				PadRow(source + (usize)y * width, width, radius, padded);
+				u32* output = destination + (usize)y * width;
+
+				// the sums are integers below 2^24, so they stay exact in floats
+				Channels sum = Zero();
+				for(u32 k = 0; k < diameter; ++k)
+				{
+					sum = Add(sum, Expand(padded[k]));
+				}
+
+				for(u32 x = 0; x < width; ++x)
+				{
+					output[x] = Pack(Mul(sum, scale));
+
+					if(x + 1 < width)
+					{
+						sum = Sub(Add(sum, Expand(padded[x + diameter])), Expand(padded[x]));
+					}
+				}
+			}
+		}
+
+		////////////////////////////////////////////////////////////
+		/// \brief Box blur the rows [begin, end) vertically using
+		///		   a running sum per column.
+		/// 
+		////////////////////////////////////////////////////////////
+		void BoxColumns(const u32* source, u32* destination, u32 width, u32 height, u32 begin, u32 end, u32 radius)
+		{
+			const Channels scale = Splat(1.0f / (float)(2 * radius + 1));
+			std::vector<Channels> sums(width, Zero());
+
+			for(i64 k = -(i64)radius; k <= (i64)radius; ++k)
+			{
+				const u32* row = source + (usize)ClampIndex((i64)begin + k, height) * width;
+				for(u32 x = 0; x < width; ++x)
+				{
+					sums[x] = Add(sums[x], Expand(row[x]));
+				}
+			}
+
+			for(u32 y = begin; y < end; ++y)
+			{
+				u32* output = destination + (usize)y * width;
+				for(u32 x = 0; x < width; ++x)
+				{
+					output[x] = Pack(Mul(sums[x], scale));
+				}
+
+				if(y + 1 < end)
+				{
+					const u32* entering = source + (usize)ClampIndex((i64)y + radius + 1, height) * width;
+					const u32* leaving = source + (usize)ClampIndex((i64)y - radius, height) * width;
+					for(u32 x = 0; x < width; ++x)
+					{
+						sums[x] = Sub(Add(sums[x], Expand(entering[x])), Expand(leaving[x]));
+					}
+				}
+			}
+		}
+
+		////////////////////////////////////////////////////////////
+		/// \brief Run a separable blur over the whole buffer.
+		/// 
+		////////////////////////////////////////////////////////////
+		template<typename HorizontalPass, typename VerticalPass>
+		void Separable(PixelBuffer& pixels, HorizontalPass horizontal, VerticalPass vertical)
+		{
+			const u32 width = pixels.GetWidth();
+			const u32 height = pixels.GetHeight();
+			u32* data = pixels.GetPixels();
+
+			std::vector<u32> intermediate((usize)width * height);
+
+			Parallel::For(height, RowsPerTask, [&](u32 begin, u32 end)
+			{
+				horizontal(data, intermediate.data(), width, height, begin, end);
+			});
+
+			Parallel::For(height, RowsPerTask, [&](u32 begin, u32 end)
+			{
+				vertical(intermediate.data(), data, width, height, begin, end);
+			});
+		}
+
+		////////////////////////////////////////////////////////////
+		/// \brief Convert pixels to grayscale.
+		/// 
+		////////////////////////////////////////////////////////////
+		void GrayPixels(u32* pixels, usize count)
+		{
+			usize i = 0;
+
+#ifdef CORE_FILTER_SSE2
+			for(; i + 4 <= count; i += 4)
+			{
+				const __m128i source = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pixels + i));
+				const __m128i gray = _mm_srli_epi32(Luminance(source), 8);
+				const __m128i alpha = _mm_slli_epi32(_mm_srli_epi32(source, 24), 24);
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(pixels + i), _mm_or_si128(alpha, Replicate(gray)));
+			}
+#endif
+
+			for(; i < count; ++i)
+			{
+				const u32 gray = Luminance(pixels[i]) >> 8;
+				pixels[i] = (pixels[i] & 0xFF000000) | (gray * 0x010101);
+			}
+		}
+
+		////////////////////////////////////////////////////////////
+		/// \brief Invert the color channels of pixels.
+		/// 
+		///	For premultiplied colors the inverse of a channel c is
+		///	alpha - c.
+		/// 
+		////////////////////////////////////////////////////////////
+		void InvertPixels(u32* pixels, usize count)
+		{
+			usize i = 0;
+
+#ifdef CORE_FILTER_SSE2
+			const __m128i colorMask = _mm_set1_epi32(0x00FFFFFF);
+			for(; i + 4 <= count; i += 4)
+			{
+				const __m128i source = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pixels + i));
+				const __m128i alpha = _mm_srli_epi32(source, 24);
+				const __m128i color = _mm_sub_epi32(Replicate(alpha), _mm_and_si128(source, colorMask));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(pixels + i), _mm_or_si128(_mm_slli_epi32(alpha, 24), color));
+			}
+#endif
+
+			for(; i < count; ++i)
+			{
+				const u32 alpha = pixels[i] >> 24;
+				pixels[i] = (alpha << 24) | ((alpha * 0x010101) - (pixels[i] & 0x00FFFFFF));
+			}
+		}
+
+		////////////////////////////////////////////////////////////
+		/// \brief Turn pixels white if their brightness reaches
+		///		   the level and black otherwise.
+		/// 
+		/// \param level The threshold in [0, 256]
+		/// 
+		////////////////////////////////////////////////////////////
+		void ThresholdPixels(u32* pixels, usize count, u32 level)
+		{
+			usize i = 0;
+
+#ifdef CORE_FILTER_SSE2
+			const __m128i levels = _mm_set1_epi32((int)level);
+			for(; i + 4 <= count; i += 4)
+			{
+				const __m128i source = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pixels + i));
+				const __m128i alpha = _mm_srli_epi32(source, 24);
+				const __m128i black = _mm_cmplt_epi32(Luminance(source), _mm_mullo_epi16(alpha, levels));
+				const __m128i color = _mm_andnot_si128(black, Replicate(alpha));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(pixels + i), _mm_or_si128(_mm_slli_epi32(alpha, 24), color));
+			}
+#endif
+
+			for(; i < count; ++i)
+			{
+				const u32 alpha = pixels[i] >> 24;
+				const bool white = Luminance(pixels[i]) >= alpha * level;
+				pixels[i] = (alpha << 24) | (white ? alpha * 0x010101 : 0);
+			}
+		}
+
+		////////////////////////////////////////////////////////////
+		/// \brief Combine two pixels channel by channel.
+		/// 
+		////////////////////////////////////////////////////////////
+		template<bool Minimum>
+		inline u32 Combine(u32 a, u32 b)
+		{
+			u32 result = 0;
+			for(u32 shift = 0; shift < 32; shift += 8)
+			{
+				const u32 x = (a >> shift) & 0xFF;
+				const u32 y = (b >> shift) & 0xFF;
+				result |= (Minimum ? std::min(x, y) : std::max(x, y)) << shift;
+			}
+
+			return result;
+		}
+
+		////////////////////////////////////////////////////////////
+		/// \brief Replace every pixel by the channel wise minimum
+		///		   (or maximum) of itself and its four neighbors.
+		/// 
+		////////////////////////////////////////////////////////////
+		template<bool Minimum>
+		void MorphRows(const u32* source, u32* destination, u32 width, u32 height, u32 begin, u32 end)
+		{
+			for(u32 y = begin; y < end; ++y)
+			{
+				const u32* up = source + (usize)ClampIndex((i64)y - 1, height) * width;
+				const u32* row = source + (usize)y * width;
+				const u32* down = source + (usize)ClampIndex((i64)y + 1, height) * width;
+				u32* output = destination + (usize)y * width;
+
+				const auto combine = [&](u32 x)
+				{
+					u32 value = Combine<Minimum>(row[x], up[x]);
+					value = Combine<Minimum>(value, down[x]);
+					value = Combine<Minimum>(value, row[x > 0 ? x - 1 : 0]);
+					return Combine<Minimum>(value, row[std::min(x + 1, width - 1)]);
+				};
+
+				output[0] = combine(0);
+				u32 x = 1;
+
+#ifdef CORE_FILTER_SSE2
+				// the interior has both horizontal neighbors, 4 pixels at a time
+				for(; x + 5 <= width; x += 4)
+				{
+					const auto load = [](const u32* pointer) { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(pointer)); };
+					const auto pick = [](__m128i a, __m128i b) { return Minimum ? _mm_min_epu8(a, b) : _mm_max_epu8(a, b); };
+
+					__m128i value = pick(load(row + x), load(up + x));
+					value = pick(value, load(down + x));
+					value = pick(value, load(row + x - 1));
+					value = pick(value, load(row + x + 1));
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(output + x), value);
+				}
+#endif
+
+				for(; x < width; ++x)
+				{
+					output[x] = combine(x);
+				}
+			}
+		}
+
+		////////////////////////////////////////////////////////////
+		/// \brief Convolve the rows [begin, end) with a square
+		///		   kernel.
+		/// 
+		///	The source holds straight colors. Only the colors are
+		///	convolved, every pixel keeps its own alpha, so kernels
+		///	summing to zero (edges, emboss) don't clear the image.
+		/// 
+		////////////////////////////////////////////////////////////
+		void ConvolveKernel(const u32* source, u32* destination, u32 width, u32 height, u32 begin, u32 end, const std::vector<Channels>& weights, u32 size)
+		{
+			const i64 radius = size / 2;
+
+			// the clamped column of every padded x-coordinate
+			std::vector<u32> columns((usize)width + size - 1);
+			for(usize i = 0; i < columns.size(); ++i)
+			{
+				columns[i] = ClampIndex((i64)i - radius, width);
+			}
+
+			std::vector<const u32*> rows(size);
+
+			for(u32 y = begin; y < end; ++y)
+			{
+				for(u32 k = 0; k < size; ++k)
+				{
+					rows[k] = source + (usize)ClampIndex((i64)y + k - radius, height) * width;
+				}
+
+				u32* output = destination + (usize)y * width;
+				for(u32 x = 0; x < width; ++x)
+				{
+					Channels sum = Zero();
+					for(u32 ky = 0; ky < size; ++ky)
+					{
+						const u32* row = rows[ky];
+						const Channels* weight = weights.data() + (usize)ky * size;
+						for(u32 kx = 0; kx < size; ++kx)
+						{
+							sum = MulAdd(sum, Expand(row[columns[x + kx]]), weight[kx]);
+						}
+					}
+
+					const u32 alpha = source[(usize)y * width + x] >> 24;
+					output[x] = Pack(Premultiply(sum, alpha));
+				}
+			}
+		}
+
+		////////////////////////////////////////////////////////////
+		/// \brief Compute the normalized weights of a gaussian
+		///		   kernel with 2 * radius + 1 taps.
+		/// 
+		////////////////////////////////////////////////////////////
+		std::vector<Channels> GaussianWeights(u32 radius)
+		{
+			const float sigma = (float)radius / 2.0f;
+			std::vector<float> weights(2 * (usize)radius + 1);
+
+			float total = 0.0f;
+			for(usize i = 0; i < weights.size(); ++i)
+			{
+				const float x = (float)i - (float)radius;
+				weights[i] = std::exp(-(x * x) / (2.0f * sigma * sigma));
+				total += weights[i];
+			}
+
+			std::vector<Channels> result(weights.size());
+			for(usize i = 0; i < weights.size(); ++i)
+			{
+				result[i] = Splat(weights[i] / total);
+			}
+
+			return result;
+		}
+
+		////////////////////////////////////////////////////////////
+		/// \brief Run a point-wise operation on all pixels.
+		/// 
+		////////////////////////////////////////////////////////////
+		template<typename Operation>
+		void ForEachPixel(PixelBuffer& pixels, Operation operation)
+		{
+			const u32 width = pixels.GetWidth();
+			u32* data = pixels.GetPixels();
+
+			Parallel::For(pixels.GetHeight(), RowsPerTask, [&](u32 begin, u32 end)
+			{
+				operation(data + (usize)begin * width, (usize)(end - begin) * width);
+			});
+		}
+
+		////////////////////////////////////////////////////////////
+		/// \brief Run an operation that reads from a copy of the
+		///		   pixels.
+		/// 
+		////////////////////////////////////////////////////////////
+		template<typename Operation>
+		void ForEachRow(PixelBuffer& pixels, Operation operation)
+		{
+			const u32 width = pixels.GetWidth();
+			const u32 height = pixels.GetHeight();
+			u32* data = pixels.GetPixels();
+
+			const std::vector<u32> source(data, data + (usize)width * height);
+
+			Parallel::For(height, RowsPerTask, [&](u32 begin, u32 end)
+			{
+				operation(source.data(), data, width, height, begin, end);
+			});
+		}
+
+		////////////////////////////////////////////////////////////
+		/// \brief Define the source pixels and weights that make
+		///		   up every destination pixel along one axis.
+		/// 
+		////////////////////////////////////////////////////////////
+		struct Contributions
+		{
+			u32						Taps;		///< The number of source pixels per destination pixel
+			std::vector<u32>		Indices;	///< Taps clamped source indices per destination pixel
+			std::vector<Channels>	Weights;	///< Taps normalized weights per destination pixel
+		};
+
+		////////////////////////////////////////////////////////////
+		/// \brief Get the radius of a resampling filter in source
+		///		   pixels at a scale of 1.
+		/// 
+		////////////////////////////////////////////////////////////
+		float SupportOf(ImageFilter::ResampleFilter filter)
+		{
+			switch(filter)
+			{
+				default:
+				case ImageFilter::Box:		return 0.5f;
+				case ImageFilter::Bilinear:	return 1.0f;
+				case ImageFilter::Bicubic:	return 2.0f;
+				case ImageFilter::Lanczos3:	return 3.0f;
+			}
+		}
+
+		////////////////////////////////////////////////////////////
+		/// \brief Evaluate a resampling filter at a distance.
+		/// 
+		////////////////////////////////////////////////////////////
+		float Evaluate(ImageFilter::ResampleFilter filter, float x)
+		{
+			constexpr float Pi = 3.14159265358979f;
+			const auto sinc = [Pi](float value)
+			{
+				return value == 0.0f ? 1.0f : std::sin(Pi * value) / (Pi * value);
+			};
+
+			x = std::abs(x);
+			switch(filter)
+			{
+				default:
+				case ImageFilter::Box:		return x < 0.5f ? 1.0f : 0.0f;
+				case ImageFilter::Bilinear:	return x < 1.0f ? 1.0f - x : 0.0f;
+				case ImageFilter::Bicubic:
+				{
+					// Catmull-Rom spline (a = -0.5)
+					if(x < 1.0f) return (1.5f * x - 2.5f) * x * x + 1.0f;
+					if(x < 2.0f) return ((-0.5f * x + 2.5f) * x - 4.0f) * x + 2.0f;
+					return 0.0f;
+				}
+				case ImageFilter::Lanczos3:	return x < 3.0f ? sinc(x) * sinc(x / 3.0f) : 0.0f;
+			}
+		}
+
+		////////////////////////////////////////////////////////////
+		/// \brief Precompute the contributions for resampling an
+		///		   axis from sourceSize to destinationSize pixels.
+		/// 
+		///	When downscaling the filter is stretched to cover all
+		///	source pixels that fall into a destination pixel.
+		/// 
+		////////////////////////////////////////////////////////////
+		Contributions ComputeContributions(u32 sourceSize, u32 destinationSize, ImageFilter::ResampleFilter filter)
+		{
+			const float ratio = (float)sourceSize / (float)destinationSize;
+			const float scale = std::max(ratio, 1.0f);
+			const float support = SupportOf(filter) * scale;
+
+			Contributions result;
+			result.Taps = (u32)std::ceil(support * 2.0f) + 1;
+			result.Indices.resize((usize)destinationSize * result.Taps);
+			result.Weights.resize((usize)destinationSize * result.Taps);
+
+			std::vector<float> weights(result.Taps);
+			for(u32 i = 0; i < destinationSize; ++i)
+			{
+				const float center = ((float)i + 0.5f) * ratio;
+				const i64 left = (i64)std::floor(center - support);
+
+				float total = 0.0f;
+				for(u32 k = 0; k < result.Taps; ++k)
+				{
+					const float distance = ((float)(left + k) + 0.5f - center) / scale;
+					weights[k] = Evaluate(filter, distance);
+					total += weights[k];
+				}
+
+				for(u32 k = 0; k < result.Taps; ++k)
+				{
+					const usize slot = (usize)i * result.Taps + k;
+					result.Indices[slot] = ClampIndex(left + k, sourceSize);
+					result.Weights[slot] = Splat(total != 0.0f ? weights[k] / total : 0.0f);
+				}
+			}
+
+			return result;
+		}
+
+		////////////////////////////////////////////////////////////
+		/// \brief Resample the rows [begin, end) horizontally.
+		/// 
+		////////////////////////////////////////////////////////////
+		void ResampleRows(const PixelBuffer& source, u32* destination, u32 width, u32 begin, u32 end, const Contributions& contributions)
+		{
+			for(u32 y = begin; y < end; ++y)
+			{
+				const u32* row = source.GetRow(y);
+				u32* output = destination + (usize)y * width;
+
+				for(u32 x = 0; x < width; ++x)
+				{
+					const u32* indices = contributions.Indices.data() + (usize)x * contributions.Taps;
+					const Channels* weights = contributions.Weights.data() + (usize)x * contributions.Taps;
+
+					Channels sum = Zero();
+					for(u32 k = 0; k < contributions.Taps; ++k)
+					{
+						sum = MulAdd(sum, Expand(row[indices[k]]), weights[k]);
+					}
+
+					output[x] = Pack(sum);
+				}
+			}
+		}
+
+		////////////////////////////////////////////////////////////
+		/// \brief Resample the destination rows [begin, end)
+		///		   vertically.
+		/// 
+		////////////////////////////////////////////////////////////
+		void ResampleColumns(const u32* source, PixelBuffer& destination, u32 begin, u32 end, const Contributions& contributions)
+		{
+			const u32 width = destination.GetWidth();
+			std::vector<Channels> sums(width);
+
+			for(u32 y = begin; y < end; ++y)
+			{
+				std::fill(sums.begin(), sums.end(), Zero());
+
+				for(u32 k = 0; k < contributions.Taps; ++k)
+				{
+					const usize slot = (usize)y * contributions.Taps + k;
+					const u32* row = source + (usize)contributions.Indices[slot] * width;
+					const Channels weight = contributions.Weights[slot];
+
+					for(u32 x = 0; x < width; ++x)
+					{
+						sums[x] = MulAdd(sums[x], Expand(row[x]), weight);
+					}
+				}
+
+				u32* output = destination.GetRow(y);
+				for(u32 x = 0; x < width; ++x)
+				{
+					output[x] = Pack(sums[x]);
+				}
+			}
+		}
+	}
+
+	////////////////////////////////////////////////////////////
+	void ImageFilter::Apply(PixelBuffer& pixels, Type type)
+	{
+		Apply(pixels, type, type == Threshold ? 0.5f : 1.0f);
+	}
+
+	////////////////////////////////////////////////////////////
+	void ImageFilter::Apply(PixelBuffer& pixels, Type type, float parameter)
+	{
+		if(pixels.IsEmpty())
+		{
+			return;
+		}
+
+		switch(type)
+		{
+			case Blur:
+			{
+				const u32 radius = (u32)std::max(std::lround(parameter), 0l);
+				if(radius == 0)
+				{
+					return;
+				}
+
+				const std::vector<Channels> weights = GaussianWeights(radius);
+				Separable(pixels,
+					[&](const u32* source, u32* destination, u32 width, u32, u32 begin, u32 end) { ConvolveRows(source, destination, width, begin, end, weights); },
+					[&](const u32* source, u32* destination, u32 width, u32 height, u32 begin, u32 end) { ConvolveColumns(source, destination, width, height, begin, end, weights); }
+				);
+			} break;
+
+			case BoxBlur:
+			{
+				const u32 radius = (u32)std::max(std::lround(parameter), 0l);
+				if(radius == 0)
+				{
+					return;
+				}
+
+				Separable(pixels,
+					[&](const u32* source, u32* destination, u32 width, u32, u32 begin, u32 end) { BoxRows(source, destination, width, begin, end, radius); },
+					[&](const u32* source, u32* destination, u32 width, u32 height, u32 begin, u32 end) { BoxColumns(source, destination, width, height, begin, end, radius); }
+				);
+			} break;
+
+			case Threshold:
+			{
+				const u32 level = (u32)std::lround(std::clamp(parameter, 0.0f, 1.0f) * 256.0f);
+				ForEachPixel(pixels, [level](u32* data, usize count) { ThresholdPixels(data, count, level); });
+			} break;
+
+			case Invert:	ForEachPixel(pixels, InvertPixels); break;
+			case Gray:		ForEachPixel(pixels, GrayPixels); break;
+			case Erode:		ForEachRow(pixels, MorphRows<true>); break;
+			case Dilate:	ForEachRow(pixels, MorphRows<false>); break;
+		}
+
+		pixels.MarkDirty();
+	}
+
+	////////////////////////////////////////////////////////////
+	void ImageFilter::Convolve(PixelBuffer& pixels, const float* kernel, u32 size)
+	{
+		if(pixels.IsEmpty() || kernel == nullptr || size % 2 == 0)
+		{
+			return;
+		}
+
+		std::vector<Channels> weights((usize)size * size);
+		for(usize i = 0; i < weights.size(); ++i)
+		{
+			weights[i] = Splat(kernel[i]);
+		}
+
+		const u32 width = pixels.GetWidth();
+		const u32 height = pixels.GetHeight();
+		u32* data = pixels.GetPixels();
+
+		// mix straight colors, so dark transparent pixels don't bleed into their neighbours
+		std::vector<u32> source(data, data + (usize)width * height);
+
+		Parallel::For(height, RowsPerTask, [&](u32 begin, u32 end)
+		{
+			UnpremultiplyPixels(source.data() + (usize)begin * width, (usize)(end - begin) * width);
+		});
+
+		Parallel::For(height, RowsPerTask, [&](u32 begin, u32 end)
+		{
+			ConvolveKernel(source.data(), data, width, height, begin, end, weights, size);
+		});
+
+		pixels.MarkDirty();
+	}
+
+	////////////////////////////////////////////////////////////
+	void ImageFilter::Resize(const PixelBuffer& source, PixelBuffer& destination, u32 width, u32 height, ResampleFilter filter)
+	{
+		destination.Resize(width, height);
+
+		if(source.IsEmpty() || destination.IsEmpty())
+		{
+			return;
+		}
+
+		const Contributions horizontal = ComputeContributions(source.GetWidth(), width, filter);
+		const Contributions vertical = ComputeContributions(source.GetHeight(), height, filter);
+
+		// resample the width first, the intermediate image keeps the source height
+		std::vector<u32> intermediate((usize)width * source.GetHeight());
+
+		Parallel::For(source.GetHeight(), RowsPerTask, [&](u32 begin, u32 end)
+		{
+			ResampleRows(source, intermediate.data(), width, begin, end, horizontal);
+		});
+
+		Parallel::For(height, RowsPerTask, [&](u32 begin, u32 end)
+		{
+			ResampleColumns(intermediate.data(), destination, begin, end, vertical);
+		});
+
+		destination.MarkDirty();
+	}
+}
\ No newline at end of file
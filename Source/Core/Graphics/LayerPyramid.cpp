@@ -0,0 +1,425 @@
+﻿// 
+// LayerPyramid.cpp
+// Core
+// 
+// Created by Felix Busch on 19.10.2026.
+// Copyright © 2026 Felix Busch. All rights reserved.
+// 
+
+#include <Core/Graphics/LayerPyramid.hpp>
+
+#include <bit>
+
+namespace Core
+{
+	namespace
+	{
+		////////////////////////////////////////////////////////////
+		/// The Stale mask of a layer that has to be rendered as a
+		/// whole
+		/// 
+		////////////////////////////////////////////////////////////
+		constexpr u8 AllQuadrants = 0xF;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Combine a level and a layer index into a key.
+		/// 
+		////////////////////////////////////////////////////////////
+		constexpr u64 MakeKey(u32 level, u32 index)
+		{
+			return ((u64)level << 32) | index;
+		}
+	}
+
+	////////////////////////////////////////////////////////////
+	LayerPyramid::LayerPyramid():
+		layerBytes(0),
+		usedBytes(0),
+		byteBudget(0),
+		frame(0),
+		budget(Time::Zero),
+		built(0)
+	{
+	}
+
+	////////////////////////////////////////////////////////////
+	void LayerPyramid::Create(u32 width, u32 height, usize layerBytes, usize byteBudget)
+	{
+		this->layerBytes = layerBytes;
+		this->byteBudget = byteBudget;
+
+		levels.clear();
+		usage.clear();
+		usedBytes = 0;
+
+		// add coarser levels until a single layer covers everything
+		while(true)
+		{
+			Level& level = levels.emplace_back();
+			level.Width = width;
+			level.Height = height;
+			level.Nodes.resize((usize)width * height);
+
+			if(width <= 1 && height <= 1)
+			{
+				break;
+			}
+
+			width = (width + 1) / 2;
+			height = (height + 1) / 2;
+		}
+	}
+
+	////////////////////////////////////////////////////////////
+	void LayerPyramid::Invalidate(u32 x, u32 y, i32 delta)
+	{
+		for(u32 level = 0; level < (u32)levels.size(); ++level)
+		{
+			Level& current = levels[level];
+			Node& node = current.Nodes[(usize)(y >> level) * current.Width + (x >> level)];
+			node.Count = (u32)((i64)node.Count + delta);
+
+			if(level == 0)
+			{
+				node.Stale = AllQuadrants;
+				continue;
+			}
+
+			// a quadrant that is rendered again from its child covers the chunk anyway
+			const u32 quadrant = ((y >> (level - 1)) & 1) * 2 + ((x >> (level - 1)) & 1);
+			if(node.Stale & (1u << quadrant))
+			{
+				continue;
+			}
+
+			const u32 side = 1u << level;
+			const u32 cell = (y & (side - 1)) * side + (x & (side - 1));
+			if(node.Cells.empty())
+			{
+				node.Cells.assign(((usize)side * side + 63) / 64, 0);
+			}
+
+			const u64 bit = 1ull << (cell % 64);
+			if((node.Cells[cell / 64] & bit) == 0)
+			{
+				node.Cells[cell / 64] |= bit;
+				++node.CellCount;
+			}
+		}
+	}
+
+	////////////////////////////////////////////////////////////
+	void LayerPyramid::Reset(const std::vector<u32>& counts)
+	{
+		if(levels.empty())
+		{
+			return;
+		}
+
+		Level& chunks = levels.front();
+		for(usize i = 0; i < chunks.Nodes.size(); ++i)
+		{
+			chunks.Nodes[i].Count = i < counts.size() ? counts[i] : 0;
+		}
+
+		// sum up the counts level by level
+		for(usize level = 1; level < levels.size(); ++level)
+		{
+			const Level& below = levels[level - 1];
+			Level& current = levels[level];
+
+			for(Node& node : current.Nodes)
+			{
+				node.Count = 0;
+			}
+
+			for(u32 y = 0; y < below.Height; ++y)
+			{
+				for(u32 x = 0; x < below.Width; ++x)
+				{
+					current.Nodes[(usize)(y / 2) * current.Width + x / 2].Count += below.Nodes[(usize)y * below.Width + x].Count;
+				}
+			}
+		}
+
+		// resident layers stay usable as a fallback until they are rendered again
+		for(Level& level : levels)
+		{
+			for(Node& node : level.Nodes)
+			{
+				node.Stale = AllQuadrants;
+				node.Cells.clear();
+				node.CellCount = 0;
+			}
+		}
+	}
+
+	////////////////////////////////////////////////////////////
+	void LayerPyramid::BeginFrame(const Time& buildBudget)
+	{
+		++frame;
+		built = 0;
+		budget = buildBudget;
+		watch.Restart();
+	}
+
+	////////////////////////////////////////////////////////////
+	bool LayerPyramid::Build(Renderer& renderer, u32 level, u32 x, u32 y)
+	{
+		return Build(renderer, level, x, y, true);
+	}
+
+	////////////////////////////////////////////////////////////
+	bool LayerPyramid::Build(Renderer& renderer, u32 level, u32 x, u32 y, bool pin)
+	{
+		const u32 index = y * levels[level].Width + x;
+		Node& node = levels[level].Nodes[index];
+
+		if(node.Count == 0)
+		{
+			return true;
+		}
+
+		if(IsCurrent(node))
+		{
+			if(pin)
+			{
+				Touch(node);
+			}
+
+			return true;
+		}
+
+		if(IsOutOfTime())
+		{
+			return false;
+		}
+
+		if(!node.Resident)
+		{
+			Evict(renderer, layerBytes);
+
+			if(!renderer.CreateLayer(level, x, y))
+			{
+				return false;
+			}
+
+			node.Resident = true;
+			node.Complete = false;
+			node.Stale = AllQuadrants;
+			node.Position = usage.insert(usage.begin(), MakeKey(level, index));
+			usedBytes += layerBytes;
+		}
+
+		// the layer must survive the evictions made for its children
+		const u64 lastUsed = node.LastUsed;
+		Touch(node);
+
+		bool finished = true;
+		if(level == 0)
+		{
+			finished = renderer.RenderChunk(x, y);
+			if(finished)
+			{
+				node.Stale = 0;
+				++built;
+			}
+		} else
+		{
+			const Level& below = levels[level - 1];
+			for(u32 quadrant = 0; quadrant < 4; ++quadrant)
+			{
+				if((node.Stale & (1u << quadrant)) == 0)
+				{
+					continue;
+				}
+
+				const u32 childX = x * 2 + (quadrant & 1);
+				const u32 childY = y * 2 + (quadrant >> 1);
+				const bool empty = childX >= below.Width || childY >= below.Height || below.Nodes[(usize)childY * below.Width + childX].Count == 0;
+
+				// the child is copied right after it has been built, so
+				// it is no longer needed once the next child allocates
+				if(IsOutOfTime() || (!empty && !Build(renderer, level - 1, childX, childY, false)) || !renderer.RenderQuadrant(level, x, y, quadrant, empty))
+				{
+					finished = false;
+					break;
+				}
+
+				node.Stale &= (u8)~(1u << quadrant);
+				++built;
+			}
+
+			// then the chunks changed since the quadrants were rendered
+			const u32 side = 1u << level;
+			for(usize word = 0; finished && node.CellCount > 0 && word < node.Cells.size(); ++word)
+			{
+				while(node.Cells[word] != 0)
+				{
+					const u32 cell = (u32)(word * 64) + (u32)std::countr_zero(node.Cells[word]);
+					const u32 chunkX = (x << level) + cell % side;
+					const u32 chunkY = (y << level) + cell / side;
+					const bool empty = levels[0].Nodes[(usize)chunkY * levels[0].Width + chunkX].Count == 0;
+
+					if(IsOutOfTime() || !renderer.RenderCell(level, x, y, chunkX, chunkY, empty))
+					{
+						finished = false;
+						break;
+					}
+
+					node.Cells[word] &= node.Cells[word] - 1;
+					--node.CellCount;
+					++built;
+				}
+			}
+		}
+
+		if(node.Stale == 0)
+		{
+			node.Complete = true;
+		}
+
+		// a layer only built for its parent is the first one to be released,
+		// unless it is unfinished and the parent continues next frame
+		if(!pin && finished && lastUsed != frame)
+		{
+			node.LastUsed = lastUsed;
+			usage.splice(usage.end(), usage, node.Position);
+		}
+
+		return finished;
+	}
+
+	////////////////////////////////////////////////////////////
+	bool LayerPyramid::FindFallback(u32 level, u32 x, u32 y, u32& fallback)
+	{
+		for(u32 current = level; current < (u32)levels.size(); ++current)
+		{
+			const u32 shift = current - level;
+			Level& above = levels[current];
+			Node& node = above.Nodes[(usize)(y >> shift) * above.Width + (x >> shift)];
+
+			if(node.Resident && node.Complete)
+			{
+				Touch(node);
+				fallback = current;
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	////////////////////////////////////////////////////////////
+	void LayerPyramid::Release(Renderer& renderer)
+	{
+		for(u32 level = 0; level < (u32)levels.size(); ++level)
+		{
+			Level& current = levels[level];
+			for(u32 index = 0; index < (u32)current.Nodes.size(); ++index)
+			{
+				Node& node = current.Nodes[index];
+				if(node.Resident)
+				{
+					renderer.ReleaseLayer(level, index % current.Width, index / current.Width);
+					Discard(node);
+				}
+			}
+		}
+
+		usage.clear();
+		usedBytes = 0;
+	}
+
+	////////////////////////////////////////////////////////////
+	u32 LayerPyramid::GetCount(u32 level, u32 x, u32 y) const
+	{
+		const Level& current = levels[level];
+		return current.Nodes[(usize)y * current.Width + x].Count;
+	}
+
+	////////////////////////////////////////////////////////////
+	u32 LayerPyramid::GetLevelCount() const
+	{
+		return (u32)levels.size();
+	}
+
+	////////////////////////////////////////////////////////////
+	u32 LayerPyramid::GetWidth(u32 level) const
+	{
+		return levels[level].Width;
+	}
+
+	////////////////////////////////////////////////////////////
+	u32 LayerPyramid::GetHeight(u32 level) const
+	{
+		return levels[level].Height;
+	}
+
+	////////////////////////////////////////////////////////////
+	usize LayerPyramid::GetUsedBytes() const
+	{
+		return usedBytes;
+	}
+
+	////////////////////////////////////////////////////////////
+	u32 LayerPyramid::GetBuiltCount() const
+	{
+		return built;
+	}
+
+	////////////////////////////////////////////////////////////
+	bool LayerPyramid::IsCurrent(const Node& node)
+	{
+		return node.Resident && node.Stale == 0 && node.CellCount == 0;
+	}
+
+	////////////////////////////////////////////////////////////
+	void LayerPyramid::Discard(Node& node)
+	{
+		node.Resident = false;
+		node.Complete = false;
+		node.Stale = AllQuadrants;
+		node.Cells.clear();
+		node.CellCount = 0;
+	}
+
+	////////////////////////////////////////////////////////////
+	void LayerPyramid::Touch(Node& node)
+	{
+		if(node.Resident)
+		{
+			node.LastUsed = frame;
+			usage.splice(usage.begin(), usage, node.Position);
+		}
+	}
+
+	////////////////////////////////////////////////////////////
+	void LayerPyramid::Evict(Renderer& renderer, usize reserve)
+	{
+		while(!usage.empty() && usedBytes + reserve > byteBudget)
+		{
+			const u64 key = usage.back();
+			const u32 level = (u32)(key >> 32);
+			const u32 index = (u32)key;
+
+			Level& current = levels[level];
+			Node& node = current.Nodes[index];
+			if(node.LastUsed == frame)
+			{
+				break;
+			}
+
+			renderer.ReleaseLayer(level, index % current.Width, index / current.Width);
+			Discard(node);
+			usedBytes -= layerBytes;
+			usage.pop_back();
+		}
+	}
+
+	////////////////////////////////////////////////////////////
+	bool LayerPyramid::IsOutOfTime() const
+	{
+		return built > 0 && watch.GetElapsedTime() >= budget;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,246 @@
+﻿// 
+// PerformanceOverlay.cpp
+// Core
+// 
+// Created by Felix Busch on 19.10.2026.
+// Copyright © 2026 Felix Busch. All rights reserved.
+// 
+
+#include <Core/Graphics/PerformanceOverlay.hpp>
+#include <Core/Graphics/RenderTarget.hpp>
+#include <Core/Application/Factories.hpp>
+#include <Core/System/Error.hpp>
+#include <Core/System/Profiler.hpp>
+
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <Windows.h>
+#include <psapi.h>
+#include <d2d1.h>
+#include <dwrite.h>
+#include <wrl/client.h>
+
+#include <algorithm>
+#include <cwchar>
+
+#pragma comment(lib, "Psapi")
+
+namespace Core
+{
+	////////////////////////////////////////////////////////////
+	/// \brief The space between the border and the content
+	/// 
+	////////////////////////////////////////////////////////////
+	inline static constexpr float Padding = 8.0f;
+
+	////////////////////////////////////////////////////////////
+	/// \brief The height of the text block
+	/// 
+	////////////////////////////////////////////////////////////
+	inline static constexpr float TextHeight = 78.0f;
+
+	////////////////////////////////////////////////////////////
+	/// \brief The number of frames in the graph, one per pixel
+	/// 
+	////////////////////////////////////////////////////////////
+	inline static constexpr usize GraphFrames = PerformanceOverlay::Width - 2 * (u32)Padding;
+
+	////////////////////////////////////////////////////////////
+	/// \brief Define concrete implementation for the overlay.
+	/// 
+	////////////////////////////////////////////////////////////
+	class PerformanceOverlay::Impl
+	{
+	public:
+
+		////////////////////////////////////////////////////////////
+		/// \brief Create the layer and the text format for a
+		///		   render target.
+		/// 
+		////////////////////////////////////////////////////////////
+		bool Create(ID2D1RenderTarget& target)
+		{
+			Layer.Reset();
+			Bitmap.Reset();
+			Brush.Reset();
+			Owner = &target;
+
+			if(!Format)
+			{
+				IDWriteFactory* writeFactory = Factories::DWriteFactory.Get();
+				if(!writeFactory || FAILED(writeFactory->CreateTextFormat(L"Consolas", nullptr, DWRITE_FONT_WEIGHT_NORMAL, DWRITE_FONT_STYLE_NORMAL, DWRITE_FONT_STRETCH_NORMAL, 12.0f, L"en-us", &Format)))
+				{
+					Err() << "Failed to create the text format of the performance overlay." << std::endl;
+					return false;
+				}
+			}
+
+			// the layer follows the DPI of the target, so the panel scales like the sketch
+			const HRESULT success = target.CreateCompatibleRenderTarget(D2D1::SizeF((float)Width, (float)Height), &Layer);
+
+			if(FAILED(success) || FAILED(Layer->GetBitmap(&Bitmap)))
+			{
+				Err() << "Failed to create the layer of the performance overlay." << std::endl;
+				Layer.Reset();
+				return false;
+			}
+
+			Layer->CreateSolidColorBrush(D2D1::ColorF(D2D1::ColorF::White), &Brush);
+			return Brush != nullptr;
+		}
+
+		////////////////////////////////////////////////////////////
+		/// \brief Render the current numbers into the layer.
+		/// 
+		////////////////////////////////////////////////////////////
+		void Render(const FrameStatistics& statistics, const RenderStats& renderStats, u32 fps, RenderStats& counters)
+		{
+			CORE_PROFILE_SCOPE("PerformanceOverlay::Render");
+
+			const usize frames = std::min(statistics.GetSize(), GraphFrames);
+			const FrameStatistics::Summary summary = statistics.GetSummary(FrameStatistics::Frame, frames);
+			const float budget = statistics.GetBudget().ToMilliseconds<float>();
+
+			PROCESS_MEMORY_COUNTERS_EX memory = {};
+			GetProcessMemoryInfo(GetCurrentProcess(), reinterpret_cast<PROCESS_MEMORY_COUNTERS*>(&memory), sizeof(memory));
+
+			wchar_t text[512];
+			const int length = std::swprintf(text, std::size(text),
+				L"%u fps   frame %.2f ms   budget %.2f ms\n"
+				L"p50 %.2f  p95 %.2f  p99 %.2f  max %.2f\n"
+				L"draw calls %u  transforms %u  culled %u\n"
+				L"brushes %u  strokes %u  paths %u  %.1f KB up\n"
+				L"memory %.1f MB working set, %.1f MB private",
+				fps, summary.Mean.ToMilliseconds<float>(), budget,
+				summary.P50.ToMilliseconds<float>(), summary.P95.ToMilliseconds<float>(), summary.P99.ToMilliseconds<float>(), summary.Max.ToMilliseconds<float>(),
+				renderStats.GetDrawCallCount(), renderStats.TransformChanges, renderStats.CulledPrimitives,
+				renderStats.BrushCreations, renderStats.StrokeStyleCreations, renderStats.PathGeometryCreations, (double)renderStats.UploadedBytes / 1024.0,
+				(double)memory.WorkingSetSize / (1024.0 * 1024.0), (double)memory.PrivateUsage / (1024.0 * 1024.0)
+			);
+
+			ID2D1BitmapRenderTarget& layer = *Layer.Get();
+			layer.BeginDraw();
+			layer.SetTransform(D2D1::Matrix3x2F::Identity());
+			layer.Clear(D2D1::ColorF(0.05f, 0.05f, 0.07f, 0.85f));
+
+			Brush->SetColor(D2D1::ColorF(0.9f, 0.9f, 0.9f));
+			layer.DrawText(text, (UINT32)std::max(length, 0), Format.Get(), D2D1::RectF(Padding, Padding, (float)Width - Padding, Padding + TextHeight), Brush.Get());
+
+			// the graph scales to twice the budget, or further if a frame took longer
+			const D2D1_RECT_F graph = D2D1::RectF(Padding, Padding * 2.0f + TextHeight, (float)Width - Padding, (float)Height - Padding);
+			const float graphHeight = graph.bottom - graph.top;
+			const float scale = std::max({ budget * 2.0f, summary.Max.ToMilliseconds<float>(), 1.0f });
+
+			Brush->SetColor(D2D1::ColorF(1.0f, 1.0f, 1.0f, 0.08f));
+			layer.FillRectangle(graph, Brush.Get());
+
+			if(budget > 0.0f)
+			{
+				const float y = graph.bottom - budget / scale * graphHeight;
+				Brush->SetColor(D2D1::ColorF(0.9f, 0.35f, 0.3f));
+				layer.DrawLine(D2D1::Point2F(graph.left, y), D2D1::Point2F(graph.right, y), Brush.Get());
+			}
+
+			// all frames go into a single geometry, the newest one on the right
+			Microsoft::WRL::ComPtr<ID2D1PathGeometry> geometry;
+			Microsoft::WRL::ComPtr<ID2D1GeometrySink> sink;
+
+			if(frames > 1 && SUCCEEDED(Factories::D2DFactory->CreatePathGeometry(&geometry)) && SUCCEEDED(geometry->Open(&sink)))
+			{
+				++counters.PathGeometryCreations;
+
+				const auto pointOf = [&](usize age)
+				{
+					const float value = std::min(statistics.GetSample(age).FrameTime.ToMilliseconds<float>(), scale);
+					return D2D1::Point2F(graph.right - (float)age, graph.bottom - value / scale * graphHeight);
+				};
+
+				sink->BeginFigure(pointOf(frames - 1), D2D1_FIGURE_BEGIN_HOLLOW);
+				for(usize age = frames - 1; age-- > 0;)
+				{
+					sink->AddLine(pointOf(age));
+				}
+
+				sink->EndFigure(D2D1_FIGURE_END_OPEN);
+
+				if(SUCCEEDED(sink->Close()))
+				{
+					Brush->SetColor(D2D1::ColorF(0.4f, 0.85f, 0.45f));
+					layer.DrawGeometry(geometry.Get(), Brush.Get());
+				}
+			}
+
+			if(FAILED(layer.EndDraw()))
+			{
+				// try again with a new layer
+				Layer.Reset();
+				Bitmap.Reset();
+			}
+		}
+
+		////////////////////////////////////////////////////////////
+		/// Member data
+		/// 
+		////////////////////////////////////////////////////////////
+		Microsoft::WRL::ComPtr<ID2D1BitmapRenderTarget>	Layer;			///< The cached panel
+		Microsoft::WRL::ComPtr<ID2D1Bitmap>				Bitmap;			///< The bitmap of the layer
+		Microsoft::WRL::ComPtr<ID2D1SolidColorBrush>	Brush;			///< The brush for everything in the layer
+		Microsoft::WRL::ComPtr<IDWriteTextFormat>		Format;			///< The font of the readouts
+		ID2D1RenderTarget*								Owner = nullptr;	///< The render target the layer was created for
+
+	};
+
+	////////////////////////////////////////////////////////////
+	PerformanceOverlay::PerformanceOverlay():
+		impl(std::make_unique<Impl>()),
+		positionX(8.0f),
+		positionY(8.0f),
+		refreshInterval(Milliseconds(100))
+	{
+	}
+
+	////////////////////////////////////////////////////////////
+	PerformanceOverlay::~PerformanceOverlay() = default;
+
+	////////////////////////////////////////////////////////////
+	void PerformanceOverlay::Draw(RenderTarget& target, const FrameStatistics& statistics, const RenderStats& renderStats, u32 fps)
+	{
+		CORE_PROFILE_SCOPE("PerformanceOverlay::Draw");
+
+		ID2D1RenderTarget& d2dTarget = target.GetRenderTarget();
+		const bool created = impl->Layer && impl->Owner == &d2dTarget;
+
+		if(!created)
+		{
+			if(!impl->Create(d2dTarget))
+				return;
+		}
+
+		if(!created || !sinceRefresh.IsTicking() || sinceRefresh.GetElapsedTime() >= refreshInterval)
+		{
+			impl->Render(statistics, renderStats, fps, target.GetRenderStats());
+			sinceRefresh.Restart();
+		}
+
+		target.ScreenImage(impl->Bitmap.Get(), FloatRect(positionX, positionY, (float)Width, (float)Height), 1.0f);
+	}
+
+	////////////////////////////////////////////////////////////
+	void PerformanceOverlay::SetPosition(float x, float y)
+	{
+		positionX = x;
+		positionY = y;
+	}
+
+	////////////////////////////////////////////////////////////
+	void PerformanceOverlay::SetRefreshInterval(const Time& interval)
+	{
+		refreshInterval = interval;
+	}
+
+	////////////////////////////////////////////////////////////
+	const Time& PerformanceOverlay::GetRefreshInterval() const
+	{
+		return refreshInterval;
+	}
+}
\ No newline at end of file
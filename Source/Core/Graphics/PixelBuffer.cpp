@@ -0,0 +1,212 @@
+﻿// 
+// PixelBuffer.cpp
+// Core
+// 
+// Created by Felix Busch on 19.10.2026.
+// Copyright © 2026 Felix Busch. All rights reserved.
+// 
+
+#include <Core/Graphics/PixelBuffer.hpp>
+
+#include <algorithm>
+
+namespace Core
+{
+	////////////////////////////////////////////////////////////
+	PixelBuffer::PixelBuffer():
+		width(0),
+		height(0),
+		dirtyLeft(0),
+		dirtyRight(0),
+		dirty(false)
+	{
+	}
+
+	////////////////////////////////////////////////////////////
+	void PixelBuffer::Resize(u32 width, u32 height)
+	{
+		this->width = width;
+		this->height = height;
+
+		pixels.assign((usize)width * (usize)height, 0);
+		dirtyRows.assign(((usize)height + 63) / 64, 0);
+		ClearDirty();
+	}
+
+	////////////////////////////////////////////////////////////
+	void PixelBuffer::Release()
+	{
+		pixels = {};
+		dirtyRows = {};
+		width = 0;
+		height = 0;
+		ClearDirty();
+	}
+
+	////////////////////////////////////////////////////////////
+	u32* PixelBuffer::GetPixels()
+	{
+		return pixels.data();
+	}
+
+	////////////////////////////////////////////////////////////
+	const u32* PixelBuffer::GetPixels() const
+	{
+		return pixels.data();
+	}
+
+	////////////////////////////////////////////////////////////
+	u32* PixelBuffer::GetRow(u32 y)
+	{
+		return pixels.data() + (usize)y * width;
+	}
+
+	////////////////////////////////////////////////////////////
+	const u32* PixelBuffer::GetRow(u32 y) const
+	{
+		return pixels.data() + (usize)y * width;
+	}
+
+	////////////////////////////////////////////////////////////
+	u32 PixelBuffer::GetWidth() const
+	{
+		return width;
+	}
+
+	////////////////////////////////////////////////////////////
+	u32 PixelBuffer::GetHeight() const
+	{
+		return height;
+	}
+
+	////////////////////////////////////////////////////////////
+	u32 PixelBuffer::GetPitch() const
+	{
+		return width * (u32)sizeof(u32);
+	}
+
+	////////////////////////////////////////////////////////////
+	bool PixelBuffer::IsEmpty() const
+	{
+		return pixels.empty();
+	}
+
+	////////////////////////////////////////////////////////////
+	void PixelBuffer::SetPixel(u32 x, u32 y, u32 pixel)
+	{
+		if(x < width && y < height)
+		{
+			pixels[(usize)y * width + x] = pixel;
+			MarkRows(x, y, x + 1, y + 1);
+		}
+	}
+
+	////////////////////////////////////////////////////////////
+	void PixelBuffer::SetPixel(u32 x, u32 y, const Color& color)
+	{
+		SetPixel(x, y, Pack(color));
+	}
+
+	////////////////////////////////////////////////////////////
+	u32 PixelBuffer::GetPixel(u32 x, u32 y) const
+	{
+		if(x < width && y < height)
+		{
+			return pixels[(usize)y * width + x];
+		}
+
+		return 0;
+	}
+
+	////////////////////////////////////////////////////////////
+	void PixelBuffer::MarkDirty()
+	{
+		MarkRows(0, 0, width, height);
+	}
+
+	////////////////////////////////////////////////////////////
+	void PixelBuffer::MarkDirty(const IntRect& region)
+	{
+		// clip the region against the buffer boundary
+		const i64 left   = std::clamp<i64>(region.Left, 0, width);
+		const i64 top    = std::clamp<i64>(region.Top, 0, height);
+		const i64 right  = std::clamp<i64>((i64)region.Left + region.Width, 0, width);
+		const i64 bottom = std::clamp<i64>((i64)region.Top + region.Height, 0, height);
+
+		if(left < right && top < bottom)
+		{
+			MarkRows((u32)left, (u32)top, (u32)right, (u32)bottom);
+		}
+	}
+
+	////////////////////////////////////////////////////////////
+	bool PixelBuffer::IsDirty() const
+	{
+		return dirty;
+	}
+
+	////////////////////////////////////////////////////////////
+	void PixelBuffer::GetDirtySpans(std::vector<DirtySpan>& spans) const
+	{
+		spans.clear();
+
+		if(!dirty)
+		{
+			return;
+		}
+
+		u32 y = 0;
+		while(y < height)
+		{
+			// skip 64 clean rows at once
+			if((y & 63) == 0 && dirtyRows[y / 64] == 0)
+			{
+				y += 64;
+				continue;
+			}
+
+			if(!IsRowDirty(y))
+			{
+				++y;
+				continue;
+			}
+
+			// merge consecutive dirty rows into a single span
+			const u32 top = y;
+			while(y < height && IsRowDirty(y))
+			{
+				++y;
+			}
+
+			spans.push_back({ dirtyLeft, top, dirtyRight, y });
+		}
+	}
+
+	////////////////////////////////////////////////////////////
+	void PixelBuffer::ClearDirty()
+	{
+		std::ranges::fill(dirtyRows, 0);
+		dirtyLeft = width;
+		dirtyRight = 0;
+		dirty = false;
+	}
+
+	////////////////////////////////////////////////////////////
+	void PixelBuffer::MarkRows(u32 left, u32 top, u32 right, u32 bottom)
+	{
+		for(u32 y = top; y < bottom; ++y)
+		{
+			dirtyRows[y / 64] |= (u64)1 << (y & 63);
+		}
+
+		dirtyLeft = std::min(dirtyLeft, left);
+		dirtyRight = std::max(dirtyRight, right);
+		dirty = true;
+	}
+
+	////////////////////////////////////////////////////////////
+	bool PixelBuffer::IsRowDirty(u32 y) const
+	{
+		return (dirtyRows[y / 64] >> (y & 63)) & 1;
+	}
+}
\ No newline at end of file
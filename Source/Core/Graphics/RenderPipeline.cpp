@@ -0,0 +1,183 @@
+﻿// 
+// RenderPipeline.cpp
+// Core
+// 
+// Created by Felix Busch on 19.10.2026.
+// Copyright © 2026 Felix Busch. All rights reserved.
+// 
+
+#include <Core/Graphics/RenderPipeline.hpp>
+#include <Core/Graphics/GraphicsContext.hpp>
+
+#include <Core/System/Stopwatch.hpp>
+#include <Core/System/Profiler.hpp>
+
+namespace Core
+{
+	////////////////////////////////////////////////////////////
+	RenderPipeline::RenderPipeline(GraphicsContext& graphics):
+		graphics(graphics),
+		recordIndex(0),
+		pending(nullptr),
+		stopping(false),
+		failed(false),
+		submitTime(Time::Zero)
+	{
+	}
+
+	////////////////////////////////////////////////////////////
+	RenderPipeline::~RenderPipeline()
+	{
+		Stop();
+	}
+
+	////////////////////////////////////////////////////////////
+	void RenderPipeline::Start()
+	{
+		if(thread.joinable())
+			return;
+
+		stopping = false;
+		failed = false;
+		thread = std::thread(&RenderPipeline::SubmitThreadImpl, this);
+	}
+
+	////////////////////////////////////////////////////////////
+	void RenderPipeline::Stop()
+	{
+		if(!thread.joinable())
+			return;
+
+		{
+			std::unique_lock lock(mutex);
+			WaitForSubmission(lock);
+			stopping = true;
+		}
+
+		condition.notify_all();
+		thread.join();
+
+		// draw directly again
+		graphics.SetCommandList(nullptr);
+	}
+
+	////////////////////////////////////////////////////////////
+	bool RenderPipeline::IsRunning() const
+	{
+		return thread.joinable();
+	}
+
+	////////////////////////////////////////////////////////////
+	void RenderPipeline::BeginFrame()
+	{
+		// the list has been submitted two frames ago, release what it still references
+		CommandList& commandList = commandLists[recordIndex];
+		commandList.Reset();
+
+		graphics.SetCommandList(&commandList);
+	}
+
+	////////////////////////////////////////////////////////////
+	bool RenderPipeline::EndFrame()
+	{
+		graphics.SetCommandList(nullptr);
+
+		{
+			std::unique_lock lock(mutex);
+
+			// bound the latency: only one frame may be in flight
+			const Stopwatch stall = Stopwatch::StartNew();
+			WaitForSubmission(lock);
+			stallTimes.Record(stall.GetElapsedTime());
+
+			// nothing was submitted before the first frame
+			if(submitTime > Time::Zero)
+			{
+				submitTimes.Record(submitTime);
+				submitTime = Time::Zero;
+			}
+
+			if(failed)
+			{
+				return false;
+			}
+
+			pending = &commandLists[recordIndex];
+		}
+
+		condition.notify_all();
+		recordIndex ^= 1;
+		return true;
+	}
+
+	////////////////////////////////////////////////////////////
+	const std::optional<Time>& RenderPipeline::GetPresentTimestamp() const
+	{
+		return presentTimestamp;
+	}
+
+	////////////////////////////////////////////////////////////
+	const LatencyHistogram& RenderPipeline::GetSubmitTimes() const
+	{
+		return submitTimes;
+	}
+
+	////////////////////////////////////////////////////////////
+	const LatencyHistogram& RenderPipeline::GetStallTimes() const
+	{
+		return stallTimes;
+	}
+
+	////////////////////////////////////////////////////////////
+	void RenderPipeline::SubmitThreadImpl()
+	{
+		CORE_PROFILE_THREAD("Submit Thread");
+
+		std::unique_lock lock(mutex);
+
+		while(true)
+		{
+			condition.wait(lock, [this] { return pending != nullptr || stopping; });
+
+			if(stopping)
+				break;
+
+			CommandList& commandList = *pending;
+			lock.unlock();
+
+			// replay the recorded frame
+			CORE_PROFILE_SCOPE("Submit");
+			const Stopwatch submission = Stopwatch::StartNew();
+			std::optional<Time> presented;
+			bool success = true;
+
+			if(graphics.BeginDraw())
+			{
+				commandList.Execute(graphics.GetRenderTarget());
+
+				CORE_PROFILE_SCOPE("EndDraw");
+				success = graphics.EndDraw();
+
+				if(success)
+				{
+					presented = Stopwatch::GetTimestamp();
+				}
+			}
+
+			const Time elapsed = submission.GetElapsedTime();
+
+			lock.lock();
+			presentTimestamp = presented;
+			submitTime = elapsed;
+			failed = failed || !success;
+			pending = nullptr;
+			condition.notify_all();
+		}
+	}
+
+	////////////////////////////////////////////////////////////
+	void RenderPipeline::WaitForSubmission(std::unique_lock<std::mutex>& lock)
+	{
+		condition.wait(lock, [this] { return pending == nullptr; });
+	}
+}
\ No newline at end of file
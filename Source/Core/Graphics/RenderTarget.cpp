@@ -9,16 +9,23 @@
 #include <Core/Graphics/RenderTarget.hpp>
 #include <Core/Graphics/Shape.hpp>
 #include <Core/Graphics/Texture.hpp>
+#include <Core/System/Error.hpp>
 
 #define WIN32_LEAN_AND_MEAN
 #define NOMINMAX
 #include <d2d1.h>
 
+#include <cstring>
+
 namespace Core
 {
 
 	////////////////////////////////////////////////////////////
-	RenderTarget::RenderTarget()
+	RenderTarget::RenderTarget():
+		commandList(nullptr),
+		reported(false),
+		transform(),
+		transformSet(false)
 	{
 		// push the initial rendering style
 		PushStyle();
@@ -27,6 +34,14 @@ namespace Core
 	////////////////////////////////////////////////////////////
 	void RenderTarget::Background(const Color& color)
 	{
+		++stats.Clears;
+
+		if(commandList)
+		{
+			commandList->Background(color);
+			return;
+		}
+
 		ID2D1RenderTarget& rt = GetRenderTarget();
 		rt.Clear(D2D1::ColorF(
 			(float)color.R / 255.0f,
@@ -79,9 +94,7 @@ namespace Core
 	////////////////////////////////////////////////////////////
 	void RenderTarget::Rect(float x1, float y1, float x2, float y2, float cornerX, float cornerY)
 	{
-		ID2D1RenderTarget& target = GetRenderTarget();
 		const RenderStyle& style = GetRenderStyle();
-		target.SetTransform(reinterpret_cast<const D2D1_MATRIX_3X2_F&>(GetTransform().GetTransform()));
 
 		D2D1_RECT_F rect = {};
 		switch(style.RectMode)
@@ -97,6 +110,19 @@ namespace Core
 			} break;
 		}
 
+		if(!CountDraw(stats.Rectangles, style.ActiveFill, style.ActiveStroke))
+			return;
+
+		if(commandList)
+		{
+			ChangeTransform(GetTransform().GetTransform());
+			commandList->RoundedRectangle(GetTransform().GetTransform(), FloatRect(rect.left, rect.top, rect.right - rect.left, rect.bottom - rect.top), cornerX, cornerY, GetPaint());
+			return;
+		}
+
+		ID2D1RenderTarget& target = GetRenderTarget();
+		ApplyTransform(target);
+
 		const D2D1_ROUNDED_RECT roundedRect = D2D1::RoundedRect(rect, cornerX, cornerY);
 
 		if(ID2D1Brush* brush = style.ActiveFill)
@@ -120,8 +146,6 @@ namespace Core
 	void RenderTarget::Ellipse(float a, float b, float c, float d)
 	{
 		const RenderStyle& style = GetRenderStyle();
-		ID2D1RenderTarget& target = GetRenderTarget();
-		target.SetTransform(reinterpret_cast<const D2D1_MATRIX_3X2_F&>(GetTransform().GetTransform()));
 
 		D2D1_ELLIPSE ellipse = {};
 
@@ -163,6 +187,19 @@ namespace Core
 			} break;
 		}
 
+		if(!CountDraw(stats.Ellipses, style.ActiveFill, style.ActiveStroke))
+			return;
+
+		if(commandList)
+		{
+			ChangeTransform(GetTransform().GetTransform());
+			commandList->Ellipse(GetTransform().GetTransform(), ellipse.point.x, ellipse.point.y, ellipse.radiusX, ellipse.radiusY, GetPaint());
+			return;
+		}
+
+		ID2D1RenderTarget& target = GetRenderTarget();
+		ApplyTransform(target);
+
 		if (ID2D1Brush* brush = style.ActiveFill)
 		{
 			target.FillEllipse(ellipse, brush);
@@ -177,9 +214,21 @@ namespace Core
 	////////////////////////////////////////////////////////////
 	void RenderTarget::Line(float x1, float y1, float x2, float y2)
 	{
-		ID2D1RenderTarget& target = GetRenderTarget();
 		const RenderStyle& style = GetRenderStyle();
-		target.SetTransform(reinterpret_cast<const D2D1_MATRIX_3X2_F&>(GetTransform().GetTransform()));
+
+		// lines have no fill
+		if(!CountDraw(stats.Lines, false, style.ActiveStroke))
+			return;
+
+		if(commandList)
+		{
+			ChangeTransform(GetTransform().GetTransform());
+			commandList->Line(GetTransform().GetTransform(), x1, y1, x2, y2, GetPaint());
+			return;
+		}
+
+		ID2D1RenderTarget& target = GetRenderTarget();
+		ApplyTransform(target);
 
 		if (ID2D1Brush* brush = style.ActiveStroke)
 		{
@@ -366,23 +415,18 @@ namespace Core
 		// make sure there is a bitmap to render
 		if(ID2D1Bitmap* bitmap = texture.GetBitmap())
 		{
-			ID2D1RenderTarget& target = GetRenderTarget();
 			const RenderStyle& style = GetRenderStyle();
+			const FloatRect rectangle = GetImageRectangle(a, b, c, d);
+			++stats.Bitmaps;
 
-			const float x1 = a, y1 = b, x2 = c, y2 = d;
-			D2D1_RECT_F destinationRectangle;
-			switch(style.ImageMode)
+			if(commandList)
 			{
-				default:
-				case Corner:	destinationRectangle = D2D1::RectF(x1, y1, x1 + x2, y1 + y2); break;
-				case Corners:	destinationRectangle = D2D1::RectF(x1, y1, x2, y2); break;
-				case Center:	destinationRectangle = D2D1::RectF(x1 - x2 / 2.0f, y1 - y2 / 2.0f, x1 + x2 / 2.0f, y1 + y2 / 2.0f); break;
-				case Radius:
-				{
-					const float width = x2 * 2.0f, height = y2 * 2.0f;
-					destinationRectangle = D2D1::RectF(x1 - width / 2.0f, y1 - height / 2.0f, x1 + width / 2.0f, y1 + height / 2.0f);
-				} break;
+				commandList->Bitmap(bitmap, rectangle, (float)style.TextureOpacity / 255.0f, style.TextureSampleMode, sourceRectangle);
+				return;
 			}
+
+			ID2D1RenderTarget& target = GetRenderTarget();
+			const D2D1_RECT_F destinationRectangle = D2D1::RectF(rectangle.Left, rectangle.Top, rectangle.Left + rectangle.Width, rectangle.Top + rectangle.Height);
 			
 			target.DrawBitmap(
 				bitmap,
@@ -394,14 +438,250 @@ namespace Core
 		}
 	}
 
+	////////////////////////////////////////////////////////////
+	u32* RenderTarget::LoadPixels()
+	{
+		if(commandList)
+		{
+			ReportNotRecordable("LoadPixels()");
+			return nullptr;
+		}
+
+		// (re)create the framebuffer texture whenever the size of the target changed
+		const D2D1_SIZE_U size = GetRenderTarget().GetPixelSize();
+		const PixelBuffer& pixels = framebuffer.GetPixelBuffer();
+		if(framebuffer.GetBitmap() == nullptr || pixels.GetWidth() != size.width || pixels.GetHeight() != size.height)
+		{
+			if(!framebuffer.Create(size.width, size.height))
+			{
+				return nullptr;
+			}
+		}
+
+		return framebuffer.LoadPixels();
+	}
+
+	////////////////////////////////////////////////////////////
+	void RenderTarget::UpdatePixels()
+	{
+		if(commandList)
+		{
+			ReportNotRecordable("UpdatePixels()");
+			return;
+		}
+
+		if(framebuffer.GetBitmap() != nullptr)
+		{
+			framebuffer.UpdatePixels();
+			DrawPixels();
+		}
+	}
+
+	////////////////////////////////////////////////////////////
+	void RenderTarget::UpdatePixels(i32 x, i32 y, i32 width, i32 height)
+	{
+		if(commandList)
+		{
+			ReportNotRecordable("UpdatePixels()");
+			return;
+		}
+
+		if(framebuffer.GetBitmap() != nullptr)
+		{
+			framebuffer.UpdatePixels(x, y, width, height);
+			DrawPixels();
+		}
+	}
+
+	////////////////////////////////////////////////////////////
+	PixelBuffer& RenderTarget::GetPixelBuffer()
+	{
+		return framebuffer.GetPixelBuffer();
+	}
+
+	////////////////////////////////////////////////////////////
+	void RenderTarget::Filter(ImageFilter::Type type)
+	{
+		if(LoadPixels())
+		{
+			ImageFilter::Apply(framebuffer.GetPixelBuffer(), type);
+			UpdatePixels();
+		}
+	}
+
+	////////////////////////////////////////////////////////////
+	void RenderTarget::Filter(ImageFilter::Type type, float parameter)
+	{
+		if(LoadPixels())
+		{
+			ImageFilter::Apply(framebuffer.GetPixelBuffer(), type, parameter);
+			UpdatePixels();
+		}
+	}
+
+	////////////////////////////////////////////////////////////
+	void RenderTarget::Filter(const float* kernel, u32 size)
+	{
+		if(LoadPixels())
+		{
+			ImageFilter::Convolve(framebuffer.GetPixelBuffer(), kernel, size);
+			UpdatePixels();
+		}
+	}
+
+	////////////////////////////////////////////////////////////
+	FloatRect RenderTarget::GetImageRectangle(float a, float b, float c, float d) const
+	{
+		const float x1 = a, y1 = b, x2 = c, y2 = d;
+		switch(GetRenderStyle().ImageMode)
+		{
+			default:
+			case Corner:	return FloatRect(x1, y1, x2, y2);
+			case Corners:	return FloatRect(x1, y1, x2 - x1, y2 - y1);
+			case Center:	return FloatRect(x1 - x2 / 2.0f, y1 - y2 / 2.0f, x2, y2);
+			case Radius:	return FloatRect(x1 - x2, y1 - y2, x2 * 2.0f, y2 * 2.0f);
+		}
+	}
+
+	////////////////////////////////////////////////////////////
+	void RenderTarget::DrawPixels()
+	{
+		// the pixels map 1:1 onto the target, ignore the current transformation
+		ID2D1RenderTarget& target = GetRenderTarget();
+		const D2D1_SIZE_F size = target.GetSize();
+		target.SetTransform(D2D1::Matrix3x2F::Identity());
+		++stats.TransformChanges;
+		++stats.Bitmaps;
+
+		// the next primitive has to restore its transformation
+		transformSet = false;
+
+		target.DrawBitmap(
+			framebuffer.GetBitmap(),
+			D2D1::RectF(0.0f, 0.0f, size.width, size.height),
+			1.0f,
+			D2D1_BITMAP_INTERPOLATION_MODE_NEAREST_NEIGHBOR
+		);
+	}
+
+	////////////////////////////////////////////////////////////
+	void RenderTarget::Image(TiledTexture& texture, float a, float b)
+	{
+		const Float2& size = texture.GetSize();
+		Image(texture, a, b, size.X, size.Y);
+	}
+
+	////////////////////////////////////////////////////////////
+	void RenderTarget::Image(TiledTexture& texture, float a, float b, float c, float d)
+	{
+		if(commandList)
+		{
+			ReportNotRecordable("Image(TiledTexture&)");
+			return;
+		}
+
+		ID2D1RenderTarget& target = GetRenderTarget();
+		const RenderStyle& style = GetRenderStyle();
+
+		// the visible tiles are determined through the transformation
+		ApplyTransform(target);
+
+		texture.Draw(
+			target,
+			GetImageRectangle(a, b, c, d),
+			(float)style.TextureOpacity / 255.0f,
+			style.TextureSampleMode,
+			&stats
+		);
+	}
+
+	////////////////////////////////////////////////////////////
+	void RenderTarget::Image(TileMap& map, float a, float b)
+	{
+		const Float2& size = map.GetSize();
+		Image(map, a, b, size.X, size.Y);
+	}
+
+	////////////////////////////////////////////////////////////
+	void RenderTarget::Image(TileMap& map, float a, float b, float c, float d)
+	{
+		if(commandList)
+		{
+			ReportNotRecordable("Image(TileMap&)");
+			return;
+		}
+
+		ID2D1RenderTarget& target = GetRenderTarget();
+		const RenderStyle& style = GetRenderStyle();
+
+		// the visible chunks are determined through the transformation
+		ApplyTransform(target);
+
+		map.Draw(
+			target,
+			GetImageRectangle(a, b, c, d),
+			(float)style.TextureOpacity / 255.0f,
+			style.TextureSampleMode,
+			&stats
+		);
+	}
+
+	////////////////////////////////////////////////////////////
+	void RenderTarget::ScreenImage(ID2D1Bitmap* bitmap, const FloatRect& destination, float opacity)
+	{
+		if(!bitmap)
+			return;
+
+		const Matrix3x2 identity = { 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f };
+		const D2D1_SIZE_F size = bitmap->GetSize();
+		const FloatRect source(0.0f, 0.0f, size.width, size.height);
+		const bool changed = ChangeTransform(identity);
+		++stats.Bitmaps;
+
+		if(commandList)
+		{
+			if(changed)
+			{
+				commandList->Transform(identity);
+			}
+
+			commandList->Bitmap(bitmap, destination, opacity, Texture::SampleMode::NearestNeighbor, source);
+			return;
+		}
+
+		ID2D1RenderTarget& target = GetRenderTarget();
+		if(changed)
+		{
+			target.SetTransform(D2D1::Matrix3x2F::Identity());
+		}
+
+		target.DrawBitmap(
+			bitmap,
+			D2D1::RectF(destination.Left, destination.Top, destination.Left + destination.Width, destination.Top + destination.Height),
+			opacity,
+			D2D1_BITMAP_INTERPOLATION_MODE_NEAREST_NEIGHBOR
+		);
+	}
+
 	////////////////////////////////////////////////////////////
 	void RenderTarget::Geometry(const Shape& shape)
 	{
 		if (ID2D1Geometry* geometry = shape.GetGeometry())
 		{
-			ID2D1RenderTarget& target = GetRenderTarget();
 			const RenderStyle& style = GetRenderStyle();
-			target.SetTransform(reinterpret_cast<const D2D1_MATRIX_3X2_F&>(GetTransform().GetTransform()));
+
+			if(!CountDraw(stats.Geometries, style.ActiveFill, style.ActiveStroke))
+				return;
+
+			if(commandList)
+			{
+				ChangeTransform(GetTransform().GetTransform());
+				commandList->Geometry(GetTransform().GetTransform(), geometry, GetPaint());
+				return;
+			}
+
+			ID2D1RenderTarget& target = GetRenderTarget();
+			ApplyTransform(target);
 
 			if (ID2D1Brush* brush = style.ActiveFill)
 			{
@@ -438,4 +718,105 @@ namespace Core
 	{
 		return geometry;
 	}
+
+	////////////////////////////////////////////////////////////
+	void RenderTarget::SetCommandList(CommandList* commandList)
+	{
+		this->commandList = commandList;
+	}
+
+	////////////////////////////////////////////////////////////
+	CommandList* RenderTarget::GetCommandList() const
+	{
+		return commandList;
+	}
+
+	////////////////////////////////////////////////////////////
+	const RenderStats& RenderTarget::GetRenderStats() const
+	{
+		return stats;
+	}
+
+	////////////////////////////////////////////////////////////
+	RenderStats& RenderTarget::GetRenderStats()
+	{
+		return stats;
+	}
+
+	////////////////////////////////////////////////////////////
+	const RenderStats& RenderTarget::GetPreviousRenderStats() const
+	{
+		return previousStats;
+	}
+
+	////////////////////////////////////////////////////////////
+	void RenderTarget::ResetRenderStats()
+	{
+		previousStats = stats;
+		stats = RenderStats();
+
+		// the target may have been drawn to by someone else in between (e.g. a command list replay)
+		transformSet = false;
+	}
+
+	////////////////////////////////////////////////////////////
+	CommandList::Paint RenderTarget::GetPaint() const
+	{
+		const RenderStyle& style = GetRenderStyle();
+
+		CommandList::Paint paint = {};
+		paint.Fill			= style.SolidFill.GetColor();
+		paint.Stroke		= style.SolidStroke.GetColor();
+		paint.HasFill		= style.ActiveFill != nullptr;
+		paint.HasStroke		= style.ActiveStroke != nullptr;
+		paint.StrokeWeight	= style.StrokeWeight;
+		paint.StrokeStyle	= style.StrokeStyle.GetStyleStroke();
+		return paint;
+	}
+
+	////////////////////////////////////////////////////////////
+	void RenderTarget::ReportNotRecordable(const char* function)
+	{
+		if(!reported)
+		{
+			Err() << function << " can't be used while the draw commands are recorded (pipelined rendering), the call is skipped" << std::endl;
+			reported = true;
+		}
+	}
+
+	////////////////////////////////////////////////////////////
+	bool RenderTarget::CountDraw(u32& counter, bool hasFill, bool hasStroke)
+	{
+		if(!hasFill && !hasStroke)
+		{
+			++stats.CulledPrimitives;
+			return false;
+		}
+
+		counter += (u32)hasFill + (u32)hasStroke;
+		return true;
+	}
+
+	////////////////////////////////////////////////////////////
+	bool RenderTarget::ChangeTransform(const Matrix3x2& transform)
+	{
+		if(transformSet && std::memcmp(this->transform.Data, transform.Data, sizeof(transform.Data)) == 0)
+			return false;
+
+		this->transform = transform;
+		transformSet = true;
+		++stats.TransformChanges;
+		return true;
+	}
+
+	////////////////////////////////////////////////////////////
+	void RenderTarget::ApplyTransform(ID2D1RenderTarget& target)
+	{
+		const Matrix3x2& transform = GetTransform().GetTransform();
+
+		if(ChangeTransform(transform))
+		{
+			target.SetTransform(reinterpret_cast<const D2D1_MATRIX_3X2_F&>(transform));
+		}
+	}
 }
@@ -8,7 +8,9 @@
 
 #include <Core/Graphics/Shape.hpp>
 #include <Core/System/Error.hpp>
+#include <Core/System/Profiler.hpp>
 #include <Core/Application/Factories.hpp>
+#include <Core/Application/Application.hpp>
 
 #define WIN32_LEAN_AND_MEAN
 #define NOMINMAX
@@ -99,6 +101,11 @@ namespace Core
 			return *this;
 		}
 
+		if(Application::Instance)
+		{
+			++Application::Instance->Graphics.GetRenderStats().PathGeometryCreations;
+		}
+
 		impl->Sink.Reset();
 		
 		isBuilding = true;
@@ -200,6 +207,8 @@ namespace Core
 	////////////////////////////////////////////////////////////
 	Shape& Shape::End(ShapeEnd style)
 	{
+		CORE_PROFILE_SCOPE("Shape::End");
+
 		if(!isBuilding)
 		{
 			Err() << "Unacceptable method call to End(). Make sure to call Begin() before calling End()" << std::endl;
@@ -37,7 +37,9 @@ namespace Core
 
 			if (brush == nullptr)
 			{
-				GetGraphics().GetRenderTarget().CreateSolidColorBrush(d2dColor, &brush);
+				GraphicsContext& graphics = GetGraphics();
+				graphics.GetRenderTarget().CreateSolidColorBrush(d2dColor, &brush);
+				++graphics.GetRenderStats().BrushCreations;
 			} else
 			{
 				brush->SetColor(d2dColor);
@@ -8,6 +8,7 @@
 
 #include <Core/Graphics/StrokeStyle.hpp>
 #include <Core/Application/Factories.hpp>
+#include <Core/Application/Application.hpp>
 #include <Core/System/Error.hpp>
 
 #define WIN32_LEAN_AND_MEAN
@@ -137,6 +138,11 @@ namespace Core
 					return nullptr;
 				}
 
+				if(Application::Instance)
+				{
+					++Application::Instance->Graphics.GetRenderStats().StrokeStyleCreations;
+				}
+
 				updated = true;
 			}
 		}
@@ -8,6 +8,7 @@
 
 #include <Core/Graphics/Texture.hpp>
 #include <Core/System/Error.hpp>
+#include <Core/System/Profiler.hpp>
 #include <Core/Application/Factories.hpp>
 #include <Core/Application/Application.hpp>
 
@@ -17,8 +18,22 @@
 #include <wincodec.h>
 #include <wrl/client.h>
 
+#include <algorithm>
+
 namespace Core
 {
+	////////////////////////////////////////////////////////////
+	/// \brief Add uploaded pixels to the counters of the frame.
+	/// 
+	////////////////////////////////////////////////////////////
+	static void CountUpload(u64 bytes)
+	{
+		if(Application::Instance)
+		{
+			Application::Instance->Graphics.GetRenderStats().UploadedBytes += bytes;
+		}
+	}
+
 	////////////////////////////////////////////////////////////
 	/// \brief Define concrete implementation for the texture
 	///		   class.
@@ -28,11 +43,145 @@ namespace Core
 	{
 	public:
 
+		////////////////////////////////////////////////////////////
+		/// \brief Fill the pixel buffer by decoding the region of
+		///		   the image file again.
+		/// 
+		///	The decoder is released afterwards, so loaded textures
+		///	don't keep their file open.
+		/// 
+		////////////////////////////////////////////////////////////
+		bool ReadPixels()
+		{
+			using Microsoft::WRL::ComPtr;
+
+			if(Filepath.empty())
+			{
+				Err() << "Failed to read the pixels of a texture that was neither loaded from a file nor created from pixels." << std::endl;
+				return false;
+			}
+
+			IWICImagingFactory* imagingFactory = Factories::ImagingFactory.Get();
+			if(!imagingFactory)
+			{
+				Err() << "There is no imaging factory. Make sure to setup the imaging factory before reading the pixels of a texture." << std::endl;
+				return false;
+			}
+
+			ComPtr<IWICBitmapDecoder> decoder = nullptr;
+			ComPtr<IWICBitmapFrameDecode> frame = nullptr;
+			ComPtr<IWICFormatConverter> converter = nullptr;
+			ComPtr<IWICBitmapClipper> clipper = nullptr;
+
+			const bool ready =
+				SUCCEEDED(imagingFactory->CreateDecoderFromFilename(Filepath.wstring().c_str(), nullptr, GENERIC_READ, WICDecodeMetadataCacheOnDemand, &decoder)) &&
+				SUCCEEDED(decoder->GetFrame(0, &frame)) &&
+				SUCCEEDED(imagingFactory->CreateFormatConverter(&converter)) &&
+				SUCCEEDED(converter->Initialize(frame.Get(), GUID_WICPixelFormat32bppPBGRA, WICBitmapDitherTypeNone, nullptr, 0.0, WICBitmapPaletteTypeMedianCut)) &&
+				SUCCEEDED(imagingFactory->CreateBitmapClipper(&clipper)) &&
+				SUCCEEDED(clipper->Initialize(converter.Get(), &Region));
+
+			if(!ready)
+			{
+				Err() << "Failed to decode the pixels of \"" << Filepath.string() << "\" again." << std::endl;
+				return false;
+			}
+
+			Pixels.Resize((u32)Region.Width, (u32)Region.Height);
+
+			const HRESULT success = clipper->CopyPixels(
+				nullptr,
+				Pixels.GetPitch(),
+				(UINT)(Pixels.GetPitch() * Pixels.GetHeight()),
+				reinterpret_cast<BYTE*>(Pixels.GetPixels())
+			);
+
+			if(FAILED(success))
+			{
+				Err() << "Failed to copy the pixels from the image source." << std::endl;
+				Pixels.Release();
+				return false;
+			}
+
+			return true;
+		}
+
+		////////////////////////////////////////////////////////////
+		/// \brief Create the bitmap from the pixel buffer.
+		/// 
+		////////////////////////////////////////////////////////////
+		bool CreateBitmap()
+		{
+			ID2D1RenderTarget& renderTarget = Application::Instance->Graphics.GetRenderTarget();
+
+			const D2D1_BITMAP_PROPERTIES properties = D2D1::BitmapProperties(
+				D2D1::PixelFormat(DXGI_FORMAT_B8G8R8A8_UNORM, D2D1_ALPHA_MODE_PREMULTIPLIED)
+			);
+
+			const HRESULT success = renderTarget.CreateBitmap(
+				D2D1::SizeU(Pixels.GetWidth(), Pixels.GetHeight()),
+				Pixels.GetPixels(),
+				Pixels.GetPitch(),
+				properties,
+				&Bitmap
+			);
+
+			if(FAILED(success))
+			{
+				Err() << "Failed to create an ID2D1Bitmap object" << std::endl;
+				Pixels.Release();
+				return false;
+			}
+
+			CountUpload((u64)Pixels.GetPitch() * Pixels.GetHeight());
+
+			// the pixel buffer holds the content from now on
+			Filepath.clear();
+			Pixels.ClearDirty();
+			return true;
+		}
+
+		////////////////////////////////////////////////////////////
+		/// \brief Upload the modified rows of the pixel buffer into
+		///		   the bitmap.
+		/// 
+		////////////////////////////////////////////////////////////
+		void WritePixels()
+		{
+			if(!Bitmap || !Pixels.IsDirty())
+			{
+				return;
+			}
+
+			Pixels.GetDirtySpans(Spans);
+
+			for(const PixelBuffer::DirtySpan& span : Spans)
+			{
+				const D2D1_RECT_U destinationRectangle = D2D1::RectU(span.Left, span.Top, span.Right, span.Bottom);
+				const u32* source = Pixels.GetRow(span.Top) + span.Left;
+
+				const HRESULT success = Bitmap->CopyFromMemory(&destinationRectangle, source, Pixels.GetPitch());
+				if(FAILED(success))
+				{
+					Err() << "Failed to upload the pixels into the bitmap." << std::endl;
+					break;
+				}
+
+				CountUpload((u64)(span.Right - span.Left) * (span.Bottom - span.Top) * sizeof(u32));
+			}
+
+			Pixels.ClearDirty();
+		}
+
 		////////////////////////////////////////////////////////////
 		/// Member data
 		/// 
 		////////////////////////////////////////////////////////////
-		Microsoft::WRL::ComPtr<ID2D1Bitmap> Bitmap;
+		Microsoft::WRL::ComPtr<ID2D1Bitmap>			Bitmap;		///< The bitmap that is drawn
+		std::filesystem::path						Filepath;	///< The image to decode the pixels from, empty if the pixel buffer holds them
+		WICRect										Region = {};	///< The part of the image the texture shows
+		PixelBuffer									Pixels;		///< CPU-side copy of the pixels, empty until LoadPixels() is called
+		std::vector<PixelBuffer::DirtySpan>			Spans;		///< Scratch buffer for the regions to upload
 
 	};
 
@@ -45,6 +194,8 @@ namespace Core
 	////////////////////////////////////////////////////////////
 	bool Texture::LoadFromFile(const std::filesystem::path& filepath)
 	{
+		CORE_PROFILE_SCOPE("Texture::LoadFromFile");
+
 		using Microsoft::WRL::ComPtr;
 
 		ComPtr<IWICBitmapDecoder> pDecoder = nullptr;
@@ -105,6 +256,14 @@ namespace Core
 			return false;
 		}
 
+		// the decoder is released here, the pixels are decoded again if they are needed
+		const D2D1_SIZE_U pixelSize = impl->Bitmap->GetPixelSize();
+		impl->Filepath = filepath;
+		impl->Region = { 0, 0, (INT)pixelSize.width, (INT)pixelSize.height };
+		impl->Pixels.Release();
+
+		CountUpload((u64)pixelSize.width * pixelSize.height * sizeof(u32));
+
 		// store the size to retrieve it later
 		const auto [width, height] = impl->Bitmap->GetSize();
 		size.X = width;
@@ -113,6 +272,49 @@ namespace Core
 		return true;
 	}
 
+	////////////////////////////////////////////////////////////
+	bool Texture::Create(u32 width, u32 height)
+	{
+		// start with a fully transparent bitmap
+		impl->Pixels.Resize(width, height);
+		if(!impl->CreateBitmap())
+		{
+			return false;
+		}
+
+		size.X = (float)width;
+		size.Y = (float)height;
+		return true;
+	}
+
+	////////////////////////////////////////////////////////////
+	Texture Texture::Resized(u32 width, u32 height, ImageFilter::ResampleFilter filter) const
+	{
+		if(!impl->Bitmap || width == 0 || height == 0)
+		{
+			return {};
+		}
+
+		// the source pixels are needed on the CPU
+		if(impl->Pixels.IsEmpty())
+		{
+			if(!impl->ReadPixels())
+			{
+				return {};
+			}
+		}
+
+		Texture output;
+		ImageFilter::Resize(impl->Pixels, output.impl->Pixels, width, height, filter);
+		if(!output.impl->CreateBitmap())
+		{
+			return {};
+		}
+
+		output.size = Float2((float)width, (float)height);
+		return output;
+	}
+
 	////////////////////////////////////////////////////////////
 	Texture Texture::Get(i32 x, i32 y, i32 width, i32 height) const
 	{
@@ -171,9 +373,107 @@ namespace Core
 		Texture output;
 		output.size = Float2(bitmapSize.width, bitmapSize.height);
 		output.impl->Bitmap = std::move(destinationBitmap);
+
+		// keep the pixels accessible for the copy as well
+		if(!impl->Pixels.IsEmpty())
+		{
+			PixelBuffer& pixels = output.impl->Pixels;
+			pixels.Resize((u32)width, (u32)height);
+
+			for(i32 row = 0; row < height; ++row)
+			{
+				const u32* sourceRow = impl->Pixels.GetRow((u32)(y + row)) + x;
+				std::copy_n(sourceRow, width, pixels.GetRow((u32)row));
+			}
+		} else if(!impl->Filepath.empty())
+		{
+			output.impl->Filepath = impl->Filepath;
+			output.impl->Region = { impl->Region.X + x, impl->Region.Y + y, width, height };
+		}
+
 		return output;
 	}
 
+	////////////////////////////////////////////////////////////
+	u32* Texture::LoadPixels()
+	{
+		if(!impl->Bitmap)
+		{
+			return nullptr;
+		}
+
+		if(impl->Pixels.IsEmpty())
+		{
+			if(!impl->ReadPixels())
+			{
+				return nullptr;
+			}
+		}
+
+		return impl->Pixels.GetPixels();
+	}
+
+	////////////////////////////////////////////////////////////
+	void Texture::UpdatePixels()
+	{
+		// raw writes through the pointer cannot be tracked
+		if(!impl->Pixels.IsDirty())
+		{
+			impl->Pixels.MarkDirty();
+		}
+
+		impl->WritePixels();
+	}
+
+	////////////////////////////////////////////////////////////
+	void Texture::UpdatePixels(i32 x, i32 y, i32 width, i32 height)
+	{
+		impl->Pixels.MarkDirty(IntRect(x, y, width, height));
+		impl->WritePixels();
+	}
+
+	////////////////////////////////////////////////////////////
+	void Texture::Filter(ImageFilter::Type type)
+	{
+		if(LoadPixels())
+		{
+			ImageFilter::Apply(impl->Pixels, type);
+			impl->WritePixels();
+		}
+	}
+
+	////////////////////////////////////////////////////////////
+	void Texture::Filter(ImageFilter::Type type, float parameter)
+	{
+		if(LoadPixels())
+		{
+			ImageFilter::Apply(impl->Pixels, type, parameter);
+			impl->WritePixels();
+		}
+	}
+
+	////////////////////////////////////////////////////////////
+	void Texture::Filter(const float* kernel, u32 size)
+	{
+		if(LoadPixels())
+		{
+			ImageFilter::Convolve(impl->Pixels, kernel, size);
+			impl->WritePixels();
+		}
+	}
+
+	////////////////////////////////////////////////////////////
+	PixelBuffer& Texture::GetPixelBuffer()
+	{
+		return impl->Pixels;
+	}
+
+	////////////////////////////////////////////////////////////
+	const PixelBuffer& Texture::GetPixelBuffer() const
+	{
+		return impl->Pixels;
+	}
+
 	////////////////////////////////////////////////////////////
 	ID2D1Bitmap* Texture::GetBitmap() const
 	{
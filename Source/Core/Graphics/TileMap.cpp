@@ -0,0 +1,575 @@
+﻿// 
+// TileMap.cpp
+// Core
+// 
+// Created by Felix Busch on 19.10.2026.
+// Copyright © 2026 Felix Busch. All rights reserved.
+// 
+
+#include <Core/Graphics/TileMap.hpp>
+#include <Core/Graphics/LayerPyramid.hpp>
+#include <Core/System/Error.hpp>
+
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <d2d1.h>
+#include <wrl/client.h>
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace Core
+{
+	////////////////////////////////////////////////////////////
+	/// \brief Define concrete implementation for the tile map
+	///		   class.
+	/// 
+	///	The pyramid decides which layers are rendered and
+	///	released, the implementation holds their pixels in
+	///	Direct2D render targets.
+	/// 
+	////////////////////////////////////////////////////////////
+	class TileMap::Impl : public LayerPyramid::Renderer
+	{
+	public:
+
+		////////////////////////////////////////////////////////////
+		/// \brief Define the pixels of a cached layer.
+		/// 
+		////////////////////////////////////////////////////////////
+		struct Layer
+		{
+			Microsoft::WRL::ComPtr<ID2D1BitmapRenderTarget>	Target;	///< The render target of the layer
+			Microsoft::WRL::ComPtr<ID2D1Bitmap>				Bitmap;	///< The content of the layer
+		};
+
+		////////////////////////////////////////////////////////////
+		/// \brief Get the pixels of a layer.
+		/// 
+		////////////////////////////////////////////////////////////
+		Layer& GetLayer(u32 level, u32 x, u32 y)
+		{
+			return Layers[level][(usize)y * Pyramid.GetWidth(level) + x];
+		}
+
+		////////////////////////////////////////////////////////////
+		/// \brief Create the render target of a layer.
+		/// 
+		////////////////////////////////////////////////////////////
+		virtual bool CreateLayer(u32 level, u32 x, u32 y) override
+		{
+			Layer& layer = GetLayer(level, x, y);
+
+			const HRESULT success = Target->CreateCompatibleRenderTarget(
+				D2D1::SizeF((float)LayerWidth, (float)LayerHeight),
+				D2D1::SizeU(LayerWidth, LayerHeight),
+				D2D1::PixelFormat(DXGI_FORMAT_B8G8R8A8_UNORM, D2D1_ALPHA_MODE_PREMULTIPLIED),
+				D2D1_COMPATIBLE_RENDER_TARGET_OPTIONS_NONE,
+				&layer.Target
+			);
+
+			if(FAILED(success) || FAILED(layer.Target->GetBitmap(&layer.Bitmap)))
+			{
+				Err() << "Failed to create the layer of a tile map chunk." << std::endl;
+				layer.Target.Reset();
+				layer.Bitmap.Reset();
+				return false;
+			}
+
+			return true;
+		}
+
+		////////////////////////////////////////////////////////////
+		/// \brief Release the render target of a layer.
+		/// 
+		////////////////////////////////////////////////////////////
+		virtual void ReleaseLayer(u32 level, u32 x, u32 y) override
+		{
+			Layer& layer = GetLayer(level, x, y);
+			layer.Target.Reset();
+			layer.Bitmap.Reset();
+		}
+
+		////////////////////////////////////////////////////////////
+		/// \brief Render the tiles of a chunk into its layer.
+		/// 
+		////////////////////////////////////////////////////////////
+		virtual bool RenderChunk(u32 x, u32 y) override
+		{
+			ID2D1BitmapRenderTarget& layer = *GetLayer(0, x, y).Target.Get();
+			layer.BeginDraw();
+			layer.SetTransform(D2D1::Matrix3x2F::Identity());
+			layer.Clear(D2D1::ColorF(0.0f, 0.0f, 0.0f, 0.0f));
+
+			RenderTiles(layer, x, y);
+
+			if(FAILED(layer.EndDraw()))
+			{
+				Err() << "Failed to render the layer of a tile map chunk." << std::endl;
+				return false;
+			}
+
+			return true;
+		}
+
+		////////////////////////////////////////////////////////////
+		/// \brief Render a child layer into a quadrant of a layer
+		///		   at half its size.
+		/// 
+		////////////////////////////////////////////////////////////
+		virtual bool RenderQuadrant(u32 level, u32 x, u32 y, u32 quadrant, bool empty) override
+		{
+			const float halfWidth = (float)LayerWidth / 2.0f;
+			const float halfHeight = (float)LayerHeight / 2.0f;
+			const float left = (float)(quadrant & 1) * halfWidth;
+			const float top = (float)(quadrant >> 1) * halfHeight;
+			const D2D1_RECT_F area = D2D1::RectF(left, top, left + halfWidth, top + halfHeight);
+
+			ID2D1BitmapRenderTarget& layer = *GetLayer(level, x, y).Target.Get();
+			layer.BeginDraw();
+			layer.SetTransform(D2D1::Matrix3x2F::Identity());
+			layer.PushAxisAlignedClip(area, D2D1_ANTIALIAS_MODE_ALIASED);
+			layer.Clear(D2D1::ColorF(0.0f, 0.0f, 0.0f, 0.0f));
+
+			if(!empty)
+			{
+				++LayerDraws;
+				layer.DrawBitmap(
+					GetLayer(level - 1, x * 2 + (quadrant & 1), y * 2 + (quadrant >> 1)).Bitmap.Get(),
+					area,
+					1.0f,
+					D2D1_BITMAP_INTERPOLATION_MODE_LINEAR
+				);
+			}
+
+			layer.PopAxisAlignedClip();
+
+			if(FAILED(layer.EndDraw()))
+			{
+				Err() << "Failed to render the layer of a tile map chunk." << std::endl;
+				return false;
+			}
+
+			return true;
+		}
+
+		////////////////////////////////////////////////////////////
+		/// \brief Render a single chunk into its cell of a coarse
+		///		   layer.
+		/// 
+		///	The chunk is halved once per level through the scratch
+		///	layers, so the cell looks exactly like the quadrants
+		///	rendered from the layers below.
+		/// 
+		////////////////////////////////////////////////////////////
+		virtual bool RenderCell(u32 level, u32 x, u32 y, u32 chunkX, u32 chunkY, bool empty) override
+		{
+			ID2D1Bitmap* content = nullptr;
+			for(u32 step = 0; !empty && step <= level; ++step)
+			{
+				Layer* scratch = GetScratch(step);
+				if(!scratch)
+				{
+					return false;
+				}
+
+				ID2D1BitmapRenderTarget& halved = *scratch->Target.Get();
+				halved.BeginDraw();
+				halved.SetTransform(D2D1::Matrix3x2F::Identity());
+				halved.Clear(D2D1::ColorF(0.0f, 0.0f, 0.0f, 0.0f));
+
+				if(step == 0)
+				{
+					RenderTiles(halved, chunkX, chunkY);
+				} else
+				{
+					const D2D1_SIZE_F size = halved.GetSize();
+					++LayerDraws;
+					halved.DrawBitmap(content, D2D1::RectF(0.0f, 0.0f, size.width, size.height), 1.0f, D2D1_BITMAP_INTERPOLATION_MODE_LINEAR);
+				}
+
+				if(FAILED(halved.EndDraw()))
+				{
+					Err() << "Failed to render the layer of a tile map chunk." << std::endl;
+					return false;
+				}
+
+				content = scratch->Bitmap.Get();
+			}
+
+			const float cellWidth = (float)LayerWidth / (float)(1u << level);
+			const float cellHeight = (float)LayerHeight / (float)(1u << level);
+			const float left = (float)(chunkX - (x << level)) * cellWidth;
+			const float top = (float)(chunkY - (y << level)) * cellHeight;
+			const D2D1_RECT_F area = D2D1::RectF(left, top, left + cellWidth, top + cellHeight);
+
+			ID2D1BitmapRenderTarget& layer = *GetLayer(level, x, y).Target.Get();
+			layer.BeginDraw();
+			layer.SetTransform(D2D1::Matrix3x2F::Identity());
+			layer.PushAxisAlignedClip(area, D2D1_ANTIALIAS_MODE_ALIASED);
+			layer.Clear(D2D1::ColorF(0.0f, 0.0f, 0.0f, 0.0f));
+
+			if(content)
+			{
+				++LayerDraws;
+				layer.DrawBitmap(content, area, 1.0f, D2D1_BITMAP_INTERPOLATION_MODE_NEAREST_NEIGHBOR);
+			}
+
+			layer.PopAxisAlignedClip();
+
+			if(FAILED(layer.EndDraw()))
+			{
+				Err() << "Failed to render the layer of a tile map chunk." << std::endl;
+				return false;
+			}
+
+			return true;
+		}
+
+		////////////////////////////////////////////////////////////
+		/// \brief Get the scratch layer holding a chunk halved a
+		///		   number of times, create it on first use.
+		/// 
+		////////////////////////////////////////////////////////////
+		Layer* GetScratch(u32 step)
+		{
+			if(Scratch.size() <= step)
+			{
+				Scratch.resize(step + 1);
+			}
+
+			Layer& scratch = Scratch[step];
+			if(!scratch.Target)
+			{
+				const u32 width = std::max(LayerWidth >> step, 1u);
+				const u32 height = std::max(LayerHeight >> step, 1u);
+
+				const HRESULT success = Target->CreateCompatibleRenderTarget(
+					D2D1::SizeF((float)width, (float)height),
+					D2D1::SizeU(width, height),
+					D2D1::PixelFormat(DXGI_FORMAT_B8G8R8A8_UNORM, D2D1_ALPHA_MODE_PREMULTIPLIED),
+					D2D1_COMPATIBLE_RENDER_TARGET_OPTIONS_NONE,
+					&scratch.Target
+				);
+
+				if(FAILED(success) || FAILED(scratch.Target->GetBitmap(&scratch.Bitmap)))
+				{
+					Err() << "Failed to create the layer of a tile map chunk." << std::endl;
+					scratch.Target.Reset();
+					scratch.Bitmap.Reset();
+					return nullptr;
+				}
+			}
+
+			return &scratch;
+		}
+
+		////////////////////////////////////////////////////////////
+		/// \brief Render the tiles of a single chunk.
+		/// 
+		////////////////////////////////////////////////////////////
+		void RenderTiles(ID2D1RenderTarget& layer, u32 chunkX, u32 chunkY)
+		{
+			ID2D1Bitmap* tileset = Tileset.GetBitmap();
+
+			const u32 firstColumn = chunkX * ChunkSize;
+			const u32 firstRow = chunkY * ChunkSize;
+			const u32 lastColumn = std::min(firstColumn + ChunkSize, Columns);
+			const u32 lastRow = std::min(firstRow + ChunkSize, Rows);
+
+			for(u32 row = firstRow; row < lastRow; ++row)
+			{
+				const u16* tiles = Tiles.data() + (usize)row * Columns;
+				const float top = (float)((row - firstRow) * TileHeight);
+
+				for(u32 column = firstColumn; column < lastColumn; ++column)
+				{
+					const u16 tile = tiles[column];
+					if(tile == Empty)
+					{
+						continue;
+					}
+
+					const float left = (float)((column - firstColumn) * TileWidth);
+					const float sourceX = (float)((tile % TilesetColumns) * TileWidth) * TilesetScale.X;
+					const float sourceY = (float)((tile / TilesetColumns) * TileHeight) * TilesetScale.Y;
+
+					++LayerDraws;
+					layer.DrawBitmap(
+						tileset,
+						D2D1::RectF(left, top, left + (float)TileWidth, top + (float)TileHeight),
+						1.0f,
+						D2D1_BITMAP_INTERPOLATION_MODE_NEAREST_NEIGHBOR,
+						D2D1::RectF(sourceX, sourceY, sourceX + (float)TileWidth * TilesetScale.X, sourceY + (float)TileHeight * TilesetScale.Y)
+					);
+				}
+			}
+		}
+
+		////////////////////////////////////////////////////////////
+		/// Member data
+		/// 
+		////////////////////////////////////////////////////////////
+		Texture							Tileset;									///< The texture containing all tiles
+		Float2							TilesetScale;								///< Converts tileset pixels into its DIPs
+		u32								TilesetColumns = 0;							///< The number of tiles per row in the tileset
+		u32								TileWidth = 0;								///< The width of a tile in pixels
+		u32								TileHeight = 0;								///< The height of a tile in pixels
+		u32								Columns = 0;								///< The number of tiles per row
+		u32								Rows = 0;									///< The number of rows
+		u32								LayerWidth = 0;								///< The width of every layer in pixels
+		u32								LayerHeight = 0;							///< The height of every layer in pixels
+		std::vector<u16>				Tiles;										///< The tile indices in row major order
+		LayerPyramid					Pyramid;									///< Decides which layers are rendered and released
+		std::vector<std::vector<Layer>>	Layers;										///< The pixels of the layers per level
+		std::vector<Layer>				Scratch;									///< A single chunk halved 0, 1, 2, ... times for RenderCell()
+		ID2D1RenderTarget*				Target = nullptr;							///< The render target of the current Draw()
+		Time							BuildBudget = Time::FromMilliseconds(4);	///< The time for rendering layers per Draw()
+		u32								LayerDraws = 0;								///< The DrawBitmap calls into layers by this Draw()
+
+	};
+
+	////////////////////////////////////////////////////////////
+	TileMap::TileMap():
+		impl(std::make_unique<Impl>())
+	{
+	}
+
+	////////////////////////////////////////////////////////////
+	TileMap::~TileMap() = default;
+
+	////////////////////////////////////////////////////////////
+	bool TileMap::Create(u32 columns, u32 rows, const Texture& tileset, u32 tileWidth, u32 tileHeight, usize byteBudget)
+	{
+		ID2D1Bitmap* bitmap = tileset.GetBitmap();
+		if(!bitmap || columns == 0 || rows == 0 || tileWidth == 0 || tileHeight == 0)
+		{
+			Err() << "Failed to create the tile map, the tileset or the dimensions are invalid." << std::endl;
+			return false;
+		}
+
+		const D2D1_SIZE_U pixelSize = bitmap->GetPixelSize();
+		const D2D1_SIZE_F dipSize = bitmap->GetSize();
+
+		impl = std::make_unique<Impl>();
+		impl->Tileset = tileset;
+		impl->TilesetScale = Float2(dipSize.width / (float)pixelSize.width, dipSize.height / (float)pixelSize.height);
+		impl->TilesetColumns = std::max(pixelSize.width / tileWidth, 1u);
+		impl->TileWidth = tileWidth;
+		impl->TileHeight = tileHeight;
+		impl->Columns = columns;
+		impl->Rows = rows;
+		impl->LayerWidth = ChunkSize * tileWidth;
+		impl->LayerHeight = ChunkSize * tileHeight;
+		impl->Tiles.assign((usize)columns * rows, Empty);
+
+		const usize layerBytes = (usize)impl->LayerWidth * impl->LayerHeight * sizeof(u32);
+		impl->Pyramid.Create((columns + ChunkSize - 1) / ChunkSize, (rows + ChunkSize - 1) / ChunkSize, layerBytes, byteBudget);
+
+		for(u32 level = 0; level < impl->Pyramid.GetLevelCount(); ++level)
+		{
+			impl->Layers.emplace_back((usize)impl->Pyramid.GetWidth(level) * impl->Pyramid.GetHeight(level));
+		}
+
+		size = Float2((float)(columns * tileWidth), (float)(rows * tileHeight));
+		return true;
+	}
+
+	////////////////////////////////////////////////////////////
+	void TileMap::SetTile(u32 column, u32 row, u16 tile)
+	{
+		if(column >= impl->Columns || row >= impl->Rows)
+		{
+			return;
+		}
+
+		u16& current = impl->Tiles[(usize)row * impl->Columns + column];
+		if(current == tile)
+		{
+			return;
+		}
+
+		const i32 delta = (tile != Empty ? 1 : 0) - (current != Empty ? 1 : 0);
+		current = tile;
+		impl->Pyramid.Invalidate(column / ChunkSize, row / ChunkSize, delta);
+	}
+
+	////////////////////////////////////////////////////////////
+	u16 TileMap::GetTile(u32 column, u32 row) const
+	{
+		if(column >= impl->Columns || row >= impl->Rows)
+		{
+			return Empty;
+		}
+
+		return impl->Tiles[(usize)row * impl->Columns + column];
+	}
+
+	////////////////////////////////////////////////////////////
+	void TileMap::Fill(u16 tile)
+	{
+		const u32 width = impl->Pyramid.GetLevelCount() > 0 ? impl->Pyramid.GetWidth(0) : 0;
+		const u32 height = impl->Pyramid.GetLevelCount() > 0 ? impl->Pyramid.GetHeight(0) : 0;
+		if(width == 0 || height == 0)
+		{
+			return;
+		}
+
+		std::fill(impl->Tiles.begin(), impl->Tiles.end(), tile);
+
+		// count the tiles of every chunk, the pyramid sums them up level by level
+		std::vector<u32> counts((usize)width * height);
+		for(u32 y = 0; y < height; ++y)
+		{
+			for(u32 x = 0; x < width; ++x)
+			{
+				const u32 columns = std::min(ChunkSize, impl->Columns - x * ChunkSize);
+				const u32 rows = std::min(ChunkSize, impl->Rows - y * ChunkSize);
+				counts[(usize)y * width + x] = tile != Empty ? columns * rows : 0;
+			}
+		}
+
+		impl->Pyramid.Reset(counts);
+	}
+
+	////////////////////////////////////////////////////////////
+	void TileMap::Draw(ID2D1RenderTarget& target, const FloatRect& destinationRectangle, float opacity, Texture::SampleMode sampleMode, RenderStats* stats)
+	{
+		LayerPyramid& pyramid = impl->Pyramid;
+		if(pyramid.GetLevelCount() == 0 || destinationRectangle.Width <= 0.0f || destinationRectangle.Height <= 0.0f)
+		{
+			return;
+		}
+
+		RenderStats ignored;
+		RenderStats& counters = stats ? *stats : ignored;
+
+		pyramid.BeginFrame(impl->BuildBudget);
+		impl->Target = &target;
+		impl->LayerDraws = 0;
+
+		D2D1::Matrix3x2F transform;
+		target.GetTransform(&transform);
+
+		// the number of map pixels covered by a single pixel of the render target
+		const float scaleX = std::hypot(transform._11, transform._12) * destinationRectangle.Width / size.X;
+		const float scaleY = std::hypot(transform._21, transform._22) * destinationRectangle.Height / size.Y;
+		const float density = 1.0f / std::max(std::min(scaleX, scaleY), 1e-6f);
+		const u32 level = (u32)std::clamp(std::floor(std::log2(density)), 0.0f, (float)(pyramid.GetLevelCount() - 1));
+
+		// map the bounds of the render target back into the space of the map
+		D2D1::Matrix3x2F inverse = transform;
+		if(!inverse.Invert())
+		{
+			return;
+		}
+
+		const D2D1_SIZE_F targetSize = target.GetSize();
+		const D2D1_POINT_2F corners[4] = {
+			inverse.TransformPoint(D2D1::Point2F(0.0f, 0.0f)),
+			inverse.TransformPoint(D2D1::Point2F(targetSize.width, 0.0f)),
+			inverse.TransformPoint(D2D1::Point2F(0.0f, targetSize.height)),
+			inverse.TransformPoint(D2D1::Point2F(targetSize.width, targetSize.height))
+		};
+
+		float left = corners[0].x, top = corners[0].y, right = corners[0].x, bottom = corners[0].y;
+		for(const D2D1_POINT_2F& corner : corners)
+		{
+			left = std::min(left, corner.x);
+			top = std::min(top, corner.y);
+			right = std::max(right, corner.x);
+			bottom = std::max(bottom, corner.y);
+		}
+
+		const float pixelsPerUnitX = size.X / destinationRectangle.Width;
+		const float pixelsPerUnitY = size.Y / destinationRectangle.Height;
+
+		const u32 width = pyramid.GetWidth(level);
+		const u32 height = pyramid.GetHeight(level);
+		const float spanX = (float)(impl->LayerWidth << level);
+		const float spanY = (float)(impl->LayerHeight << level);
+
+		const u32 firstX = (u32)std::clamp(std::floor((left - destinationRectangle.Left) * pixelsPerUnitX / spanX), 0.0f, (float)width);
+		const u32 lastX = (u32)std::clamp(std::ceil((right - destinationRectangle.Left) * pixelsPerUnitX / spanX), 0.0f, (float)width);
+		const u32 firstY = (u32)std::clamp(std::floor((top - destinationRectangle.Top) * pixelsPerUnitY / spanY), 0.0f, (float)height);
+		const u32 lastY = (u32)std::clamp(std::ceil((bottom - destinationRectangle.Top) * pixelsPerUnitY / spanY), 0.0f, (float)height);
+		counters.CulledPrimitives += width * height - (lastX - firstX) * (lastY - firstY);
+
+		const auto draw = [&](ID2D1Bitmap* bitmap, u32 x, u32 y, const D2D1_RECT_F& sourceRectangle)
+		{
+			const float mapX = (float)x * spanX;
+			const float mapY = (float)y * spanY;
+			const D2D1_RECT_F destination = D2D1::RectF(
+				destinationRectangle.Left + mapX / pixelsPerUnitX,
+				destinationRectangle.Top + mapY / pixelsPerUnitY,
+				destinationRectangle.Left + (mapX + spanX) / pixelsPerUnitX,
+				destinationRectangle.Top + (mapY + spanY) / pixelsPerUnitY
+			);
+
+			target.DrawBitmap(bitmap, destination, opacity, (D2D1_BITMAP_INTERPOLATION_MODE)sampleMode, sourceRectangle);
+			++counters.Bitmaps;
+		};
+
+		for(u32 y = firstY; y < lastY; ++y)
+		{
+			for(u32 x = firstX; x < lastX; ++x)
+			{
+				if(pyramid.GetCount(level, x, y) == 0)
+				{
+					continue;
+				}
+
+				if(pyramid.Build(*impl, level, x, y))
+				{
+					draw(impl->GetLayer(level, x, y).Bitmap.Get(), x, y, D2D1::RectF(0.0f, 0.0f, (float)impl->LayerWidth, (float)impl->LayerHeight));
+					continue;
+				}
+
+				// fall back to the closest layer that has been rendered completely, even if it is outdated
+				u32 fallback = 0;
+				if(pyramid.FindFallback(level, x, y, fallback))
+				{
+					const u32 shift = fallback - level;
+					const float factor = (float)(1u << shift);
+					const float sourceX = (float)(x - ((x >> shift) << shift)) * (float)impl->LayerWidth / factor;
+					const float sourceY = (float)(y - ((y >> shift) << shift)) * (float)impl->LayerHeight / factor;
+					draw(impl->GetLayer(fallback, x >> shift, y >> shift).Bitmap.Get(), x, y, D2D1::RectF(sourceX, sourceY, sourceX + (float)impl->LayerWidth / factor, sourceY + (float)impl->LayerHeight / factor));
+				}
+			}
+		}
+
+		counters.Bitmaps += impl->LayerDraws;
+		impl->Target = nullptr;
+	}
+
+	////////////////////////////////////////////////////////////
+	void TileMap::SetBuildBudget(const Time& budget)
+	{
+		impl->BuildBudget = budget;
+	}
+
+	////////////////////////////////////////////////////////////
+	usize TileMap::GetUsedBytes() const
+	{
+		return impl->Pyramid.GetUsedBytes();
+	}
+
+	////////////////////////////////////////////////////////////
+	u32 TileMap::GetColumns() const
+	{
+		return impl->Columns;
+	}
+
+	////////////////////////////////////////////////////////////
+	u32 TileMap::GetRows() const
+	{
+		return impl->Rows;
+	}
+
+	////////////////////////////////////////////////////////////
+	const Float2& TileMap::GetSize() const
+	{
+		return size;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,745 @@
+﻿// 
+// TiledTexture.cpp
+// Core
+// 
+// Created by Felix Busch on 19.10.2026.
+// Copyright © 2026 Felix Busch. All rights reserved.
+// 
+
+#include <Core/Graphics/TiledTexture.hpp>
+#include <Core/System/Error.hpp>
+#include <Core/System/Profiler.hpp>
+#include <Core/System/Jobs.hpp>
+#include <Core/Application/Factories.hpp>
+
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <d2d1.h>
+#include <wincodec.h>
+#include <wrl/client.h>
+
+#include <algorithm>
+#include <cmath>
+#include <deque>
+#include <iterator>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace Core
+{
+	////////////////////////////////////////////////////////////
+	/// \brief Define concrete implementation for the tiled
+	///		   texture class.
+	/// 
+	////////////////////////////////////////////////////////////
+	class TiledTexture::Impl
+	{
+	public:
+
+		////////////////////////////////////////////////////////////
+		/// The maximum number of jobs decoding tiles at once
+		/// 
+		////////////////////////////////////////////////////////////
+		static constexpr u32 MaxDecodeJobs = 2;
+
+		////////////////////////////////////////////////////////////
+		/// The maximum number of tiles uploaded per Draw() call
+		/// 
+		////////////////////////////////////////////////////////////
+		static constexpr u32 UploadsPerDraw = 8;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Define a tile that has been uploaded.
+		/// 
+		////////////////////////////////////////////////////////////
+		struct Tile
+		{
+			Microsoft::WRL::ComPtr<ID2D1Bitmap>	Bitmap;		///< The pixels of the tile
+			usize								Bytes;		///< The memory held by the bitmap
+			u64									LastUsed;	///< The Draw() call that used the tile last
+			std::list<u64>::iterator			Position;	///< The position in the usage list
+		};
+
+		////////////////////////////////////////////////////////////
+		/// \brief Define a tile that has been decoded but not
+		///		   uploaded yet.
+		/// 
+		////////////////////////////////////////////////////////////
+		struct Decoded
+		{
+			u64					Key;	///< The tile that has been decoded
+			u32					Width;	///< The width of the pixels
+			u32					Height;	///< The height of the pixels
+			std::vector<u32>	Pixels;	///< Premultiplied BGRA pixels
+		};
+
+		////////////////////////////////////////////////////////////
+		/// \brief Define the WIC objects reading the image.
+		/// 
+		////////////////////////////////////////////////////////////
+		struct Decoder
+		{
+			Microsoft::WRL::ComPtr<IWICBitmapDecoder>		File;		///< The opened image file
+			Microsoft::WRL::ComPtr<IWICBitmapFrameDecode>	Frame;		///< The first frame of the image
+			Microsoft::WRL::ComPtr<IWICFormatConverter>		Converter;	///< Converts the frame to premultiplied BGRA
+		};
+
+		////////////////////////////////////////////////////////////
+		/// \brief Initialize COM on a job worker for as long as the
+		///		   thread lives.
+		/// 
+		////////////////////////////////////////////////////////////
+		struct ComApartment
+		{
+			ComApartment():
+				Initialized(SUCCEEDED(CoInitializeEx(nullptr, COINIT_MULTITHREADED)))
+			{
+			}
+
+			~ComApartment()
+			{
+				if(Initialized)
+				{
+					CoUninitialize();
+				}
+			}
+
+			bool Initialized;	///< False if the thread already had a different apartment
+		};
+
+		////////////////////////////////////////////////////////////
+		/// \brief Combine the level and the tile coordinate into a
+		///		   single key.
+		/// 
+		////////////////////////////////////////////////////////////
+		static constexpr u64 MakeKey(u32 level, u32 x, u32 y)
+		{
+			return ((u64)level << 48) | ((u64)y << 24) | (u64)x;
+		}
+
+		static constexpr u32 LevelOf(u64 key)	{ return (u32)(key >> 48); }
+		static constexpr u32 YOf(u64 key)		{ return (u32)(key >> 24) & 0xFFFFFF; }
+		static constexpr u32 XOf(u64 key)		{ return (u32)key & 0xFFFFFF; }
+
+		////////////////////////////////////////////////////////////
+		/// \brief Get the region of the image covered by a tile in
+		///		   full resolution pixels.
+		/// 
+		////////////////////////////////////////////////////////////
+		WICRect GetSourceRectangle(u64 key) const
+		{
+			const u32 span = TileSize << LevelOf(key);
+			const u32 left = XOf(key) * span;
+			const u32 top = YOf(key) * span;
+			return { (INT)left, (INT)top, (INT)std::min(span, Width - left), (INT)std::min(span, Height - top) };
+		}
+
+		////////////////////////////////////////////////////////////
+		/// \brief Get the number of bytes a tile will occupy.
+		/// 
+		////////////////////////////////////////////////////////////
+		usize GetTileBytes(u64 key) const
+		{
+			const WICRect rectangle = GetSourceRectangle(key);
+			const u32 level = LevelOf(key);
+			return (usize)(((u32)rectangle.Width + (1u << level) - 1) >> level) * (((u32)rectangle.Height + (1u << level) - 1) >> level) * sizeof(u32);
+		}
+
+		////////////////////////////////////////////////////////////
+		/// \brief Open the image for decoding on the calling thread.
+		/// 
+		///	WIC bitmap sources must not be shared between threads,
+		///	so every decode job uses a decoder of its own.
+		/// 
+		////////////////////////////////////////////////////////////
+		bool OpenDecoder(IWICImagingFactory* imagingFactory, Decoder& decoder) const
+		{
+			return
+				SUCCEEDED(imagingFactory->CreateDecoderFromFilename(Filepath.wstring().c_str(), nullptr, GENERIC_READ, WICDecodeMetadataCacheOnDemand, &decoder.File)) &&
+				SUCCEEDED(decoder.File->GetFrame(0, &decoder.Frame)) &&
+				SUCCEEDED(imagingFactory->CreateFormatConverter(&decoder.Converter)) &&
+				SUCCEEDED(decoder.Converter->Initialize(decoder.Frame.Get(), GUID_WICPixelFormat32bppPBGRA, WICBitmapDitherTypeNone, nullptr, 0.0, WICBitmapPaletteTypeMedianCut));
+		}
+
+		////////////////////////////////////////////////////////////
+		/// \brief Count the decode jobs needed for the queued
+		///		   requests as started.
+		/// 
+		///	Must be called with the mutex locked. The jobs must be
+		///	submitted after unlocking, since they run right away
+		///	while the job system is not running.
+		/// 
+		///	\return The number of jobs to submit
+		/// 
+		////////////////////////////////////////////////////////////
+		u32 ReserveDecodeJobs()
+		{
+			const u32 wanted = Stop || Unreadable ? 0 : (u32)std::min<usize>(MaxDecodeJobs, Requests.size());
+			const u32 reserved = wanted > ActiveJobs ? wanted - ActiveJobs : 0;
+
+			ActiveJobs += reserved;
+			return reserved;
+		}
+
+		////////////////////////////////////////////////////////////
+		/// \brief Decode requested tiles until there are none left.
+		/// 
+		///	Runs as a job, the decoders are kept between jobs.
+		/// 
+		////////////////////////////////////////////////////////////
+		void DecodeRequests()
+		{
+			static thread_local ComApartment apartment;
+
+			IWICImagingFactory* imagingFactory = Factories::ImagingFactory.Get();
+			Decoder decoder;
+
+			{
+				std::scoped_lock lock(Mutex);
+				if(!IdleDecoders.empty())
+				{
+					decoder = std::move(IdleDecoders.back());
+					IdleDecoders.pop_back();
+				}
+			}
+
+			if(!decoder.Converter && !OpenDecoder(imagingFactory, decoder))
+			{
+				Err() << "Failed to open \"" << Filepath.string() << "\" for streaming tiles." << std::endl;
+
+				// the file won't get any better, leave the requests unanswered
+				std::scoped_lock lock(Mutex);
+				Unreadable = true;
+				--ActiveJobs;
+				return;
+			}
+
+			while(true)
+			{
+				u64 key = 0;
+
+				{
+					std::scoped_lock lock(Mutex);
+					if(Stop || Requests.empty())
+					{
+						IdleDecoders.push_back(std::move(decoder));
+						--ActiveJobs;
+						return;
+					}
+
+					key = Requests.front();
+					Requests.pop_front();
+				}
+
+				Decoded decoded = { key, 0, 0, {} };
+				bool success;
+				{
+					CORE_PROFILE_SCOPE("TiledTexture::Decode");
+					success = Decode(imagingFactory, decoder.Converter.Get(), decoded);
+				}
+
+				std::scoped_lock lock(Mutex);
+				if(success)
+				{
+					DecodedBytes += decoded.Pixels.size() * sizeof(u32);
+					Completed.push_back(std::move(decoded));
+				} else
+				{
+					Pending.erase(key);
+				}
+			}
+		}
+
+		////////////////////////////////////////////////////////////
+		/// \brief Decode the pixels of a single tile.
+		/// 
+		///	Tiles of coarser levels are scaled while decoding, so
+		///	the full resolution region is never held in memory.
+		/// 
+		////////////////////////////////////////////////////////////
+		bool Decode(IWICImagingFactory* imagingFactory, IWICBitmapSource* source, Decoded& decoded) const
+		{
+			using Microsoft::WRL::ComPtr;
+
+			const WICRect rectangle = GetSourceRectangle(decoded.Key);
+			const u32 level = LevelOf(decoded.Key);
+
+			ComPtr<IWICBitmapClipper> clipper = nullptr;
+			if(FAILED(imagingFactory->CreateBitmapClipper(&clipper)) || FAILED(clipper->Initialize(source, &rectangle)))
+			{
+				Err() << "Failed to clip a tile from \"" << Filepath.string() << "\"." << std::endl;
+				return false;
+			}
+
+			decoded.Width = std::max(((u32)rectangle.Width + (1u << level) - 1) >> level, 1u);
+			decoded.Height = std::max(((u32)rectangle.Height + (1u << level) - 1) >> level, 1u);
+
+			ComPtr<IWICBitmapSource> tile = clipper;
+			if(level > 0)
+			{
+				ComPtr<IWICBitmapScaler> scaler = nullptr;
+				if(FAILED(imagingFactory->CreateBitmapScaler(&scaler)) ||
+				   FAILED(scaler->Initialize(clipper.Get(), decoded.Width, decoded.Height, WICBitmapInterpolationModeFant)))
+				{
+					Err() << "Failed to scale a tile from \"" << Filepath.string() << "\"." << std::endl;
+					return false;
+				}
+
+				tile = scaler;
+			}
+
+			const UINT stride = decoded.Width * sizeof(u32);
+			decoded.Pixels.resize((usize)decoded.Width * decoded.Height);
+
+			if(FAILED(tile->CopyPixels(nullptr, stride, stride * decoded.Height, reinterpret_cast<BYTE*>(decoded.Pixels.data()))))
+			{
+				Err() << "Failed to decode a tile from \"" << Filepath.string() << "\"." << std::endl;
+				return false;
+			}
+
+			return true;
+		}
+
+		////////////////////////////////////////////////////////////
+		/// \brief Turn decoded tiles into bitmaps.
+		/// 
+		///	\return The number of bytes uploaded
+		/// 
+		////////////////////////////////////////////////////////////
+		u64 Upload(ID2D1RenderTarget& target)
+		{
+			std::vector<Decoded> uploads;
+			u64 uploaded = 0;
+
+			{
+				std::scoped_lock lock(Mutex);
+				const usize count = std::min<usize>(Completed.size(), UploadsPerDraw);
+				std::move(Completed.begin(), Completed.begin() + count, std::back_inserter(uploads));
+				Completed.erase(Completed.begin(), Completed.begin() + count);
+			}
+
+			const D2D1_BITMAP_PROPERTIES properties = D2D1::BitmapProperties(
+				D2D1::PixelFormat(DXGI_FORMAT_B8G8R8A8_UNORM, D2D1_ALPHA_MODE_PREMULTIPLIED)
+			);
+
+			for(Decoded& decoded : uploads)
+			{
+				Tile tile = {};
+				tile.Bytes = decoded.Pixels.size() * sizeof(u32);
+
+				const HRESULT success = target.CreateBitmap(
+					D2D1::SizeU(decoded.Width, decoded.Height),
+					decoded.Pixels.data(),
+					decoded.Width * sizeof(u32),
+					properties,
+					&tile.Bitmap
+				);
+
+				if(SUCCEEDED(success))
+				{
+					// a fresh tile was just requested, putting it at the
+					// back would make it the first to be evicted
+					tile.LastUsed = DrawCount;
+					tile.Position = Usage.insert(Usage.begin(), decoded.Key);
+					ResidentBytes += tile.Bytes;
+					uploaded += tile.Bytes;
+					Tiles.emplace(decoded.Key, std::move(tile));
+				} else
+				{
+					Err() << "Failed to create the bitmap of a tile." << std::endl;
+				}
+
+				std::scoped_lock lock(Mutex);
+				DecodedBytes -= decoded.Pixels.size() * sizeof(u32);
+				Pending.erase(decoded.Key);
+			}
+
+			return uploaded;
+		}
+
+		////////////////////////////////////////////////////////////
+		/// \brief Get a resident tile and mark it as used.
+		/// 
+		////////////////////////////////////////////////////////////
+		Tile* Use(u64 key)
+		{
+			const auto iterator = Tiles.find(key);
+			if(iterator == Tiles.end())
+			{
+				return nullptr;
+			}
+
+			Tile& tile = iterator->second;
+			tile.LastUsed = DrawCount;
+			Usage.splice(Usage.begin(), Usage, tile.Position);
+			return &tile;
+		}
+
+		////////////////////////////////////////////////////////////
+		/// \brief Evict least recently used tiles that have not
+		///		   been drawn by the current Draw() call until the
+		///		   memory fits into the budget.
+		/// 
+		////////////////////////////////////////////////////////////
+		void Evict(usize reserve)
+		{
+			while(!Usage.empty() && ResidentBytes + reserve > ByteBudget)
+			{
+				const auto iterator = Tiles.find(Usage.back());
+				if(iterator->second.LastUsed == DrawCount)
+				{
+					break;
+				}
+
+				ResidentBytes -= iterator->second.Bytes;
+				Usage.pop_back();
+				Tiles.erase(iterator);
+			}
+		}
+
+		////////////////////////////////////////////////////////////
+		/// \brief Stop the decode jobs and release all tiles.
+		/// 
+		////////////////////////////////////////////////////////////
+		void Shutdown()
+		{
+			{
+				std::scoped_lock lock(Mutex);
+				Stop = true;
+			}
+
+			// running jobs return before their next tile
+			Jobs::Wait(DecodeJobs);
+
+			IdleDecoders.clear();
+			Requests.clear();
+			Completed.clear();
+			Pending.clear();
+			Tiles.clear();
+			Usage.clear();
+			DecodedBytes = 0;
+			ResidentBytes = 0;
+			Stop = false;
+			Unreadable = false;
+		}
+
+		////////////////////////////////////////////////////////////
+		/// Member data
+		/// 
+		////////////////////////////////////////////////////////////
+		std::filesystem::path			Filepath;			///< The image to stream from
+		u32								Width = 0;			///< The width of the image in pixels
+		u32								Height = 0;			///< The height of the image in pixels
+		u32								TileSize = 0;		///< The width and height of a tile
+		u32								LevelCount = 0;		///< The number of levels down to a single tile
+		usize							ByteBudget = 0;		///< The maximum number of bytes used by tiles
+		usize							ResidentBytes = 0;	///< The bytes held by uploaded tiles
+		u64								DrawCount = 0;		///< The number of Draw() calls so far
+
+		std::unordered_map<u64, Tile>	Tiles;				///< The uploaded tiles
+		std::list<u64>					Usage;				///< Uploaded tiles, most recently used first
+
+		std::mutex						Mutex;				///< Guards the members below
+		std::deque<u64>					Requests;			///< Tiles waiting to be decoded
+		std::vector<Decoded>			Completed;			///< Tiles waiting to be uploaded
+		std::unordered_set<u64>			Pending;			///< Tiles that are requested, decoding or decoded
+		usize							DecodedBytes = 0;	///< The bytes held by decoded tiles
+		bool							Stop = false;		///< Tells the decode jobs to quit
+		bool							Unreadable = false;	///< The image could not be opened for decoding
+		u32								ActiveJobs = 0;		///< The number of decode jobs queued or running
+		std::vector<Decoder>			IdleDecoders;		///< The decoders of finished decode jobs
+
+		Jobs::Counter					DecodeJobs;			///< Counts the decode jobs, waited for on shutdown
+
+	};
+
+	////////////////////////////////////////////////////////////
+	TiledTexture::TiledTexture():
+		impl(std::make_unique<Impl>())
+	{
+	}
+
+	////////////////////////////////////////////////////////////
+	TiledTexture::~TiledTexture()
+	{
+		Close();
+	}
+
+	////////////////////////////////////////////////////////////
+	bool TiledTexture::Open(const std::filesystem::path& filepath, u32 tileSize, usize byteBudget)
+	{
+		using Microsoft::WRL::ComPtr;
+
+		Close();
+
+		IWICImagingFactory* imagingFactory = Factories::ImagingFactory.Get();
+		if(!imagingFactory)
+		{
+			Err() << "There is no imaging factory. Make sure to setup the imaging factory before loading images from a file." << std::endl;
+			return false;
+		}
+
+		// only read the dimensions here, the pixels are decoded by jobs
+		ComPtr<IWICBitmapDecoder> decoder = nullptr;
+		ComPtr<IWICBitmapFrameDecode> frame = nullptr;
+		UINT width = 0, height = 0;
+
+		if(FAILED(imagingFactory->CreateDecoderFromFilename(filepath.wstring().c_str(), nullptr, GENERIC_READ, WICDecodeMetadataCacheOnDemand, &decoder)) ||
+		   FAILED(decoder->GetFrame(0, &frame)) ||
+		   FAILED(frame->GetSize(&width, &height)))
+		{
+			Err() << "Failed to read the image size from filename: \"" << filepath.string() << "\"" << std::endl;
+			return false;
+		}
+
+		impl->Filepath = filepath;
+		impl->Width = width;
+		impl->Height = height;
+		impl->TileSize = std::max(tileSize, 16u);
+		impl->ByteBudget = byteBudget;
+		impl->DrawCount = 0;
+
+		// add levels until a single tile covers the whole image
+		impl->LevelCount = 1;
+		while((u64)(impl->TileSize << (impl->LevelCount - 1)) < std::max(width, height))
+		{
+			++impl->LevelCount;
+		}
+
+		size = Float2((float)width, (float)height);
+		return true;
+	}
+
+	////////////////////////////////////////////////////////////
+	void TiledTexture::Close()
+	{
+		impl->Shutdown();
+		impl->Width = 0;
+		impl->Height = 0;
+		size = Float2(0.0f, 0.0f);
+	}
+
+	////////////////////////////////////////////////////////////
+	void TiledTexture::Draw(ID2D1RenderTarget& target, const FloatRect& destinationRectangle, float opacity, Texture::SampleMode sampleMode, RenderStats* stats)
+	{
+		if(!IsOpen() || destinationRectangle.Width <= 0.0f || destinationRectangle.Height <= 0.0f)
+		{
+			return;
+		}
+
+		RenderStats ignored;
+		RenderStats& counters = stats ? *stats : ignored;
+
+		++impl->DrawCount;
+		counters.UploadedBytes += impl->Upload(target);
+
+		D2D1::Matrix3x2F transform;
+		target.GetTransform(&transform);
+
+		// the number of image pixels covered by a single pixel of the render target
+		const float scaleX = std::hypot(transform._11, transform._12) * destinationRectangle.Width / (float)impl->Width;
+		const float scaleY = std::hypot(transform._21, transform._22) * destinationRectangle.Height / (float)impl->Height;
+		const float density = 1.0f / std::max(std::min(scaleX, scaleY), 1e-6f);
+		const u32 level = (u32)std::clamp(std::floor(std::log2(density)), 0.0f, (float)(impl->LevelCount - 1));
+
+		// map the bounds of the render target back into the space of the image
+		D2D1::Matrix3x2F inverse = transform;
+		if(!inverse.Invert())
+		{
+			return;
+		}
+
+		const D2D1_SIZE_F targetSize = target.GetSize();
+		const D2D1_POINT_2F corners[4] = {
+			inverse.TransformPoint(D2D1::Point2F(0.0f, 0.0f)),
+			inverse.TransformPoint(D2D1::Point2F(targetSize.width, 0.0f)),
+			inverse.TransformPoint(D2D1::Point2F(0.0f, targetSize.height)),
+			inverse.TransformPoint(D2D1::Point2F(targetSize.width, targetSize.height))
+		};
+
+		float left = corners[0].x, top = corners[0].y, right = corners[0].x, bottom = corners[0].y;
+		for(const D2D1_POINT_2F& corner : corners)
+		{
+			left = std::min(left, corner.x);
+			top = std::min(top, corner.y);
+			right = std::max(right, corner.x);
+			bottom = std::max(bottom, corner.y);
+		}
+
+		const float pixelsPerUnitX = (float)impl->Width / destinationRectangle.Width;
+		const float pixelsPerUnitY = (float)impl->Height / destinationRectangle.Height;
+		const float span = (float)(impl->TileSize << level);
+		const u32 columns = (impl->Width + (impl->TileSize << level) - 1) / (impl->TileSize << level);
+		const u32 rows = (impl->Height + (impl->TileSize << level) - 1) / (impl->TileSize << level);
+
+		const auto toTile = [span](float units, float pixelsPerUnit, float origin)
+		{
+			return (units - origin) * pixelsPerUnit / span;
+		};
+
+		const u32 firstColumn = (u32)std::clamp(std::floor(toTile(left, pixelsPerUnitX, destinationRectangle.Left)), 0.0f, (float)columns);
+		const u32 lastColumn = (u32)std::clamp(std::ceil(toTile(right, pixelsPerUnitX, destinationRectangle.Left)), 0.0f, (float)columns);
+		const u32 firstRow = (u32)std::clamp(std::floor(toTile(top, pixelsPerUnitY, destinationRectangle.Top)), 0.0f, (float)rows);
+		const u32 lastRow = (u32)std::clamp(std::ceil(toTile(bottom, pixelsPerUnitY, destinationRectangle.Top)), 0.0f, (float)rows);
+		counters.CulledPrimitives += columns * rows - (lastColumn - firstColumn) * (lastRow - firstRow);
+
+		const auto draw = [&](ID2D1Bitmap* bitmap, const WICRect& region, const D2D1_RECT_F& sourceRectangle)
+		{
+			const D2D1_RECT_F destination = D2D1::RectF(
+				destinationRectangle.Left + (float)region.X / pixelsPerUnitX,
+				destinationRectangle.Top + (float)region.Y / pixelsPerUnitY,
+				destinationRectangle.Left + (float)(region.X + region.Width) / pixelsPerUnitX,
+				destinationRectangle.Top + (float)(region.Y + region.Height) / pixelsPerUnitY
+			);
+
+			target.DrawBitmap(bitmap, destination, opacity, (D2D1_BITMAP_INTERPOLATION_MODE)sampleMode, sourceRectangle);
+			++counters.Bitmaps;
+		};
+
+		std::vector<u64> missing;
+
+		for(u32 y = firstRow; y < lastRow; ++y)
+		{
+			for(u32 x = firstColumn; x < lastColumn; ++x)
+			{
+				const u64 key = Impl::MakeKey(level, x, y);
+				const WICRect region = impl->GetSourceRectangle(key);
+
+				if(Impl::Tile* tile = impl->Use(key))
+				{
+					const D2D1_SIZE_F bitmapSize = tile->Bitmap->GetSize();
+					draw(tile->Bitmap.Get(), region, D2D1::RectF(0.0f, 0.0f, bitmapSize.width, bitmapSize.height));
+					continue;
+				}
+
+				missing.push_back(key);
+
+				// fall back to the closest coarser level that is resident
+				for(u32 parent = level + 1; parent < impl->LevelCount; ++parent)
+				{
+					const u32 shift = parent - level;
+					const u64 parentKey = Impl::MakeKey(parent, x >> shift, y >> shift);
+
+					if(Impl::Tile* tile = impl->Use(parentKey))
+					{
+						const WICRect parentRegion = impl->GetSourceRectangle(parentKey);
+						const float factor = (float)(1u << parent);
+						draw(tile->Bitmap.Get(), region, D2D1::RectF(
+							(float)(region.X - parentRegion.X) / factor,
+							(float)(region.Y - parentRegion.Y) / factor,
+							(float)(region.X - parentRegion.X + region.Width) / factor,
+							(float)(region.Y - parentRegion.Y + region.Height) / factor
+						));
+						break;
+					}
+				}
+			}
+		}
+
+		// the coarsest level always serves as the last fallback
+		const u64 rootKey = Impl::MakeKey(impl->LevelCount - 1, 0, 0);
+		if(!impl->Use(rootKey))
+		{
+			missing.insert(missing.begin(), rootKey);
+		}
+
+		// decode the tiles closest to the center of the view first
+		const float centerX = (toTile(left, pixelsPerUnitX, destinationRectangle.Left) + toTile(right, pixelsPerUnitX, destinationRectangle.Left)) / 2.0f;
+		const float centerY = (toTile(top, pixelsPerUnitY, destinationRectangle.Top) + toTile(bottom, pixelsPerUnitY, destinationRectangle.Top)) / 2.0f;
+		std::stable_sort(missing.begin() + (missing.empty() || missing.front() != rootKey ? 0 : 1), missing.end(), [&](u64 a, u64 b)
+		{
+			const auto distance = [&](u64 key)
+			{
+				const float dx = (float)Impl::XOf(key) + 0.5f - centerX;
+				const float dy = (float)Impl::YOf(key) + 0.5f - centerY;
+				return dx * dx + dy * dy;
+			};
+
+			return distance(a) < distance(b);
+		});
+
+		u32 decodeJobs = 0;
+
+		{
+			std::scoped_lock lock(impl->Mutex);
+
+			// requests that have not been started are no longer needed
+			for(const u64 key : impl->Requests)
+			{
+				impl->Pending.erase(key);
+			}
+
+			impl->Requests.clear();
+
+			usize reserved = impl->DecodedBytes;
+			for(const u64 key : missing)
+			{
+				if(impl->Pending.contains(key))
+				{
+					reserved += impl->GetTileBytes(key);
+					continue;
+				}
+
+				// make room for the tile or stop requesting
+				const usize bytes = impl->GetTileBytes(key);
+				impl->Evict(reserved + bytes);
+				if(impl->ResidentBytes + reserved + bytes > impl->ByteBudget)
+				{
+					break;
+				}
+
+				reserved += bytes;
+				impl->Requests.push_back(key);
+				impl->Pending.insert(key);
+			}
+
+			decodeJobs = impl->ReserveDecodeJobs();
+		}
+
+		for(u32 i = 0; i < decodeJobs; ++i)
+		{
+			Jobs::Submit([state = impl.get()] { state->DecodeRequests(); }, &impl->DecodeJobs);
+		}
+	}
+
+	////////////////////////////////////////////////////////////
+	void TiledTexture::SetByteBudget(usize byteBudget)
+	{
+		impl->ByteBudget = byteBudget;
+		impl->Evict(0);
+	}
+
+	////////////////////////////////////////////////////////////
+	usize TiledTexture::GetByteBudget() const
+	{
+		return impl->ByteBudget;
+	}
+
+	////////////////////////////////////////////////////////////
+	usize TiledTexture::GetUsedBytes() const
+	{
+		std::scoped_lock lock(impl->Mutex);
+		return impl->ResidentBytes + impl->DecodedBytes;
+	}
+
+	////////////////////////////////////////////////////////////
+	u32 TiledTexture::GetTileSize() const
+	{
+		return impl->TileSize;
+	}
+
+	////////////////////////////////////////////////////////////
+	const Float2& TiledTexture::GetSize() const
+	{
+		return size;
+	}
+
+	////////////////////////////////////////////////////////////
+	bool TiledTexture::IsOpen() const
+	{
+		return impl->Width > 0 && impl->Height > 0;
+	}
+}
\ No newline at end of file
@@ -8,6 +8,8 @@
 
 #include <Core/Library.hpp>
 #include <Core/Application/Application.hpp>
+#include <Core/System/Jobs.hpp>
+#include <Core/System/Profiler.hpp>
 
 namespace Core
 {
@@ -29,18 +31,164 @@ namespace Core
 		GetApp().Exit();
 	}
 
+	////////////////////////////////////////////////////////////
+	void Loop()
+	{
+		GetApp().LoopEnabled = true;
+		GetApp().Redraw();
+	}
+
+	////////////////////////////////////////////////////////////
+	void NoLoop()
+	{
+		GetApp().LoopEnabled = false;
+	}
+
+	////////////////////////////////////////////////////////////
+	bool IsLooping()
+	{
+		return GetApp().LoopEnabled;
+	}
+
+	////////////////////////////////////////////////////////////
+	void Redraw()
+	{
+		GetApp().Redraw();
+	}
+
 	////////////////////////////////////////////////////////////
 	void SetFrameRateLimit(u32 limit)
 	{
 		GetApp().TargetFps = limit;
 	}
 
+	////////////////////////////////////////////////////////////
+	void SetPipelinedRendering(bool enabled)
+	{
+		GetApp().PipelineEnabled = enabled;
+	}
+
+	////////////////////////////////////////////////////////////
+	bool IsPipelinedRendering()
+	{
+		return GetApp().Pipeline.IsRunning();
+	}
+
+	////////////////////////////////////////////////////////////
+	void SetJobWorkerCount(u32 count)
+	{
+		GetApp().WorkerCount = count;
+		GetApp().WorkerCountChanged = true;
+
+		// the main thread restarts the workers once it is awake
+		GetApp().Window.Wake();
+	}
+
+	////////////////////////////////////////////////////////////
+	u32 GetJobWorkerCount()
+	{
+		return Jobs::GetWorkerCount();
+	}
+
+	////////////////////////////////////////////////////////////
+	void SetPerformanceOverlay(bool enabled)
+	{
+		GetApp().OverlayEnabled = enabled;
+	}
+
+	////////////////////////////////////////////////////////////
+	bool IsPerformanceOverlay()
+	{
+		return GetApp().OverlayEnabled;
+	}
+
+	////////////////////////////////////////////////////////////
+	void SetGenericEventsEnabled(bool enabled)
+	{
+		GetApp().GenericEventsEnabled = enabled;
+
+		// the main thread changes the subscription once it is awake
+		GetApp().Window.Wake();
+	}
+
+	////////////////////////////////////////////////////////////
+	bool IsGenericEventsEnabled()
+	{
+		return GetApp().GenericEventsEnabled;
+	}
+
+	////////////////////////////////////////////////////////////
+	void SetTickRate(u32 ticksPerSecond)
+	{
+		GetApp().TickRate = ticksPerSecond;
+	}
+
+	////////////////////////////////////////////////////////////
+	u32 GetTickRate()
+	{
+		return GetApp().TickRate;
+	}
+
+	////////////////////////////////////////////////////////////
+	float GetInterpolationAlpha()
+	{
+		return GetApp().InterpolationAlpha;
+	}
+
 	////////////////////////////////////////////////////////////
 	u32 GetFramesPerSecond()
 	{
 		return GetApp().FramesPerSecond;
 	}
 
+	////////////////////////////////////////////////////////////
+	const LatencyHistogram& GetInputLatency()
+	{
+		return GetApp().InputLatency;
+	}
+
+	////////////////////////////////////////////////////////////
+	const LatencyHistogram& GetPresentLatency()
+	{
+		return GetApp().PresentLatency;
+	}
+
+	////////////////////////////////////////////////////////////
+	const LatencyHistogram& GetPacingError()
+	{
+		return GetApp().Pacer.GetPacingError();
+	}
+
+	////////////////////////////////////////////////////////////
+	const FrameStatistics& GetFrameStatistics()
+	{
+		return GetApp().Statistics;
+	}
+
+	////////////////////////////////////////////////////////////
+	bool StartRecording(const std::filesystem::path& filepath)
+	{
+		return GetApp().Recorder.Open(filepath);
+	}
+
+	////////////////////////////////////////////////////////////
+	void StopRecording()
+	{
+		GetApp().Recorder.Close();
+	}
+
+	////////////////////////////////////////////////////////////
+	bool StartProfiling(const std::filesystem::path& filepath)
+	{
+		return Profiler::Start(filepath);
+	}
+
+	////////////////////////////////////////////////////////////
+	void StopProfiling()
+	{
+		Profiler::Stop();
+	}
+
 	////////////////////////////////////////////////////////////
 	Application& GetApp()
 	{
@@ -221,6 +369,60 @@ namespace Core
 		return Application::Instance->Window;
 	}
 
+	////////////////////////////////////////////////////////////
+	bool IsKeyDown(KeyCode key)
+	{
+		return GetInput().IsKeyDown(key);
+	}
+
+	////////////////////////////////////////////////////////////
+	bool IsKeyPressed(KeyCode key)
+	{
+		return GetInput().IsKeyPressed(key);
+	}
+
+	////////////////////////////////////////////////////////////
+	bool IsKeyReleased(KeyCode key)
+	{
+		return GetInput().IsKeyReleased(key);
+	}
+
+	////////////////////////////////////////////////////////////
+	bool IsMouseButtonDown(MouseButton button)
+	{
+		return GetInput().IsMouseButtonDown(button);
+	}
+
+	////////////////////////////////////////////////////////////
+	bool IsMouseButtonPressed(MouseButton button)
+	{
+		return GetInput().IsMouseButtonPressed(button);
+	}
+
+	////////////////////////////////////////////////////////////
+	bool IsMouseButtonReleased(MouseButton button)
+	{
+		return GetInput().IsMouseButtonReleased(button);
+	}
+
+	////////////////////////////////////////////////////////////
+	float GetMouseWheelDelta(MouseWheel wheel)
+	{
+		return GetInput().GetMouseWheelDelta(wheel);
+	}
+
+	////////////////////////////////////////////////////////////
+	Int2 GetMouseDelta()
+	{
+		return GetInput().GetMouseDelta();
+	}
+
+	////////////////////////////////////////////////////////////
+	const Input& GetInput()
+	{
+		return Application::Instance->Input;
+	}
+
 	////////////////////////////////////////////////////////////
 	void Background(const Color& color)
 	{
@@ -437,6 +639,66 @@ namespace Core
 		GetGraphics().Image(texture, a, b, c, d, destinationRectangle);
 	}
 
+	////////////////////////////////////////////////////////////
+	void Image(TiledTexture& texture, float a, float b)
+	{
+		GetGraphics().Image(texture, a, b);
+	}
+
+	////////////////////////////////////////////////////////////
+	void Image(TiledTexture& texture, float a, float b, float c, float d)
+	{
+		GetGraphics().Image(texture, a, b, c, d);
+	}
+
+	////////////////////////////////////////////////////////////
+	void Image(TileMap& map, float a, float b)
+	{
+		GetGraphics().Image(map, a, b);
+	}
+
+	////////////////////////////////////////////////////////////
+	void Image(TileMap& map, float a, float b, float c, float d)
+	{
+		GetGraphics().Image(map, a, b, c, d);
+	}
+
+	////////////////////////////////////////////////////////////
+	u32* LoadPixels()
+	{
+		return GetGraphics().LoadPixels();
+	}
+
+	////////////////////////////////////////////////////////////
+	void UpdatePixels()
+	{
+		GetGraphics().UpdatePixels();
+	}
+
+	////////////////////////////////////////////////////////////
+	void UpdatePixels(i32 x, i32 y, i32 width, i32 height)
+	{
+		GetGraphics().UpdatePixels(x, y, width, height);
+	}
+
+	////////////////////////////////////////////////////////////
+	void Filter(ImageFilter::Type type)
+	{
+		GetGraphics().Filter(type);
+	}
+
+	////////////////////////////////////////////////////////////
+	void Filter(ImageFilter::Type type, float parameter)
+	{
+		GetGraphics().Filter(type, parameter);
+	}
+
+	////////////////////////////////////////////////////////////
+	void Filter(const float* kernel, u32 size)
+	{
+		GetGraphics().Filter(kernel, size);
+	}
+
 	////////////////////////////////////////////////////////////
 	void ResetTransform()
 	{
@@ -0,0 +1,168 @@
+﻿// 
+// FramePacer.cpp
+// Core
+// 
+// Created by Felix Busch on 19.10.2026.
+// Copyright © 2026 Felix Busch. All rights reserved.
+// 
+
+#include <Core/System/FramePacer.hpp>
+#include <Core/System/Stopwatch.hpp>
+#include <Core/System/Profiler.hpp>
+
+#include <thread>
+
+#ifdef _WIN32
+#include <Windows.h>
+#pragma comment(lib, "Winmm")
+
+#ifndef CREATE_WAITABLE_TIMER_HIGH_RESOLUTION
+#define CREATE_WAITABLE_TIMER_HIGH_RESOLUTION 0x00000002
+#endif
+#else
+#include <time.h>
+#include <cerrno>
+#endif
+
+namespace Core
+{
+	////////////////////////////////////////////////////////////
+	FramePacer::FramePacer():
+		timer(nullptr),
+		spinThreshold(Microseconds(200)),
+		interval(Time::Zero),
+		deadline(Stopwatch::GetTimestamp()),
+		missedDeadlines(0)
+	{
+#ifdef _WIN32
+		// available since Windows 10 1803, wakes up within about half a millisecond
+		timer = CreateWaitableTimerExW(nullptr, nullptr, CREATE_WAITABLE_TIMER_HIGH_RESOLUTION, TIMER_ALL_ACCESS);
+		spinThreshold = Milliseconds(1);
+
+		if(!timer)
+		{
+			// the regular timer follows the system timer period, so raise it once for the lifetime of the pacer
+			timer = CreateWaitableTimerExW(nullptr, nullptr, 0, TIMER_ALL_ACCESS);
+			timeBeginPeriod(1);
+			spinThreshold = Milliseconds(2);
+		}
+#endif
+	}
+
+	////////////////////////////////////////////////////////////
+	FramePacer::~FramePacer()
+	{
+#ifdef _WIN32
+		if(spinThreshold > Milliseconds(1))
+		{
+			timeEndPeriod(1);
+		}
+
+		if(timer)
+		{
+			CloseHandle(timer);
+		}
+#endif
+	}
+
+	////////////////////////////////////////////////////////////
+	void FramePacer::SetInterval(const Time& interval)
+	{
+		deadline = deadline - this->interval + interval;
+		this->interval = interval;
+	}
+
+	////////////////////////////////////////////////////////////
+	const Time& FramePacer::GetInterval() const
+	{
+		return interval;
+	}
+
+	////////////////////////////////////////////////////////////
+	void FramePacer::Reset()
+	{
+		deadline = Stopwatch::GetTimestamp() + interval;
+	}
+
+	////////////////////////////////////////////////////////////
+	void FramePacer::Wait()
+	{
+		CORE_PROFILE_SCOPE("FramePacer::Wait");
+
+		const Time now = Stopwatch::GetTimestamp();
+
+		if(now >= deadline)
+		{
+			++missedDeadlines;
+
+			// too far behind to catch up, start over from here
+			if(now - deadline >= interval)
+			{
+				deadline = now;
+			}
+
+			deadline = deadline + interval;
+			return;
+		}
+
+		// sleep coarsely ...
+		if(deadline - now > spinThreshold)
+		{
+			SleepUntil(deadline - spinThreshold);
+		}
+
+		// ... and spin for the last stretch
+		Time woken = Stopwatch::GetTimestamp();
+		while(woken < deadline)
+		{
+			std::this_thread::yield();
+			woken = Stopwatch::GetTimestamp();
+		}
+
+		pacingError.Record(woken - deadline);
+		deadline = deadline + interval;
+	}
+
+	////////////////////////////////////////////////////////////
+	const LatencyHistogram& FramePacer::GetPacingError() const
+	{
+		return pacingError;
+	}
+
+	////////////////////////////////////////////////////////////
+	u64 FramePacer::GetMissedDeadlineCount() const
+	{
+		return missedDeadlines;
+	}
+
+	////////////////////////////////////////////////////////////
+	void FramePacer::SleepUntil(const Time& timestamp)
+	{
+#ifdef _WIN32
+		const Time duration = timestamp - Stopwatch::GetTimestamp();
+
+		if(duration <= Time::Zero || !timer)
+			return;
+
+		// negative values are relative, in units of 100 nanoseconds
+		LARGE_INTEGER dueTime;
+		dueTime.QuadPart = -(duration.ToNanoseconds<LONGLONG>() / 100);
+
+		if(SetWaitableTimer(timer, &dueTime, 0, nullptr, nullptr, FALSE))
+		{
+			WaitForSingleObject(timer, INFINITE);
+		}
+#else
+		// the steady clock is CLOCK_MONOTONIC, so the timestamp can be used as an absolute time
+		const i64 nanoseconds = timestamp.ToNanoseconds<i64>();
+
+		timespec time;
+		time.tv_sec = (time_t)(nanoseconds / 1'000'000'000);
+		time.tv_nsec = (long)(nanoseconds % 1'000'000'000);
+
+		while(clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &time, nullptr) == EINTR)
+		{
+		}
+#endif
+	}
+}
\ No newline at end of file
@@ -0,0 +1,138 @@
+﻿// 
+// FrameStatistics.cpp
+// Core
+// 
+// Created by Felix Busch on 19.10.2026.
+// Copyright © 2026 Felix Busch. All rights reserved.
+// 
+
+#include <Core/System/FrameStatistics.hpp>
+
+#include <algorithm>
+
+namespace Core
+{
+	////////////////////////////////////////////////////////////
+	/// \brief Pick the nearest-rank percentile of sorted values.
+	/// 
+	////////////////////////////////////////////////////////////
+	static const Time& GetPercentile(const std::vector<Time>& sorted, usize percentile)
+	{
+		const usize rank = (sorted.size() * percentile + 99) / 100;
+		return sorted[std::max<usize>(rank, 1) - 1];
+	}
+
+	////////////////////////////////////////////////////////////
+	FrameStatistics::FrameStatistics(usize capacity):
+		samples(capacity),
+		budget(Time::Zero),
+		overBudget(0)
+	{
+		scratch.reserve(samples.GetCapacity());
+	}
+
+	////////////////////////////////////////////////////////////
+	void FrameStatistics::Record(const Sample& sample)
+	{
+		if(samples.IsFull())
+		{
+			samples.PopFront();
+		}
+
+		samples.PushBack(sample);
+
+		if(budget > Time::Zero && sample.FrameTime > budget)
+		{
+			++overBudget;
+		}
+	}
+
+	////////////////////////////////////////////////////////////
+	void FrameStatistics::Clear()
+	{
+		samples.Clear();
+		overBudget = 0;
+	}
+
+	////////////////////////////////////////////////////////////
+	void FrameStatistics::SetBudget(const Time& budget)
+	{
+		this->budget = budget;
+	}
+
+	////////////////////////////////////////////////////////////
+	const Time& FrameStatistics::GetBudget() const
+	{
+		return budget;
+	}
+
+	////////////////////////////////////////////////////////////
+	FrameStatistics::Summary FrameStatistics::GetSummary(Metric metric, usize window) const
+	{
+		Summary summary = {};
+
+		const usize count = std::min(window, samples.GetSize());
+		if(count == 0)
+		{
+			return summary;
+		}
+
+		// copy the most recent values
+		scratch.clear();
+		i64 total = 0;
+
+		for(usize i = samples.GetSize() - count; i < samples.GetSize(); ++i)
+		{
+			const Time& value = GetValue(samples[i], metric);
+			scratch.push_back(value);
+			total += value.ToNanoseconds<i64>();
+
+			if(budget > Time::Zero && value > budget)
+			{
+				++summary.OverBudgetCount;
+			}
+		}
+
+		std::sort(scratch.begin(), scratch.end());
+
+		summary.Min = scratch.front();
+		summary.Max = scratch.back();
+		summary.Mean = Nanoseconds(total / (i64)count);
+		summary.P50 = GetPercentile(scratch, 50);
+		summary.P95 = GetPercentile(scratch, 95);
+		summary.P99 = GetPercentile(scratch, 99);
+		summary.FrameCount = (u32)count;
+		return summary;
+	}
+
+	////////////////////////////////////////////////////////////
+	const FrameStatistics::Sample& FrameStatistics::GetSample(usize age) const
+	{
+		return samples[samples.GetSize() - 1 - age];
+	}
+
+	////////////////////////////////////////////////////////////
+	usize FrameStatistics::GetSize() const
+	{
+		return samples.GetSize();
+	}
+
+	////////////////////////////////////////////////////////////
+	u64 FrameStatistics::GetOverBudgetCount() const
+	{
+		return overBudget;
+	}
+
+	////////////////////////////////////////////////////////////
+	const Time& FrameStatistics::GetValue(const Sample& sample, Metric metric)
+	{
+		switch(metric)
+		{
+			default:
+			case Frame:		return sample.FrameTime;
+			case Draw:		return sample.DrawTime;
+			case EndDraw:	return sample.EndDrawTime;
+			case Sleep:		return sample.SleepTime;
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,533 @@
+﻿// 
+// Jobs.cpp
+// Core
+// 
+// Created by Felix Busch on 19.10.2026.
+// Copyright © 2026 Felix Busch. All rights reserved.
+// 
+
+#include <Core/System/Jobs.hpp>
+#include <Core/System/Profiler.hpp>
+#include <Core/System/Stopwatch.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <shared_mutex>
+#include <thread>
+
+namespace Core
+{
+	////////////////////////////////////////////////////////////
+	/// \brief Define the worker threads, their queues and the
+	///		   bookkeeping of the counters.
+	/// 
+	////////////////////////////////////////////////////////////
+	class Jobs::Impl
+	{
+	public:
+
+		////////////////////////////////////////////////////////////
+		/// The number of sub-ranges per thread ParallelFor() aims
+		/// for, so uneven ranges can be balanced
+		/// 
+		////////////////////////////////////////////////////////////
+		static constexpr u32 RangesPerThread = 4;
+
+		////////////////////////////////////////////////////////////
+		/// The worker index of threads outside the pool
+		/// 
+		////////////////////////////////////////////////////////////
+		static constexpr u32 NoWorker = ~0u;
+
+		////////////////////////////////////////////////////////////
+		/// The number of times Wait() yields without finding a job
+		/// before it sleeps until the counter is done
+		/// 
+		////////////////////////////////////////////////////////////
+		static constexpr u32 SpinCount = 64;
+
+		////////////////////////////////////////////////////////////
+		/// \brief Define a queued job.
+		/// 
+		////////////////////////////////////////////////////////////
+		struct Task
+		{
+			Job			Body;		///< The function to run
+			Counter*	Signal;		///< The counter to count down afterwards, may be nullptr
+		};
+
+		////////////////////////////////////////////////////////////
+		/// \brief Define the queue and the statistics of a worker.
+		/// 
+		////////////////////////////////////////////////////////////
+		struct Worker
+		{
+			std::mutex			Mutex;				///< Guards the queue
+			std::deque<Task>	Queue;				///< The owner takes from the back, thieves from the front
+			std::thread			Thread;				///< The worker thread
+			std::atomic<u64>	JobCount = 0;		///< The number of jobs run
+			std::atomic<u64>	StealCount = 0;		///< The number of jobs taken from other workers
+			std::atomic<i64>	BusyTime = 0;		///< The time spent running jobs in nanoseconds
+		};
+
+		////////////////////////////////////////////////////////////
+		/// \brief Put a job into a queue and wake a worker, or run
+		///		   it right away if the pool is not running.
+		/// 
+		////////////////////////////////////////////////////////////
+		static void Push(Task task)
+		{
+			// Stop() and Start() can't swap the workers while we pick a queue
+			std::shared_lock poolLock(PoolMutex);
+
+			if(!Running)
+			{
+				poolLock.unlock();
+				Run(task, NoWorker, false);
+				return;
+			}
+
+			// jobs of a job stay with its worker, everything else is spread
+			const u32 index = CurrentWorker != NoWorker ? CurrentWorker : NextQueue++ % (u32)Workers.size();
+			Worker& worker = *Workers[index];
+
+			{
+				std::scoped_lock lock(worker.Mutex);
+				worker.Queue.push_back(std::move(task));
+			}
+
+			// either the sleeper sees the job or we see the sleeper
+			++Queued;
+			if(Sleeping != 0)
+			{
+				{
+					std::scoped_lock lock(SleepMutex);
+				}
+
+				WorkAvailable.notify_one();
+			}
+		}
+
+		////////////////////////////////////////////////////////////
+		/// \brief Take the newest job of a worker, or the oldest
+		///		   job of any other worker.
+		/// 
+		////////////////////////////////////////////////////////////
+		static bool Take(u32 index, Task& task, bool& stolen)
+		{
+			if(Queued <= 0)
+			{
+				return false;
+			}
+
+			const u32 count = (u32)Workers.size();
+
+			if(index != NoWorker)
+			{
+				Worker& worker = *Workers[index];
+				std::scoped_lock lock(worker.Mutex);
+
+				if(!worker.Queue.empty())
+				{
+					task = std::move(worker.Queue.back());
+					worker.Queue.pop_back();
+					--Queued;
+					stolen = false;
+					return true;
+				}
+			}
+
+			// start with the neighbour, so thieves don't all pick the same victim
+			const u32 first = index != NoWorker ? index + 1 : 0;
+			for(u32 i = 0; i < count; ++i)
+			{
+				const u32 victimIndex = (first + i) % count;
+				if(victimIndex == index)
+				{
+					continue;
+				}
+
+				Worker& victim = *Workers[victimIndex];
+				std::scoped_lock lock(victim.Mutex);
+
+				if(!victim.Queue.empty())
+				{
+					task = std::move(victim.Queue.front());
+					victim.Queue.pop_front();
+					--Queued;
+					stolen = true;
+					return true;
+				}
+			}
+
+			return false;
+		}
+
+		////////////////////////////////////////////////////////////
+		/// \brief Take a job for the calling thread, which may be
+		///		   outside the pool.
+		/// 
+		////////////////////////////////////////////////////////////
+		static bool Help(Task& task, bool& stolen)
+		{
+			// a worker keeps the queues alive until it returns
+			if(CurrentWorker != NoWorker)
+			{
+				return Take(CurrentWorker, task, stolen);
+			}
+
+			std::shared_lock poolLock(PoolMutex);
+			return Running && Take(NoWorker, task, stolen);
+		}
+
+		////////////////////////////////////////////////////////////
+		/// \brief Run a job and count down its counter.
+		/// 
+		////////////////////////////////////////////////////////////
+		static void Run(Task& task, u32 index, bool stolen)
+		{
+			++JobDepth;
+
+			if(index != NoWorker)
+			{
+				Worker& worker = *Workers[index];
+				const Stopwatch busyTimer = Stopwatch::StartNew();
+
+				task.Body();
+
+				worker.BusyTime += busyTimer.GetElapsedTime().ToNanoseconds<i64>();
+				++worker.JobCount;
+				worker.StealCount += stolen ? 1 : 0;
+			} else
+			{
+				task.Body();
+			}
+
+			// release the captures before anyone waiting for the job wakes up
+			task.Body = nullptr;
+			--JobDepth;
+
+			if(task.Signal)
+			{
+				Release(*task.Signal);
+			}
+
+			if(--Unfinished == 0)
+			{
+				{
+					std::scoped_lock lock(SleepMutex);
+				}
+
+				Idle.notify_all();
+			}
+		}
+
+		////////////////////////////////////////////////////////////
+		/// \brief Count down a counter and queue the jobs that
+		///		   waited for it.
+		/// 
+		////////////////////////////////////////////////////////////
+		static void Release(Counter& counter)
+		{
+			std::vector<std::pair<Job, Counter*>> ready;
+
+			// under the lock, so Submit() can't park a job on a counter that just reached zero
+			{
+				std::scoped_lock lock(counter.mutex);
+				if(counter.value.fetch_sub(1) == 1)
+				{
+					ready.swap(counter.waiting);
+
+					// still under the lock, Wait() takes it before the counter may be destroyed
+					counter.value.notify_all();
+				}
+			}
+
+			for(auto& [job, jobCounter] : ready)
+			{
+				Push({ std::move(job), jobCounter });
+			}
+		}
+
+		////////////////////////////////////////////////////////////
+		/// \brief Run jobs until the pool is stopped.
+		/// 
+		////////////////////////////////////////////////////////////
+		static void Work(u32 index)
+		{
+			CORE_PROFILE_THREAD("Job Worker");
+
+			CurrentWorker = index;
+
+			Task task;
+			bool stolen = false;
+
+			while(true)
+			{
+				if(Take(index, task, stolen))
+				{
+					Run(task, index, stolen);
+					continue;
+				}
+
+				std::unique_lock lock(SleepMutex);
+				++Sleeping;
+				WorkAvailable.wait(lock, [] { return Stopping || Queued > 0; });
+				--Sleeping;
+
+				if(Stopping && Queued <= 0)
+				{
+					break;
+				}
+			}
+
+			CurrentWorker = NoWorker;
+		}
+
+		////////////////////////////////////////////////////////////
+		/// Static member data
+		/// 
+		////////////////////////////////////////////////////////////
+		static inline std::vector<std::unique_ptr<Worker>>	Workers;				///< Created by Start(), removed by Stop()
+		static inline std::atomic_bool						Running = false;		///< The workers are running
+		static inline std::shared_mutex						PoolMutex;				///< Held exclusively by Start() and Stop() while they change Workers and Running
+		static inline std::atomic<i64>						Queued = 0;				///< The jobs in all queues, briefly negative while a push is counted
+		static inline std::atomic<u64>						Unfinished = 0;			///< The submitted jobs that have not finished yet
+		static inline std::atomic<u32>						NextQueue = 0;			///< The queue of the next job submitted from outside the pool
+		static inline std::atomic<u32>						Sleeping = 0;			///< The workers waiting for jobs
+		static inline std::mutex							SleepMutex;				///< Guards the sleep of the workers
+		static inline std::condition_variable				WorkAvailable;			///< Wakes the workers
+		static inline std::condition_variable				Idle;					///< Signals that the last job finished
+		static inline bool									Stopping = false;		///< Tells the workers to quit
+		static inline Stopwatch								Uptime;					///< Restarted by Start()
+		static inline thread_local u32						CurrentWorker = NoWorker;	///< The index of the calling worker
+		static inline thread_local u32						JobDepth = 0;			///< The number of jobs the calling thread is running
+
+	};
+
+	////////////////////////////////////////////////////////////
+	bool Jobs::Counter::IsDone() const
+	{
+		return value == 0;
+	}
+
+	////////////////////////////////////////////////////////////
+	u32 Jobs::Counter::GetValue() const
+	{
+		return value;
+	}
+
+	////////////////////////////////////////////////////////////
+	void Jobs::Start(u32 workerCount)
+	{
+		std::unique_lock poolLock(Impl::PoolMutex);
+
+		if(Impl::Running)
+		{
+			return;
+		}
+
+		// the calling thread helps out in ParallelFor() and Wait()
+		if(workerCount == 0)
+		{
+			workerCount = std::max(std::thread::hardware_concurrency(), 2u) - 1;
+		}
+
+		// all queues must exist before the first thief looks at them
+		for(u32 i = 0; i < workerCount; ++i)
+		{
+			Impl::Workers.push_back(std::make_unique<Impl::Worker>());
+		}
+
+		Impl::Uptime = Stopwatch::StartNew();
+		Impl::Running = true;
+
+		for(u32 i = 0; i < workerCount; ++i)
+		{
+			Impl::Workers[i]->Thread = std::thread(&Impl::Work, i);
+		}
+	}
+
+	////////////////////////////////////////////////////////////
+	void Jobs::Stop()
+	{
+		if(!Impl::Running)
+		{
+			return;
+		}
+
+		WaitIdle();
+
+		// from here on new jobs run on the submitting thread, the workers finish the queued ones
+		{
+			std::unique_lock poolLock(Impl::PoolMutex);
+			Impl::Running = false;
+		}
+
+		{
+			std::scoped_lock lock(Impl::SleepMutex);
+			Impl::Stopping = true;
+		}
+
+		Impl::WorkAvailable.notify_all();
+
+		for(const std::unique_ptr<Impl::Worker>& worker : Impl::Workers)
+		{
+			worker->Thread.join();
+		}
+
+		std::unique_lock poolLock(Impl::PoolMutex);
+		Impl::Workers.clear();
+		Impl::Queued = 0;
+		Impl::NextQueue = 0;
+		Impl::Stopping = false;
+	}
+
+	////////////////////////////////////////////////////////////
+	bool Jobs::IsRunning()
+	{
+		return Impl::Running;
+	}
+
+	////////////////////////////////////////////////////////////
+	u32 Jobs::GetWorkerCount()
+	{
+		std::shared_lock poolLock(Impl::PoolMutex);
+		return Impl::Running ? (u32)Impl::Workers.size() : 0;
+	}
+
+	////////////////////////////////////////////////////////////
+	bool Jobs::IsInJob()
+	{
+		return Impl::CurrentWorker != Impl::NoWorker || Impl::JobDepth != 0;
+	}
+
+	////////////////////////////////////////////////////////////
+	void Jobs::Submit(Job job, Counter* counter, Counter* dependency)
+	{
+		if(counter)
+		{
+			++counter->value;
+		}
+
+		++Impl::Unfinished;
+
+		// park the job on the dependency, its last job queues it
+		if(dependency)
+		{
+			std::scoped_lock lock(dependency->mutex);
+			if(dependency->value != 0)
+			{
+				dependency->waiting.emplace_back(std::move(job), counter);
+				return;
+			}
+		}
+
+		Impl::Push({ std::move(job), counter });
+	}
+
+	////////////////////////////////////////////////////////////
+	void Jobs::ParallelFor(u32 count, u32 grain, const std::function<void(u32 begin, u32 end)>& body)
+	{
+		if(count == 0)
+		{
+			return;
+		}
+
+		// enough sub-ranges for the workers that finish early to steal from the others
+		const u32 chunks = (count + std::max(grain, 1u) - 1) / std::max(grain, 1u);
+		const u32 ranges = std::min(chunks, (GetWorkerCount() + 1) * Impl::RangesPerThread);
+
+		if(ranges <= 1 || !Impl::Running)
+		{
+			body(0, count);
+			return;
+		}
+
+		Counter counter;
+
+		// the first sub-range is done on this thread
+		for(u32 i = 1; i < ranges; ++i)
+		{
+			const u32 begin = (u32)((u64)count * i / ranges);
+			const u32 end = (u32)((u64)count * (i + 1) / ranges);
+			Submit([&body, begin, end] { body(begin, end); }, &counter);
+		}
+
+		body(0, (u32)((u64)count / ranges));
+		Wait(counter);
+	}
+
+	////////////////////////////////////////////////////////////
+	void Jobs::Wait(Counter& counter)
+	{
+		Impl::Task task;
+		bool stolen = false;
+		u32 spins = 0;
+
+		while(!counter.IsDone())
+		{
+			if(Impl::Help(task, stolen))
+			{
+				Impl::Run(task, Impl::CurrentWorker, stolen);
+				spins = 0;
+				continue;
+			}
+
+			// a job keeps helping, the jobs it waits for may be queued behind workers that wait as well
+			if(++spins < Impl::SpinCount || IsInJob())
+			{
+				std::this_thread::yield();
+				continue;
+			}
+
+			// the workers finish the rest, sleep until the last one counts down to zero
+			if(const u32 value = counter.value.load(); value != 0)
+			{
+				counter.value.wait(value);
+			}
+		}
+
+		// the last job may still be handing over the jobs that waited for the counter
+		std::scoped_lock lock(counter.mutex);
+	}
+
+	////////////////////////////////////////////////////////////
+	void Jobs::WaitIdle()
+	{
+		Impl::Task task;
+		bool stolen = false;
+
+		while(Impl::Unfinished != 0)
+		{
+			// help with the queued jobs, then sleep until the running ones are done
+			if(Impl::Help(task, stolen))
+			{
+				Impl::Run(task, Impl::NoWorker, stolen);
+				continue;
+			}
+
+			std::unique_lock lock(Impl::SleepMutex);
+			Impl::Idle.wait_for(lock, std::chrono::milliseconds(1), [] { return Impl::Unfinished == 0; });
+		}
+	}
+
+	////////////////////////////////////////////////////////////
+	Jobs::WorkerStats Jobs::GetWorkerStats(u32 worker)
+	{
+		std::shared_lock poolLock(Impl::PoolMutex);
+		const Impl::Worker& state = *Impl::Workers[worker];
+		const Time busyTime = Nanoseconds(state.BusyTime.load());
+		const float uptime = Impl::Uptime.GetElapsedTime().ToSeconds<float>();
+
+		return {
+			state.JobCount,
+			state.StealCount,
+			busyTime,
+			uptime > 0.0f ? std::clamp(busyTime.ToSeconds<float>() / uptime, 0.0f, 1.0f) : 0.0f
+		};
+	}
+}
\ No newline at end of file
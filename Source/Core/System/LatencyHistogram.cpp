@@ -0,0 +1,120 @@
+﻿// 
+// LatencyHistogram.cpp
+// Core
+// 
+// Created by Felix Busch on 19.10.2026.
+// Copyright © 2026 Felix Busch. All rights reserved.
+// 
+
+#include <Core/System/LatencyHistogram.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+
+namespace Core
+{
+	////////////////////////////////////////////////////////////
+	LatencyHistogram::LatencyHistogram():
+		buckets{},
+		count(0),
+		sum(0),
+		max(Time::Zero)
+	{
+	}
+
+	////////////////////////////////////////////////////////////
+	void LatencyHistogram::Record(const Time& duration)
+	{
+		const u64 nanoseconds = (u64)std::max<i64>(duration.ToNanoseconds<i64>(), 0);
+
+		++buckets[GetBucket(nanoseconds)];
+		++count;
+		sum += nanoseconds;
+		max = std::max(max, duration);
+	}
+
+	////////////////////////////////////////////////////////////
+	void LatencyHistogram::Reset()
+	{
+		buckets.fill(0);
+		count = 0;
+		sum = 0;
+		max = Time::Zero;
+	}
+
+	////////////////////////////////////////////////////////////
+	Time LatencyHistogram::GetPercentile(float percentile) const
+	{
+		if(count == 0)
+		{
+			return Time::Zero;
+		}
+
+		// the number of samples that have to lie at or below the result
+		const float clamped = std::clamp(percentile, 0.0f, 100.0f);
+		const u64 rank = std::max<u64>((u64)std::ceil((double)clamped / 100.0 * (double)count), 1);
+
+		u64 seen = 0;
+		for(u32 bucket = 0; bucket < BucketCount; ++bucket)
+		{
+			seen += buckets[bucket];
+
+			if(seen >= rank)
+			{
+				// the bucket bound may lie above the longest sample
+				return std::min(Nanoseconds((i64)GetUpperBound(bucket)), max);
+			}
+		}
+
+		return max;
+	}
+
+	////////////////////////////////////////////////////////////
+	Time LatencyHistogram::GetMean() const
+	{
+		return count == 0 ? Time::Zero : Nanoseconds((i64)(sum / count));
+	}
+
+	////////////////////////////////////////////////////////////
+	const Time& LatencyHistogram::GetMax() const
+	{
+		return max;
+	}
+
+	////////////////////////////////////////////////////////////
+	u64 LatencyHistogram::GetCount() const
+	{
+		return count;
+	}
+
+	////////////////////////////////////////////////////////////
+	u32 LatencyHistogram::GetBucket(u64 nanoseconds)
+	{
+		// small values get a bucket of their own
+		if(nanoseconds < SubBucketCount)
+		{
+			return (u32)nanoseconds;
+		}
+
+		// the position of the highest bit selects the power of two, the bits below it the sub bucket
+		const u32 exponent = (u32)std::bit_width(nanoseconds) - 1;
+		const u32 subBucket = (u32)(nanoseconds >> (exponent - SubBucketBits)) & (SubBucketCount - 1);
+
+		return (exponent - SubBucketBits + 1) * SubBucketCount + subBucket;
+	}
+
+	////////////////////////////////////////////////////////////
+	u64 LatencyHistogram::GetUpperBound(u32 bucket)
+	{
+		if(bucket < SubBucketCount)
+		{
+			return bucket;
+		}
+
+		const u32 shift = bucket / SubBucketCount - 1;
+		const u64 subBucket = bucket % SubBucketCount;
+
+		return ((SubBucketCount + subBucket + 1) << shift) - 1;
+	}
+}
\ No newline at end of file
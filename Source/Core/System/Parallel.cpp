@@ -0,0 +1,53 @@
+﻿// 
+// Parallel.cpp
+// Core
+// 
+// Created by Felix Busch on 19.10.2026.
+// Copyright © 2026 Felix Busch. All rights reserved.
+// 
+
+#include <Core/System/Parallel.hpp>
+#include <Core/System/Jobs.hpp>
+
+#include <algorithm>
+#include <atomic>
+
+namespace Core
+{
+
+	////////////////////////////////////////////////////////////
+	/// The maximum number of threads, 0 means automatic
+	/// 
+	////////////////////////////////////////////////////////////
+	static std::atomic<u32> ThreadLimit = 0;
+
+	////////////////////////////////////////////////////////////
+	void Parallel::For(u32 count, u32 grain, const std::function<void(u32 begin, u32 end)>& body)
+	{
+		// fewer sub-ranges than the limit can't keep more threads busy
+		if(const u32 limit = ThreadLimit)
+		{
+			grain = std::max(grain, (count + limit - 1) / limit);
+		}
+
+		Jobs::ParallelFor(count, grain, body);
+	}
+
+	////////////////////////////////////////////////////////////
+	void Parallel::SetThreadCount(u32 threadCount)
+	{
+		ThreadLimit = threadCount;
+	}
+
+	////////////////////////////////////////////////////////////
+	u32 Parallel::GetThreadCount()
+	{
+		if(const u32 limit = ThreadLimit)
+		{
+			return limit;
+		}
+
+		return Jobs::GetWorkerCount() + 1;
+	}
+
+}
\ No newline at end of file
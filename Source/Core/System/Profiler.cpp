@@ -0,0 +1,552 @@
+﻿// 
+// Profiler.cpp
+// Core
+// 
+// Created by Felix Busch on 19.10.2026.
+// Copyright © 2026 Felix Busch. All rights reserved.
+// 
+
+#include <Core/System/Profiler.hpp>
+#include <Core/System/Error.hpp>
+
+#ifdef CORE_ENABLE_PROFILER
+#include <Core/System/SpscQueue.hpp>
+#include <Core/System/Types.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if defined(_M_X64) || defined(_M_IX86)
+#include <intrin.h>
+#define CORE_PROFILER_TSC
+#elif defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define CORE_PROFILER_TSC
+#endif
+#endif
+
+namespace Core
+{
+#ifdef CORE_ENABLE_PROFILER
+	////////////////////////////////////////////////////////////
+	/// \brief The number of records each thread can hold until
+	///		   the flusher drains them
+	/// 
+	////////////////////////////////////////////////////////////
+	inline static constexpr usize ThreadCapacity = 1 << 16;
+
+	////////////////////////////////////////////////////////////
+	/// \brief How often the flusher drains the queues
+	/// 
+	////////////////////////////////////////////////////////////
+	inline static constexpr std::chrono::milliseconds FlushInterval(10);
+
+	////////////////////////////////////////////////////////////
+	/// \brief A single begin or end record
+	/// 
+	////////////////////////////////////////////////////////////
+	struct ProfileRecord
+	{
+		const char*		Name;		///< The name of the scope
+		i64				Timestamp;	///< The value of GetTimestamp()
+		Profiler::Phase	Phase;		///< Begin or end of the scope
+	};
+
+	////////////////////////////////////////////////////////////
+	/// \brief The records of one thread
+	/// 
+	////////////////////////////////////////////////////////////
+	struct ProfileThread
+	{
+		explicit ProfileThread(u32 id):
+			Records(ThreadCapacity),
+			Id(id),
+			Name(nullptr),
+			WrittenName(nullptr),
+			Exited(false)
+		{
+		}
+
+		SpscQueue<ProfileRecord>	Records;		///< Written by the thread, read by the flusher
+		u32							Id;				///< The thread id in the trace
+		std::atomic<const char*>	Name;			///< The name given by SetThreadName()
+		const char*					WrittenName;	///< The name already written to the trace (flusher only)
+		std::vector<const char*>	Open;			///< The scopes written as begun but not yet ended (flusher only)
+		bool						Exited;			///< The thread has ended, its buffer is recycled once drained (guarded by the mutex)
+	};
+
+	////////////////////////////////////////////////////////////
+	/// \brief The shared state of the profiler
+	/// 
+	////////////////////////////////////////////////////////////
+	struct ProfileState
+	{
+		std::atomic_bool							Running = false;	///< Records are taken
+		std::atomic<u64>							Dropped = 0;		///< Records dropped because a queue was full
+		std::mutex									Mutex;				///< Guards the members below
+		std::condition_variable						Condition;			///< Wakes the flusher when stopping
+		std::vector<std::unique_ptr<ProfileThread>>	Threads;			///< One entry per thread that recorded and may still have records
+		std::vector<std::unique_ptr<ProfileThread>>	Recycled;			///< Drained buffers of ended threads, reused by new threads
+		u32											NextId = 1;			///< The trace id of the next thread
+		std::thread									Flusher;			///< Writes the records to the file
+		bool										Stopping = false;	///< Tells the flusher to quit
+		std::ofstream								File;				///< The trace file
+		bool										FirstEvent = true;	///< No comma before the first event
+		i64											Origin = 0;			///< The timestamp of Start()
+		i64											ClockOrigin = 0;	///< The steady clock at Start() in nanoseconds
+		double										Scale = 1.0;		///< Nanoseconds per timestamp unit
+	};
+
+	////////////////////////////////////////////////////////////
+	static ProfileState& GetState()
+	{
+		static ProfileState state;
+		return state;
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Move a drained buffer of an ended thread to the
+	///		   recycled ones
+	/// 
+	///	Must be called with the mutex held.
+	/// 
+	////////////////////////////////////////////////////////////
+	static void Recycle(ProfileState& state, ProfileThread& thread)
+	{
+		const auto itr = std::ranges::find_if(state.Threads, [&](const std::unique_ptr<ProfileThread>& entry) { return entry.get() == &thread; });
+		state.Recycled.push_back(std::move(*itr));
+		state.Threads.erase(itr);
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Hand the buffer of a thread back when it ends
+	/// 
+	///	Each buffer holds ThreadCapacity records, so threads that
+	///	come and go (e.g. jobs restarted by SetJobWorkerCount())
+	///	must not keep theirs forever.
+	/// 
+	////////////////////////////////////////////////////////////
+	struct ThreadSlot
+	{
+		~ThreadSlot()
+		{
+			if(!Thread)
+				return;
+
+			ProfileState& state = GetState();
+			std::lock_guard lock(state.Mutex);
+
+			// a session in progress still writes the remaining records
+			if(state.File.is_open())
+			{
+				Thread->Exited = true;
+				return;
+			}
+
+			ProfileRecord record;
+			while(Thread->Records.TryPop(record))
+			{
+			}
+
+			Recycle(state, *Thread);
+		}
+
+		ProfileThread* Thread = nullptr;
+	};
+
+	////////////////////////////////////////////////////////////
+	static thread_local ThreadSlot currentThread;
+
+	////////////////////////////////////////////////////////////
+	static i64 GetClock()
+	{
+		return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Read the cheapest monotonic counter available
+	/// 
+	///	On x86 this is the time stamp counter, which takes a
+	///	fraction of a steady clock read. The flusher converts it
+	///	to nanoseconds against the steady clock.
+	/// 
+	////////////////////////////////////////////////////////////
+	static i64 GetTimestamp()
+	{
+#ifdef CORE_PROFILER_TSC
+		return (i64)__rdtsc();
+#else
+		return GetClock();
+#endif
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Measure the rate of GetTimestamp() over the whole
+	///		   session so far
+	/// 
+	////////////////////////////////////////////////////////////
+	static void Calibrate(ProfileState& state)
+	{
+		const i64 ticks = GetTimestamp() - state.Origin;
+		const i64 nanoseconds = GetClock() - state.ClockOrigin;
+
+		if(ticks > 0 && nanoseconds > 0)
+		{
+			state.Scale = (double)nanoseconds / (double)ticks;
+		}
+	}
+
+	////////////////////////////////////////////////////////////
+	static ProfileThread& GetCurrentThread()
+	{
+		if(!currentThread.Thread)
+		{
+			ProfileState& state = GetState();
+			std::lock_guard lock(state.Mutex);
+
+			if(state.Recycled.empty())
+			{
+				state.Threads.push_back(std::make_unique<ProfileThread>(state.NextId));
+			} else
+			{
+				// a new id keeps the threads apart in the trace
+				ProfileThread& thread = *state.Recycled.back();
+				thread.Id = state.NextId;
+				thread.Name = nullptr;
+				thread.WrittenName = nullptr;
+				thread.Open.clear();
+				thread.Exited = false;
+
+				state.Threads.push_back(std::move(state.Recycled.back()));
+				state.Recycled.pop_back();
+			}
+
+			++state.NextId;
+			currentThread.Thread = state.Threads.back().get();
+		}
+
+		return *currentThread.Thread;
+	}
+
+	////////////////////////////////////////////////////////////
+	static void WriteEscaped(std::string& output, const char* text)
+	{
+		for(; *text; ++text)
+		{
+			if(*text == '"' || *text == '\\')
+			{
+				output += '\\';
+			}
+
+			output += *text;
+		}
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Append a begin or end event to the trace
+	/// 
+	////////////////////////////////////////////////////////////
+	static void WriteEvent(ProfileState& state, std::string& output, const ProfileThread& thread, const char* name, Profiler::Phase phase, i64 timestamp)
+	{
+		// microseconds with nanosecond precision
+		const i64 nanoseconds = std::max((i64)((double)(timestamp - state.Origin) * state.Scale), (i64)0);
+		const std::string fraction = std::to_string(1000 + nanoseconds % 1000);
+
+		output += state.FirstEvent ? "\n" : ",\n";
+		output += "{\"name\":\"";
+		WriteEscaped(output, name);
+		output += phase == Profiler::Begin ? "\",\"ph\":\"B\",\"ts\":" : "\",\"ph\":\"E\",\"ts\":";
+		output += std::to_string(nanoseconds / 1000);
+		output += '.';
+		output.append(fraction, 1, 3);
+		output += ",\"pid\":1,\"tid\":";
+		output += std::to_string(thread.Id);
+		output += '}';
+		state.FirstEvent = false;
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Write a record, keeping the begin and end events
+	///		   of the thread balanced
+	/// 
+	///	An end whose begin is not in the trace, because it was
+	///	dropped or taken before Start(), is left out. An end that
+	///	matches an outer scope first ends the inner scopes that
+	///	lost their own end record.
+	/// 
+	////////////////////////////////////////////////////////////
+	static void WriteRecord(ProfileState& state, std::string& output, ProfileThread& thread, const ProfileRecord& record)
+	{
+		if(record.Phase == Profiler::Begin)
+		{
+			thread.Open.push_back(record.Name);
+			WriteEvent(state, output, thread, record.Name, Profiler::Begin, record.Timestamp);
+			return;
+		}
+
+		const auto scope = std::ranges::find(thread.Open.rbegin(), thread.Open.rend(), record.Name);
+		if(scope == thread.Open.rend())
+			return;
+
+		const usize depth = thread.Open.size() - (usize)(scope - thread.Open.rbegin()) - 1;
+		while(thread.Open.size() > depth)
+		{
+			WriteEvent(state, output, thread, thread.Open.back(), Profiler::End, record.Timestamp);
+			thread.Open.pop_back();
+		}
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Move the queued records into the file
+	/// 
+	///	Must be called with the mutex held, by one thread at a time.
+	///	Buffers of ended threads are recycled once drained.
+	/// 
+	////////////////////////////////////////////////////////////
+	static void Flush(ProfileState& state, bool write)
+	{
+		std::string output;
+		ProfileRecord record = {};
+
+		if(write)
+		{
+			Calibrate(state);
+		}
+
+		for(const std::unique_ptr<ProfileThread>& thread : state.Threads)
+		{
+			const char* name = thread->Name.load();
+			if(write && name && name != thread->WrittenName)
+			{
+				output += state.FirstEvent ? "\n" : ",\n";
+				output += "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":";
+				output += std::to_string(thread->Id);
+				output += ",\"args\":{\"name\":\"";
+				WriteEscaped(output, name);
+				output += "\"}}";
+				state.FirstEvent = false;
+				thread->WrittenName = name;
+			}
+
+			while(thread->Records.TryPop(record))
+			{
+				if(write)
+				{
+					WriteRecord(state, output, *thread, record);
+				}
+			}
+		}
+
+		// an ended thread doesn't push any more, so its buffer stays empty
+		for(usize i = state.Threads.size(); i-- > 0;)
+		{
+			if(state.Threads[i]->Exited)
+			{
+				// the scopes still open can't end any more
+				const i64 now = GetTimestamp();
+				while(write && !state.Threads[i]->Open.empty())
+				{
+					WriteEvent(state, output, *state.Threads[i], state.Threads[i]->Open.back(), Profiler::End, now);
+					state.Threads[i]->Open.pop_back();
+				}
+
+				Recycle(state, *state.Threads[i]);
+			}
+		}
+
+		if(write)
+		{
+			state.File << output;
+		}
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief End the scopes that are still open at Stop()
+	/// 
+	///	Their end records are not taken any more, viewers would
+	///	otherwise stretch them to the end of the trace or reject
+	///	the file.
+	/// 
+	////////////////////////////////////////////////////////////
+	static void CloseOpenScopes(ProfileState& state)
+	{
+		std::string output;
+		const i64 now = GetTimestamp();
+
+		for(const std::unique_ptr<ProfileThread>& thread : state.Threads)
+		{
+			while(!thread->Open.empty())
+			{
+				WriteEvent(state, output, *thread, thread->Open.back(), Profiler::End, now);
+				thread->Open.pop_back();
+			}
+		}
+
+		state.File << output;
+	}
+
+	////////////////////////////////////////////////////////////
+	bool Profiler::Start(const std::filesystem::path& filepath)
+	{
+		ProfileState& state = GetState();
+		std::unique_lock lock(state.Mutex);
+
+		if(state.Flusher.joinable())
+		{
+			Err() << "The profiler is already running" << std::endl;
+			return false;
+		}
+
+		state.File.open(filepath, std::ios::trunc);
+		if(!state.File)
+		{
+			Err() << "Failed to create the trace file " << filepath << std::endl;
+			return false;
+		}
+
+		// throw away what was recorded while stopping the previous session
+		Flush(state, false);
+
+		for(const std::unique_ptr<ProfileThread>& thread : state.Threads)
+		{
+			thread->WrittenName = nullptr;
+			thread->Open.clear();
+		}
+
+		state.File << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+		state.FirstEvent = true;
+		state.Stopping = false;
+		state.Origin = GetTimestamp();
+		state.ClockOrigin = GetClock();
+		state.Scale = 1.0;
+		state.Dropped = 0;
+
+		state.Flusher = std::thread([&state]
+		{
+			std::unique_lock lock(state.Mutex);
+
+			while(!state.Condition.wait_for(lock, FlushInterval, [&state] { return state.Stopping; }))
+			{
+				Flush(state, true);
+			}
+		});
+
+		state.Running = true;
+		return true;
+	}
+
+	////////////////////////////////////////////////////////////
+	void Profiler::Stop()
+	{
+		ProfileState& state = GetState();
+		state.Running = false;
+
+		{
+			std::lock_guard lock(state.Mutex);
+			if(!state.Flusher.joinable())
+				return;
+
+			state.Stopping = true;
+		}
+
+		state.Condition.notify_all();
+		state.Flusher.join();
+
+		// write the records that were taken until now
+		std::lock_guard lock(state.Mutex);
+		Flush(state, true);
+		CloseOpenScopes(state);
+		state.File << "\n]}\n";
+		state.File.close();
+	}
+
+	////////////////////////////////////////////////////////////
+	bool Profiler::IsRunning()
+	{
+		return GetState().Running.load(std::memory_order_relaxed);
+	}
+
+	////////////////////////////////////////////////////////////
+	void Profiler::SetThreadName(const char* name)
+	{
+		GetCurrentThread().Name = name;
+	}
+
+	////////////////////////////////////////////////////////////
+	void Profiler::Emit(const char* name, Phase phase)
+	{
+		ProfileState& state = GetState();
+		if(!state.Running.load(std::memory_order_relaxed))
+			return;
+
+		const ProfileRecord record = { name, GetTimestamp(), phase };
+
+		if(!GetCurrentThread().Records.TryPush(record))
+		{
+			state.Dropped.fetch_add(1, std::memory_order_relaxed);
+		}
+	}
+
+	////////////////////////////////////////////////////////////
+	u64 Profiler::GetDroppedRecordCount()
+	{
+		return GetState().Dropped.load(std::memory_order_relaxed);
+	}
+
+	////////////////////////////////////////////////////////////
+	u64 Profiler::GetBufferCount()
+	{
+		ProfileState& state = GetState();
+		std::lock_guard lock(state.Mutex);
+		return state.Threads.size() + state.Recycled.size();
+	}
+#else
+	////////////////////////////////////////////////////////////
+	bool Profiler::Start([[maybe_unused]] const std::filesystem::path& filepath)
+	{
+		Err() << "The profiler is not available, build with CORE_ENABLE_PROFILER to use it" << std::endl;
+		return false;
+	}
+
+	////////////////////////////////////////////////////////////
+	void Profiler::Stop()
+	{
+	}
+
+	////////////////////////////////////////////////////////////
+	bool Profiler::IsRunning()
+	{
+		return false;
+	}
+
+	////////////////////////////////////////////////////////////
+	void Profiler::SetThreadName([[maybe_unused]] const char* name)
+	{
+	}
+
+	////////////////////////////////////////////////////////////
+	void Profiler::Emit([[maybe_unused]] const char* name, [[maybe_unused]] Phase phase)
+	{
+	}
+
+	////////////////////////////////////////////////////////////
+	u64 Profiler::GetDroppedRecordCount()
+	{
+		return 0;
+	}
+
+	////////////////////////////////////////////////////////////
+	u64 Profiler::GetBufferCount()
+	{
+		return 0;
+	}
+#endif
+}
\ No newline at end of file
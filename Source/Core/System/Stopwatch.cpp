@@ -18,6 +18,13 @@ namespace Core
 		return watch;
 	}
 
+	////////////////////////////////////////////////////////////
+	Time Stopwatch::GetTimestamp()
+	{
+		const std::chrono::nanoseconds sinceEpoch = Clock::now().time_since_epoch();
+		return Nanoseconds(sinceEpoch.count());
+	}
+
 	////////////////////////////////////////////////////////////
 	Stopwatch::Stopwatch():
 		isTicking(false)
@@ -14,6 +14,8 @@
 #include <Windows.h>
 #include <windowsx.h>
 
+#include <algorithm>
+
 namespace Core
 {
 	////////////////////////////////////////////////////////////
@@ -51,10 +53,23 @@ namespace Core
 			CursorVisible(true),
 			CursorGrabbed(false),
 			Handle(nullptr),
-			Cursor(LoadCursor(nullptr, IDC_ARROW))
+			Cursor(LoadCursor(nullptr, IDC_ARROW)),
+			WakeEvent(CreateEventW(nullptr, FALSE, FALSE, nullptr))
 		{
 		}
 
+		////////////////////////////////////////////////////////////
+		/// \brief Destructor
+		/// 
+		////////////////////////////////////////////////////////////
+		~Impl()
+		{
+			if(WakeEvent != nullptr)
+			{
+				CloseHandle(WakeEvent);
+			}
+		}
+
 		////////////////////////////////////////////////////////////
 		/// \brief Converts a windows key code to Core key code
 		/// 
@@ -247,13 +262,16 @@ namespace Core
 		////////////////////////////////////////////////////////////
 		LResult ProcessEvent(UINT uMsg, WPARAM wParam, LPARAM lParam)
 		{
-			// notify any event
-			WindowEvent generic = WindowEvent::Generic;
-			generic.Any.Handle = Handle;
-			generic.Any.Message = uMsg;
-			generic.Any.WParam = wParam;
-			generic.Any.LParam = lParam;
-			Window->PushEvent(generic);
+			// notify any event, but only if someone is listening
+			if(Window->HasEventListeners(WindowEvent::Generic))
+			{
+				WindowEvent generic = WindowEvent::Generic;
+				generic.Any.Handle = Handle;
+				generic.Any.Message = uMsg;
+				generic.Any.WParam = wParam;
+				generic.Any.LParam = lParam;
+				Window->PushEvent(generic);
+			}
 			
 			switch (uMsg)
 			{
@@ -508,7 +526,7 @@ namespace Core
 				{
 					if(KeyRepeatEnabled || (HIWORD(lParam) & KF_REPEAT) == 0)
 					{
-						WindowEvent event  = WindowEvent::KeyReleased;
+						WindowEvent event  = WindowEvent::KeyPressed;
 						event.Key.Code     = VirtualKeyCodeToCoreKeyCode(wParam, lParam);
 						event.Key.Alt      = HIWORD(GetKeyState(VK_MENU)) != 0;
 						event.Key.Control  = HIWORD(GetKeyState(VK_CONTROL)) != 0;
@@ -692,6 +710,7 @@ namespace Core
 		WindowHandle	Handle;				//!< The window Handle to interact with win32
 		CursorHandle	Cursor;				//!< The cursor to use when he's visible
 		UInt2			LastSize;			//!< The size before resizing
+		HANDLE			WakeEvent;			//!< Auto-reset event that interrupts WaitForEvents()
 
 	};
 
@@ -1142,4 +1161,52 @@ namespace Core
 		}
 	}
 
+	////////////////////////////////////////////////////////////
+	void Window::WaitForEvents(const Time& timeout)
+	{
+		// round up so short timeouts don't turn into a busy loop
+		const int64_t milliseconds = (timeout.ToNanoseconds<int64_t>() + Time::MillisecondsFactor - 1) / Time::MillisecondsFactor;
+		const DWORD dwMilliseconds = (DWORD)std::min<int64_t>(milliseconds, INFINITE - 1);
+
+		// MWMO_INPUTAVAILABLE also returns for messages that have been seen but not removed yet
+		const DWORD result = MsgWaitForMultipleObjectsEx(1, &impl->WakeEvent, dwMilliseconds, QS_ALLINPUT, MWMO_INPUTAVAILABLE);
+
+		if(result == WAIT_FAILED)
+		{
+			Err() << "MsgWaitForMultipleObjectsEx() failed with error " << GetLastError() << std::endl;
+		}
+	}
+
+	////////////////////////////////////////////////////////////
+	bool Window::MergeEvent(WindowEvent& last, const WindowEvent& next)
+	{
+		if(last.Type != next.Type)
+		{
+			return false;
+		}
+
+		switch(next.Type)
+		{
+			// only the latest position and size are of interest
+			case WindowEvent::MouseMoved:
+			case WindowEvent::Resized:
+			{
+				// keep the time of the first change so the latency isn't hidden
+				const Time timestamp = last.Timestamp;
+				last = next;
+				last.Timestamp = timestamp;
+				return true;
+			}
+
+			default:
+				return false;
+		}
+	}
+
+	////////////////////////////////////////////////////////////
+	void Window::Wake()
+	{
+		SetEvent(impl->WakeEvent);
+	}
+
 }
\ No newline at end of file
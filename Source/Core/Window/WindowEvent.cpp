@@ -7,6 +7,7 @@
 // 
 
 #include <Core/Window/WindowEvent.hpp>
+#include <Core/System/Stopwatch.hpp>
 
 namespace Core
 {
@@ -17,7 +18,8 @@ namespace Core
 
 	////////////////////////////////////////////////////////////
 	WindowEvent::WindowEvent(EventType type):
-		Type(type)
+		Type(type),
+		Timestamp(Stopwatch::GetTimestamp())
 	{
 	}
 }
\ No newline at end of file
@@ -0,0 +1,257 @@
+﻿// 
+// CoreBench.cpp
+// Core
+// 
+// Created by Felix Busch on 19.10.2026.
+// Copyright © 2026 Felix Busch. All rights reserved.
+// 
+
+#include <Core/Application/Benchmark.hpp>
+#include <Core/Application/Input.hpp>
+#include <Core/Application/Sketch.hpp>
+
+#include <Core/Graphics/CpuRenderTarget.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+using namespace Core;
+
+namespace
+{
+	////////////////////////////////////////////////////////////
+	/// \brief A sketch with the mix of shapes, transforms and
+	///		   input handling a typical sketch has.
+	/// 
+	///	A grid of rotating rectangles, a ring of ellipses around
+	///	the mouse, lines from the mouse to the grid and particles
+	///	spawned by clicks. Space switches the outlines on and off,
+	///	the wheel scales the ring.
+	/// 
+	////////////////////////////////////////////////////////////
+	class ShapesSketch : public Sketch
+	{
+	public:
+
+		ShapesSketch(CpuRenderTarget& target, const Input& input):
+			target(target),
+			input(input),
+			time(0.0f),
+			ringScale(1.0f),
+			outlines(true)
+		{
+		}
+
+		virtual void OnSetup() override
+		{
+			particles.reserve(256);
+		}
+
+		virtual void OnUpdate(float fixedDelta) override
+		{
+			for(Particle& particle : particles)
+			{
+				particle.Position += particle.Velocity * Float2(fixedDelta, fixedDelta);
+				particle.Life -= fixedDelta;
+			}
+
+			std::erase_if(particles, [](const Particle& particle) { return particle.Life <= 0.0f; });
+		}
+
+		virtual void OnDraw(float deltaTime) override
+		{
+			time += deltaTime;
+
+			const Float2 mouse(input.GetMousePosition());
+
+			if(input.IsKeyPressed(KeyCode::Space))
+			{
+				outlines = !outlines;
+			}
+
+			ringScale = std::max(0.25f, ringScale + input.GetMouseWheelDelta(MouseWheel::Vertical) * 0.1f);
+
+			if(input.IsMouseButtonPressed(MouseButton::Left))
+			{
+				for(u32 i = 0; i < 32; ++i)
+				{
+					const float angle = (float)i / 32.0f * 6.2831853f;
+					particles.push_back({ mouse, { std::cos(angle) * 120.0f, std::sin(angle) * 120.0f }, 1.0f });
+				}
+			}
+
+			target.Background(Color(24, 24, 32));
+
+			DrawGrid(mouse);
+			DrawRing(mouse);
+			DrawParticles();
+		}
+
+	private:
+
+		struct Particle
+		{
+			Float2	Position;
+			Float2	Velocity;
+			float	Life;
+		};
+
+		static constexpr u32	Columns		= 16;
+		static constexpr u32	Rows		= 9;
+		static constexpr float	CellSize	= 20.0f;
+
+		void DrawGrid(const Float2& mouse)
+		{
+			target.PushStyle();
+			target.RectMode(Center);
+			target.Fill(Color(80, 140, 220));
+
+			if(outlines)
+			{
+				target.Stroke(Color(230, 230, 240));
+				target.StrokeWeight(1.5f);
+			}
+
+			for(u32 row = 0; row < Rows; ++row)
+			{
+				for(u32 column = 0; column < Columns; ++column)
+				{
+					const float x = ((float)column + 0.5f) * CellSize * 2.0f;
+					const float y = ((float)row + 0.5f) * CellSize * 2.0f;
+
+					target.PushTransform(true);
+					target.Translate(x, y);
+					target.Rotate(Degrees(time * 45.0f + (float)(row * Columns + column) * 7.0f));
+					target.Rect(0.0f, 0.0f, CellSize, CellSize, 3.0f, 3.0f);
+					target.PopTransform();
+				}
+			}
+
+			// lines from the mouse to every other cell of the first row
+			target.Stroke(Color(255, 200, 80, 160));
+			target.StrokeWeight(1.0f);
+			for(u32 column = 0; column < Columns; column += 2)
+			{
+				target.Line(mouse.X, mouse.Y, ((float)column + 0.5f) * CellSize * 2.0f, CellSize);
+			}
+
+			target.PopStyle();
+		}
+
+		void DrawRing(const Float2& mouse)
+		{
+			constexpr u32 Count = 12;
+
+			target.PushStyle();
+			target.EllipseMode(Center);
+			target.Fill(Color(240, 90, 120, 180));
+
+			if(outlines)
+			{
+				target.Stroke(Color(255, 255, 255));
+			}
+
+			for(u32 i = 0; i < Count; ++i)
+			{
+				const float angle = (float)i / (float)Count * 6.2831853f + time;
+				const float radius = 48.0f * ringScale;
+				target.Ellipse(mouse.X + std::cos(angle) * radius, mouse.Y + std::sin(angle) * radius, 16.0f, 16.0f);
+			}
+
+			target.PopStyle();
+		}
+
+		void DrawParticles()
+		{
+			target.PushStyle();
+			target.NoStroke();
+
+			for(const Particle& particle : particles)
+			{
+				target.Fill(Color(255, 255, 180, (u8)(particle.Life * 255.0f)));
+				target.Ellipse(particle.Position.X, particle.Position.Y, 6.0f, 6.0f);
+			}
+
+			target.PopStyle();
+		}
+
+		CpuRenderTarget&		target;		///< The render target to draw into
+		const Input&			input;		///< The input snapshot of the frame
+		std::vector<Particle>	particles;	///< The particles spawned by clicks
+		float					time;		///< The seconds drawn so far
+		float					ringScale;	///< The scale of the ring, changed by the wheel
+		bool					outlines;	///< State whether the shapes are outlined
+	};
+
+	////////////////////////////////////////////////////////////
+	/// \brief Run the frames of Benchmark::Run() on a
+	///		   CpuRenderTarget, one fixed update per frame.
+	/// 
+	////////////////////////////////////////////////////////////
+	class CpuHost : public Benchmark::Host
+	{
+	public:
+
+		CpuHost(CpuRenderTarget& target, Sketch& sketch):
+			target(target),
+			sketch(sketch)
+		{
+		}
+
+		virtual void BeginFrame() override
+		{
+			target.ResetRenderStats();
+		}
+
+		virtual void Update(const Time& deltaTime) override
+		{
+			sketch.OnUpdate(deltaTime.ToSeconds<float>());
+		}
+
+		virtual bool BeginDraw() override
+		{
+			return target.BeginDraw();
+		}
+
+		virtual void Draw(const Time& deltaTime) override
+		{
+			sketch.OnDraw(deltaTime.ToSeconds<float>());
+			sketch.OnDrawGui();
+		}
+
+		virtual bool EndDraw() override
+		{
+			return target.EndDraw();
+		}
+
+		virtual const RenderStats& GetRenderStats() const override
+		{
+			return target.GetRenderStats();
+		}
+
+	private:
+
+		CpuRenderTarget&	target;	///< The render target the sketch draws into
+		Sketch&				sketch;	///< The sketch being run
+
+	};
+}
+
+int main(int argc, char* argv[])
+{
+	Benchmark::Options options;
+	if(!Benchmark::ParseArguments(argc, argv, options))
+	{
+		return 1;
+	}
+
+	CpuRenderTarget target;
+	target.Resize(options.Width, options.Height);
+
+	Input input;
+	ShapesSketch sketch(target, input);
+	CpuHost host(target, sketch);
+
+	return Benchmark::Run(options, sketch, input, host) ? 0 : 1;
+}
\ No newline at end of file
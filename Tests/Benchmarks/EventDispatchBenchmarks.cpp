@@ -0,0 +1,187 @@
+﻿// 
+// EventDispatchBenchmarks.cpp
+// Core
+// 
+// Created by Felix Busch on 19.10.2026.
+// Copyright © 2026 Felix Busch. All rights reserved.
+// 
+
+#include <Core/System/EventPublisher.hpp>
+#include <Core/System/StaticEventPublisher.hpp>
+#include <Core/Window/WindowEvent.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <utility>
+#include <vector>
+
+using namespace Core;
+
+namespace
+{
+	////////////////////////////////////////////////////////////
+	/// The number of events queued and dispatched per iteration,
+	/// a busy frame of mouse input
+	/// 
+	////////////////////////////////////////////////////////////
+	constexpr usize Burst = 64;
+
+	////////////////////////////////////////////////////////////
+	/// \brief Define a listener that sums up the mouse position,
+	///		   called directly or through an EventDelegate.
+	/// 
+	////////////////////////////////////////////////////////////
+	struct Counter
+	{
+		void OnEvent(const WindowEvent& event)
+		{
+			Sum += event.MouseMove.MouseX;
+		}
+
+		i64 Sum = 0;
+	};
+
+	////////////////////////////////////////////////////////////
+	/// \brief Define the same listener behind IEventListener.
+	/// 
+	////////////////////////////////////////////////////////////
+	class VirtualCounter : public IEventListener<WindowEvent>
+	{
+	public:
+
+		virtual void OnEvent(const WindowEvent& event) override
+		{
+			Sum += event.MouseMove.MouseX;
+		}
+
+		i64 Sum = 0;
+	};
+
+	////////////////////////////////////////////////////////////
+	/// \brief Create a mouse move event.
+	/// 
+	////////////////////////////////////////////////////////////
+	WindowEvent MakeEvent(i32 x)
+	{
+		WindowEvent event(WindowEvent::MouseMoved);
+		event.MouseMove.MouseX = x;
+		event.MouseMove.MouseY = -x;
+		return event;
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Queue a burst of events and dispatch them.
+	/// 
+	////////////////////////////////////////////////////////////
+	template<typename TPublisher>
+	void PushAndDispatch(TPublisher& publisher)
+	{
+		for(usize i = 0; i < Burst; ++i)
+		{
+			publisher.PushEvent(MakeEvent((i32)i));
+		}
+
+		publisher.DispatchEvents();
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Dispatch to listeners through IEventListener, the
+	///		   way EventPublisher notifies subscribers.
+	/// 
+	////////////////////////////////////////////////////////////
+	void BM_DispatchVirtual(benchmark::State& state)
+	{
+		const usize listenerCount = (usize)state.range(0);
+
+		std::vector<VirtualCounter> listeners(listenerCount);
+		EventPublisher<WindowEvent> publisher;
+		for(VirtualCounter& listener : listeners)
+		{
+			publisher.AddEventListener(listener);
+		}
+
+		for(auto _ : state)
+		{
+			PushAndDispatch(publisher);
+		}
+
+		for(const VirtualCounter& listener : listeners)
+		{
+			benchmark::DoNotOptimize(listener.Sum);
+		}
+
+		state.SetItemsProcessed(state.iterations() * (i64)(Burst * listenerCount));
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Dispatch to EventDelegates bound to the listeners.
+	/// 
+	////////////////////////////////////////////////////////////
+	void BM_DispatchDelegate(benchmark::State& state)
+	{
+		const usize listenerCount = (usize)state.range(0);
+
+		std::vector<Counter> listeners(listenerCount);
+		EventPublisher<WindowEvent> publisher;
+		for(Counter& listener : listeners)
+		{
+			publisher.AddEventDelegate(EventDelegate<WindowEvent>::Bind<&Counter::OnEvent>(listener));
+		}
+
+		for(auto _ : state)
+		{
+			PushAndDispatch(publisher);
+		}
+
+		for(const Counter& listener : listeners)
+		{
+			benchmark::DoNotOptimize(listener.Sum);
+		}
+
+		state.SetItemsProcessed(state.iterations() * (i64)(Burst * listenerCount));
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Repeat a type once per index of a pack.
+	/// 
+	////////////////////////////////////////////////////////////
+	template<typename T, usize>
+	using Repeat = T;
+
+	////////////////////////////////////////////////////////////
+	/// \brief Dispatch to a StaticEventPublisher, which folds
+	///		   over its listeners with direct calls.
+	/// 
+	////////////////////////////////////////////////////////////
+	template<usize... Indices>
+	void DispatchStatic(benchmark::State& state, std::index_sequence<Indices...>)
+	{
+		std::array<Counter, sizeof...(Indices)> listeners = {};
+		StaticEventPublisher<WindowEvent, Repeat<Counter, Indices>...> publisher(listeners[Indices]...);
+
+		for(auto _ : state)
+		{
+			PushAndDispatch(publisher);
+		}
+
+		for(const Counter& listener : listeners)
+		{
+			benchmark::DoNotOptimize(listener.Sum);
+		}
+
+		state.SetItemsProcessed(state.iterations() * (i64)(Burst * sizeof...(Indices)));
+	}
+
+	template<usize ListenerCount>
+	void BM_DispatchStatic(benchmark::State& state)
+	{
+		DispatchStatic(state, std::make_index_sequence<ListenerCount>());
+	}
+}
+
+BENCHMARK(BM_DispatchVirtual)->ArgName("listeners")->Arg(1)->Arg(4)->Arg(16);
+BENCHMARK_TEMPLATE(BM_DispatchStatic, 1);
+BENCHMARK_TEMPLATE(BM_DispatchStatic, 4);
+BENCHMARK_TEMPLATE(BM_DispatchStatic, 16);
+BENCHMARK(BM_DispatchDelegate)->ArgName("listeners")->Arg(1)->Arg(4)->Arg(16);
\ No newline at end of file
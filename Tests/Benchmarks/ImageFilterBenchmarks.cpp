@@ -0,0 +1,164 @@
+﻿// 
+// ImageFilterBenchmarks.cpp
+// Core
+// 
+// Created by Felix Busch on 19.10.2026.
+// Copyright © 2026 Felix Busch. All rights reserved.
+// 
+
+#include <Core/Graphics/ImageFilter.hpp>
+#include <Core/Graphics/PixelBuffer.hpp>
+#include <Core/System/Jobs.hpp>
+#include <Core/System/Parallel.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+using namespace Core;
+
+namespace
+{
+	////////////////////////////////////////////////////////////
+	/// The thread counts every filter is measured with
+	/// 
+	////////////////////////////////////////////////////////////
+	const std::vector<i64> Threads = { 1, 2, 4, 8 };
+
+	////////////////////////////////////////////////////////////
+	/// \brief Fill a buffer with a noisy, partly transparent
+	///		   test image.
+	/// 
+	////////////////////////////////////////////////////////////
+	void Generate(PixelBuffer& pixels, u32 size)
+	{
+		pixels.Resize(size, size);
+
+		u32 state = 0x9E3779B9u;
+		for(u32 y = 0; y < size; ++y)
+		{
+			for(u32 x = 0; x < size; ++x)
+			{
+				state ^= state << 13;
+				state ^= state >> 17;
+				state ^= state << 5;
+
+				const u8 alpha = (x + y) % 7 == 0 ? (u8)(state >> 24) : 255;
+				pixels.SetPixel(x, y, Color((u8)(x * 255 / size), (u8)(y * 255 / size), (u8)state, alpha));
+			}
+		}
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Let the filters use the given number of threads,
+	///		   the calling one included.
+	/// 
+	///	The job pool grows when it has fewer workers, so the
+	///	scaling can be measured on any machine. It only shows on
+	///	one with at least as many hardware threads.
+	/// 
+	////////////////////////////////////////////////////////////
+	void UseThreads(u32 threads)
+	{
+		if(Jobs::GetWorkerCount() + 1 < threads)
+		{
+			Jobs::Stop();
+			Jobs::Start(threads - 1);
+		}
+
+		Parallel::SetThreadCount(threads);
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Benchmark a single filter on square images.
+	/// 
+	////////////////////////////////////////////////////////////
+	void BM_Apply(benchmark::State& state, ImageFilter::Type type, float parameter)
+	{
+		const u32 size = (u32)state.range(0);
+		UseThreads((u32)state.range(1));
+
+		PixelBuffer source;
+		Generate(source, size);
+
+		PixelBuffer pixels;
+		for(auto _ : state)
+		{
+			state.PauseTiming();
+			pixels = source;
+			state.ResumeTiming();
+
+			ImageFilter::Apply(pixels, type, parameter);
+			benchmark::DoNotOptimize(pixels.GetPixels());
+		}
+
+		state.SetItemsProcessed(state.iterations() * size * size);
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Benchmark the convolution with a zero-sum edge
+	///		   detection kernel.
+	/// 
+	////////////////////////////////////////////////////////////
+	void BM_Convolve(benchmark::State& state)
+	{
+		const u32 size = (u32)state.range(0);
+		const u32 kernelSize = (u32)state.range(1);
+		UseThreads((u32)state.range(2));
+
+		std::vector<float> kernel(kernelSize * kernelSize, -1.0f);
+		kernel[kernel.size() / 2] = (float)(kernel.size() - 1);
+
+		PixelBuffer source;
+		Generate(source, size);
+
+		PixelBuffer pixels;
+		for(auto _ : state)
+		{
+			state.PauseTiming();
+			pixels = source;
+			state.ResumeTiming();
+
+			ImageFilter::Convolve(pixels, kernel.data(), kernelSize);
+			benchmark::DoNotOptimize(pixels.GetPixels());
+		}
+
+		state.SetItemsProcessed(state.iterations() * size * size);
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Benchmark the resampling behind Texture::Resized()
+	///		   from 1024x1024 to a square of the given size.
+	/// 
+	////////////////////////////////////////////////////////////
+	void BM_Resize(benchmark::State& state, ImageFilter::ResampleFilter filter)
+	{
+		const u32 size = (u32)state.range(0);
+		UseThreads((u32)state.range(1));
+
+		PixelBuffer source;
+		Generate(source, 1024);
+
+		PixelBuffer destination;
+		for(auto _ : state)
+		{
+			ImageFilter::Resize(source, destination, size, size, filter);
+			benchmark::DoNotOptimize(destination.GetPixels());
+		}
+
+		state.SetItemsProcessed(state.iterations() * size * size);
+	}
+}
+
+BENCHMARK_CAPTURE(BM_Apply, Blur, ImageFilter::Blur, 4.0f)->ArgNames({ "size", "threads" })->ArgsProduct({ { 256, 1024 }, Threads })->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK_CAPTURE(BM_Apply, BoxBlur, ImageFilter::BoxBlur, 4.0f)->ArgNames({ "size", "threads" })->ArgsProduct({ { 256, 1024 }, Threads })->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK_CAPTURE(BM_Apply, Threshold, ImageFilter::Threshold, 0.5f)->ArgNames({ "size", "threads" })->ArgsProduct({ { 256, 1024 }, Threads })->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK_CAPTURE(BM_Apply, Invert, ImageFilter::Invert, 0.0f)->ArgNames({ "size", "threads" })->ArgsProduct({ { 256, 1024 }, Threads })->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK_CAPTURE(BM_Apply, Gray, ImageFilter::Gray, 0.0f)->ArgNames({ "size", "threads" })->ArgsProduct({ { 256, 1024 }, Threads })->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK_CAPTURE(BM_Apply, Erode, ImageFilter::Erode, 2.0f)->ArgNames({ "size", "threads" })->ArgsProduct({ { 256, 1024 }, Threads })->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK_CAPTURE(BM_Apply, Dilate, ImageFilter::Dilate, 2.0f)->ArgNames({ "size", "threads" })->ArgsProduct({ { 256, 1024 }, Threads })->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK(BM_Convolve)->ArgNames({ "size", "kernel", "threads" })->ArgsProduct({ { 256, 1024 }, { 3, 5 }, Threads })->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK_CAPTURE(BM_Resize, Box, ImageFilter::Box)->ArgNames({ "size", "threads" })->ArgsProduct({ { 256, 2048 }, Threads })->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK_CAPTURE(BM_Resize, Bilinear, ImageFilter::Bilinear)->ArgNames({ "size", "threads" })->ArgsProduct({ { 256, 2048 }, Threads })->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK_CAPTURE(BM_Resize, Bicubic, ImageFilter::Bicubic)->ArgNames({ "size", "threads" })->ArgsProduct({ { 256, 2048 }, Threads })->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK_CAPTURE(BM_Resize, Lanczos3, ImageFilter::Lanczos3)->ArgNames({ "size", "threads" })->ArgsProduct({ { 256, 2048 }, Threads })->Unit(benchmark::kMillisecond)->UseRealTime();
\ No newline at end of file
@@ -0,0 +1,244 @@
+﻿// 
+// LayerPyramidBenchmarks.cpp
+// Core
+// 
+// Created by Felix Busch on 19.10.2026.
+// Copyright © 2026 Felix Busch. All rights reserved.
+// 
+
+#include <Core/Graphics/LayerPyramid.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+
+using namespace Core;
+
+namespace
+{
+	////////////////////////////////////////////////////////////
+	/// The tiles per chunk in each direction, as in TileMap
+	/// 
+	////////////////////////////////////////////////////////////
+	constexpr u32 ChunkSize = 32;
+
+	////////////////////////////////////////////////////////////
+	/// The memory of a layer of 32x32 tiles with 32x32 pixels
+	/// 
+	////////////////////////////////////////////////////////////
+	constexpr usize LayerBytes = 1024 * 1024 * 4;
+
+	////////////////////////////////////////////////////////////
+	/// The default byte budget of TileMap::Create()
+	/// 
+	////////////////////////////////////////////////////////////
+	constexpr usize ByteBudget = 256ull * 1024 * 1024;
+
+	////////////////////////////////////////////////////////////
+	/// \brief Define a renderer without any rendering cost.
+	/// 
+	///	Keeps track of the work and the memory, so the time
+	///	measured is the overhead of the pyramid alone. The cost
+	///	of Direct2D is measured with the --benchmark mode of a
+	///	sketch.
+	/// 
+	////////////////////////////////////////////////////////////
+	class NullRenderer : public LayerPyramid::Renderer
+	{
+	public:
+
+		virtual bool CreateLayer(u32, u32, u32) override	{ Peak = std::max(Peak, ++Resident); return true; }
+		virtual void ReleaseLayer(u32, u32, u32) override	{ --Resident; }
+		virtual bool RenderChunk(u32, u32) override			{ ++Chunks; return true; }
+		virtual bool RenderQuadrant(u32, u32, u32, u32, bool) override { ++Quadrants; return true; }
+		virtual bool RenderCell(u32, u32, u32, u32, u32, bool) override	{ ++Cells; return true; }
+
+		usize	Resident = 0;
+		usize	Peak = 0;
+		u64		Chunks = 0;
+		u64		Quadrants = 0;
+		u64		Cells = 0;
+	};
+
+	////////////////////////////////////////////////////////////
+	/// \brief Create a pyramid for a map full of tiles.
+	/// 
+	////////////////////////////////////////////////////////////
+	void CreateFull(LayerPyramid& pyramid, u32 tiles)
+	{
+		const u32 chunks = (tiles + ChunkSize - 1) / ChunkSize;
+		pyramid.Create(chunks, chunks, LayerBytes, ByteBudget);
+		pyramid.Reset(std::vector<u32>((usize)chunks * chunks, ChunkSize * ChunkSize));
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Draw a window of layers the way TileMap::Draw()
+	///		   does.
+	/// 
+	///	\return The number of layers that were up to date.
+	/// 
+	////////////////////////////////////////////////////////////
+	u32 DrawFrame(LayerPyramid& pyramid, NullRenderer& renderer, u32 level, u32 left, u32 top, u32 columns, u32 rows)
+	{
+		pyramid.BeginFrame(Time::FromMilliseconds(4));
+
+		const u32 right = std::min(left + columns, pyramid.GetWidth(level));
+		const u32 bottom = std::min(top + rows, pyramid.GetHeight(level));
+
+		u32 ready = 0, fallback = 0;
+		for(u32 y = top; y < bottom; ++y)
+		{
+			for(u32 x = left; x < right; ++x)
+			{
+				if(pyramid.Build(renderer, level, x, y))
+				{
+					++ready;
+				} else
+				{
+					pyramid.FindFallback(level, x, y, fallback);
+				}
+			}
+		}
+
+		return ready;
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Report the work and memory of a run.
+	/// 
+	////////////////////////////////////////////////////////////
+	void Report(benchmark::State& state, const NullRenderer& renderer)
+	{
+		state.counters["chunks"] = benchmark::Counter((double)renderer.Chunks, benchmark::Counter::kAvgIterations);
+		state.counters["quadrants"] = benchmark::Counter((double)renderer.Quadrants, benchmark::Counter::kAvgIterations);
+		state.counters["cells"] = benchmark::Counter((double)renderer.Cells, benchmark::Counter::kAvgIterations);
+		state.counters["peak_mb"] = (double)(renderer.Peak * LayerBytes) / (1024.0 * 1024.0);
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Build the whole map zoomed out from scratch.
+	/// 
+	////////////////////////////////////////////////////////////
+	void BM_ZoomOut(benchmark::State& state)
+	{
+		const u32 tiles = (u32)state.range(0);
+
+		NullRenderer renderer;
+		for(auto _ : state)
+		{
+			LayerPyramid pyramid;
+			CreateFull(pyramid, tiles);
+
+			const u32 top = pyramid.GetLevelCount() - 1;
+			while(DrawFrame(pyramid, renderer, top, 0, 0, 1, 1) == 0)
+			{
+			}
+
+			pyramid.Release(renderer);
+		}
+
+		Report(state, renderer);
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Scroll over the map at full resolution, a 1080p
+	///		   view covers 3x3 chunks.
+	/// 
+	////////////////////////////////////////////////////////////
+	void BM_Pan(benchmark::State& state)
+	{
+		const u32 tiles = (u32)state.range(0);
+
+		LayerPyramid pyramid;
+		CreateFull(pyramid, tiles);
+
+		NullRenderer renderer;
+		const u32 chunks = pyramid.GetWidth(0);
+		u32 frame = 0;
+
+		for(auto _ : state)
+		{
+			const u32 x = (frame / 8) % chunks;
+			const u32 y = (frame / 8 / chunks * 3) % chunks;
+			benchmark::DoNotOptimize(DrawFrame(pyramid, renderer, 0, x, y, 3, 3));
+			++frame;
+		}
+
+		state.SetItemsProcessed(state.iterations());
+		Report(state, renderer);
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Zoom from full resolution out to the whole map and
+	///		   back in, over 120 frames per direction.
+	/// 
+	////////////////////////////////////////////////////////////
+	void BM_ZoomCycle(benchmark::State& state)
+	{
+		const u32 tiles = (u32)state.range(0);
+
+		LayerPyramid pyramid;
+		CreateFull(pyramid, tiles);
+
+		NullRenderer renderer;
+		const u32 top = pyramid.GetLevelCount() - 1;
+		u32 frame = 0;
+
+		for(auto _ : state)
+		{
+			const u32 step = frame % 240;
+			const u32 level = (step < 120 ? step : 239 - step) * (top + 1) / 120;
+
+			// keep the view centered on the map
+			const u32 width = pyramid.GetWidth(level);
+			const u32 height = pyramid.GetHeight(level);
+			const u32 left = width > 3 ? width / 2 - 1 : 0;
+			const u32 upper = height > 3 ? height / 2 - 1 : 0;
+			benchmark::DoNotOptimize(DrawFrame(pyramid, renderer, level, left, upper, 3, 3));
+			++frame;
+		}
+
+		state.SetItemsProcessed(state.iterations());
+		Report(state, renderer);
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Change a tile and draw the zoomed out map again.
+	/// 
+	////////////////////////////////////////////////////////////
+	void BM_SetTile(benchmark::State& state)
+	{
+		const u32 tiles = (u32)state.range(0);
+
+		LayerPyramid pyramid;
+		CreateFull(pyramid, tiles);
+
+		NullRenderer renderer;
+		const u32 top = pyramid.GetLevelCount() - 1;
+		while(DrawFrame(pyramid, renderer, top, 0, 0, 1, 1) == 0)
+		{
+		}
+
+		renderer.Chunks = 0;
+		renderer.Quadrants = 0;
+
+		u32 state32 = 0x9E3779B9u;
+		for(auto _ : state)
+		{
+			state32 ^= state32 << 13;
+			state32 ^= state32 >> 17;
+			state32 ^= state32 << 5;
+
+			pyramid.Invalidate(state32 % pyramid.GetWidth(0), (state32 >> 16) % pyramid.GetHeight(0), 0);
+			benchmark::DoNotOptimize(DrawFrame(pyramid, renderer, top, 0, 0, 1, 1));
+		}
+
+		state.SetItemsProcessed(state.iterations());
+		Report(state, renderer);
+	}
+}
+
+BENCHMARK(BM_ZoomOut)->ArgName("tiles")->Arg(256)->Arg(1024)->Arg(4096)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_Pan)->ArgName("tiles")->Arg(256)->Arg(1024)->Arg(4096);
+BENCHMARK(BM_ZoomCycle)->ArgName("tiles")->Arg(256)->Arg(1024)->Arg(4096);
+BENCHMARK(BM_SetTile)->ArgName("tiles")->Arg(256)->Arg(1024)->Arg(4096);
\ No newline at end of file
@@ -0,0 +1,32 @@
+﻿// 
+// Main.cpp
+// Core
+// 
+// Created by Felix Busch on 19.10.2026.
+// Copyright © 2026 Felix Busch. All rights reserved.
+// 
+
+#include <Core/System/Jobs.hpp>
+
+#include <benchmark/benchmark.h>
+
+////////////////////////////////////////////////////////////
+/// \brief Run the benchmarks with the job pool started the
+///		   same way Application::Start() does.
+/// 
+////////////////////////////////////////////////////////////
+int main(int argc, char** argv)
+{
+	benchmark::Initialize(&argc, argv);
+	if(benchmark::ReportUnrecognizedArguments(argc, argv))
+	{
+		return 1;
+	}
+
+	Core::Jobs::Start();
+	benchmark::RunSpecifiedBenchmarks();
+	Core::Jobs::Stop();
+
+	benchmark::Shutdown();
+	return 0;
+}
\ No newline at end of file
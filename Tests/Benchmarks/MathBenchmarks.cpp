@@ -0,0 +1,303 @@
+﻿// 
+// MathBenchmarks.cpp
+// Core
+// 
+// Created by Felix Busch on 19.10.2026.
+// Copyright © 2026 Felix Busch. All rights reserved.
+// 
+
+#include <Core/System/Transform.hpp>
+#include <Core/Graphics/Transformation.hpp>
+#include <Core/Graphics/Animatable.hpp>
+#include <Core/Graphics/Color.hpp>
+
+#include "../LegacyTransform.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <vector>
+
+using namespace Core;
+
+namespace
+{
+	////////////////////////////////////////////////////////////
+	/// The number of inputs each benchmark cycles through, small
+	/// enough to stay in the L1 cache
+	/// 
+	////////////////////////////////////////////////////////////
+	constexpr usize InputCount = 256;
+
+	////////////////////////////////////////////////////////////
+	/// \brief Create invertible matrices with random entries.
+	/// 
+	////////////////////////////////////////////////////////////
+	std::vector<Transform> MakeTransforms()
+	{
+		std::mt19937 random(42);
+		std::uniform_real_distribution<float> distribution(-1.0f, 1.0f);
+
+		std::vector<Transform> transforms;
+		for(usize i = 0; i < InputCount; ++i)
+		{
+			float data[16];
+			for(usize j = 0; j < 16; ++j)
+			{
+				// a dominant diagonal keeps the matrix invertible
+				data[j] = distribution(random) + (j % 5 == 0 ? 4.0f : 0.0f);
+			}
+
+			transforms.emplace_back(data);
+		}
+
+		return transforms;
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Multiply a running matrix with the next input, as
+	///		   RenderTarget does when it pushes a transform.
+	/// 
+	////////////////////////////////////////////////////////////
+	void BM_TransformMultiply(benchmark::State& state)
+	{
+		const std::vector<Transform> transforms = MakeTransforms();
+		usize i = 0;
+
+		for(auto _ : state)
+		{
+			Transform result = transforms[i];
+			result.Multiply(transforms[(i + 1) % InputCount]);
+			benchmark::DoNotOptimize(result);
+			i = (i + 1) % InputCount;
+		}
+
+		state.SetItemsProcessed(state.iterations());
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Invert a matrix, as done to map the mouse into
+	///		   the coordinates of a transformed shape.
+	/// 
+	////////////////////////////////////////////////////////////
+	void BM_TransformInverse(benchmark::State& state)
+	{
+		const std::vector<Transform> transforms = MakeTransforms();
+		usize i = 0;
+
+		for(auto _ : state)
+		{
+			Transform result = transforms[i].Inverse();
+			benchmark::DoNotOptimize(result);
+			i = (i + 1) % InputCount;
+		}
+
+		state.SetItemsProcessed(state.iterations());
+	}
+
+	void BM_TransformInverseLegacy(benchmark::State& state)
+	{
+		const std::vector<Transform> transforms = MakeTransforms();
+		usize i = 0;
+
+		for(auto _ : state)
+		{
+			Transform result = Tests::LegacyInverse(transforms[i]);
+			benchmark::DoNotOptimize(result);
+			i = (i + 1) % InputCount;
+		}
+
+		state.SetItemsProcessed(state.iterations());
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Rebuild the matrix of a transformation that
+	///		   changed since the last frame.
+	/// 
+	////////////////////////////////////////////////////////////
+	void BM_TransformationUpdate(benchmark::State& state)
+	{
+		Transformation transformation;
+		transformation.SetPosition(100.0f, 50.0f);
+		transformation.SetScale(2.0f, 0.5f);
+
+		for(auto _ : state)
+		{
+			transformation.Rotate(Degrees(1.0f));
+			benchmark::DoNotOptimize(transformation.GetTransform());
+		}
+
+		state.SetItemsProcessed(state.iterations());
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Get the cached matrix of an unchanged
+	///		   transformation.
+	/// 
+	////////////////////////////////////////////////////////////
+	void BM_TransformationCached(benchmark::State& state)
+	{
+		Transformation transformation;
+		transformation.SetRotation(Degrees(30.0f));
+
+		for(auto _ : state)
+		{
+			benchmark::DoNotOptimize(transformation.GetTransform());
+		}
+
+		state.SetItemsProcessed(state.iterations());
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Evaluate an easing function over the whole
+	///		   range of an animation.
+	/// 
+	////////////////////////////////////////////////////////////
+	void BM_Ease(benchmark::State& state, f32 (*ease)(f32))
+	{
+		std::vector<f32> inputs(InputCount);
+		for(usize i = 0; i < InputCount; ++i)
+		{
+			inputs[i] = (f32)i / (f32)(InputCount - 1);
+		}
+
+		for(auto _ : state)
+		{
+			for(const f32 x : inputs)
+			{
+				benchmark::DoNotOptimize(ease(x));
+			}
+		}
+
+		state.SetItemsProcessed(state.iterations() * (i64)InputCount);
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Create random colors.
+	/// 
+	////////////////////////////////////////////////////////////
+	std::vector<Color> MakeColors()
+	{
+		std::mt19937 random(42);
+		std::uniform_int_distribution<int> distribution(0, 255);
+
+		std::vector<Color> colors;
+		for(usize i = 0; i < InputCount; ++i)
+		{
+			colors.emplace_back((u8)distribution(random), (u8)distribution(random), (u8)distribution(random), (u8)distribution(random));
+		}
+
+		return colors;
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Blend colors with the saturating operators.
+	/// 
+	////////////////////////////////////////////////////////////
+	void BM_ColorAdd(benchmark::State& state)
+	{
+		const std::vector<Color> colors = MakeColors();
+
+		for(auto _ : state)
+		{
+			for(usize i = 0; i < InputCount; ++i)
+			{
+				benchmark::DoNotOptimize(colors[i] + colors[InputCount - 1 - i]);
+			}
+		}
+
+		state.SetItemsProcessed(state.iterations() * (i64)InputCount);
+	}
+
+	void BM_ColorScale(benchmark::State& state)
+	{
+		const std::vector<Color> colors = MakeColors();
+
+		for(auto _ : state)
+		{
+			for(usize i = 0; i < InputCount; ++i)
+			{
+				benchmark::DoNotOptimize(colors[i] * 0.75f);
+			}
+		}
+
+		state.SetItemsProcessed(state.iterations() * (i64)InputCount);
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Normalize random vectors.
+	/// 
+	////////////////////////////////////////////////////////////
+	void BM_Value2Normalize(benchmark::State& state)
+	{
+		std::mt19937 random(42);
+		std::uniform_real_distribution<float> distribution(-100.0f, 100.0f);
+
+		std::vector<Float2> values;
+		for(usize i = 0; i < InputCount; ++i)
+		{
+			values.emplace_back(distribution(random), distribution(random));
+		}
+
+		for(auto _ : state)
+		{
+			for(const Float2& value : values)
+			{
+				benchmark::DoNotOptimize(value.Normalized());
+			}
+		}
+
+		state.SetItemsProcessed(state.iterations() * (i64)InputCount);
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Wrap angles into a full turn, as
+	///		   Transformation::SetRotation() does.
+	/// 
+	////////////////////////////////////////////////////////////
+	void BM_AngleModulo(benchmark::State& state)
+	{
+		std::mt19937 random(42);
+		std::uniform_real_distribution<float> distribution(-1080.0f, 1080.0f);
+
+		std::vector<Angle> angles;
+		for(usize i = 0; i < InputCount; ++i)
+		{
+			angles.push_back(Degrees(distribution(random)));
+		}
+
+		for(auto _ : state)
+		{
+			for(const Angle& angle : angles)
+			{
+				benchmark::DoNotOptimize(angle % Degrees(360.0f));
+			}
+		}
+
+		state.SetItemsProcessed(state.iterations() * (i64)InputCount);
+	}
+}
+
+BENCHMARK(BM_TransformMultiply);
+BENCHMARK(BM_TransformInverse);
+BENCHMARK(BM_TransformInverseLegacy);
+
+BENCHMARK(BM_TransformationUpdate);
+BENCHMARK(BM_TransformationCached);
+
+BENCHMARK_CAPTURE(BM_Ease, Linear, &Ease::Linear);
+BENCHMARK_CAPTURE(BM_Ease, InOutSine, &Ease::InOutSine);
+BENCHMARK_CAPTURE(BM_Ease, InOutCubic, &Ease::InOutCubic);
+BENCHMARK_CAPTURE(BM_Ease, InOutQuint, &Ease::InOutQuint);
+BENCHMARK_CAPTURE(BM_Ease, InOutCirc, &Ease::InOutCirc);
+BENCHMARK_CAPTURE(BM_Ease, InOutElastic, &Ease::InOutElastic);
+BENCHMARK_CAPTURE(BM_Ease, InOutExpo, &Ease::InOutExpo);
+BENCHMARK_CAPTURE(BM_Ease, InOutBack, &Ease::InOutBack);
+BENCHMARK_CAPTURE(BM_Ease, InOutBounce, &Ease::InOutBounce);
+
+BENCHMARK(BM_ColorAdd);
+BENCHMARK(BM_ColorScale);
+
+BENCHMARK(BM_Value2Normalize);
+
+BENCHMARK(BM_AngleModulo);
\ No newline at end of file
@@ -0,0 +1,239 @@
+﻿// 
+// PollEventSystemBenchmarks.cpp
+// Core
+// 
+// Created by Felix Busch on 19.10.2026.
+// Copyright © 2026 Felix Busch. All rights reserved.
+// 
+
+#include <Core/System/PollEventSystem.hpp>
+#include <Core/System/RingBuffer.hpp>
+#include <Core/Window/WindowEvent.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <queue>
+#include <string>
+
+using namespace Core;
+
+namespace
+{
+	////////////////////////////////////////////////////////////
+	/// \brief Define the deque based event system PollEventSystem
+	///		   was built on before, for comparison.
+	/// 
+	///	Pushing an rvalue copies and polling copies twice, first
+	///	into a local and then into the caller's buffer.
+	/// 
+	////////////////////////////////////////////////////////////
+	template<typename TEvent>
+	class QueueEventSystem
+	{
+	public:
+
+		void PushEvent(const TEvent& event)
+		{
+			events.push(event);
+		}
+
+		void PushEvent(TEvent&& event)
+		{
+			events.emplace(event);
+		}
+
+		bool PollEvents(TEvent& event)
+		{
+			if(!events.empty())
+			{
+				const TEvent currentEvent = events.front();
+				events.pop();
+
+				event = currentEvent;
+				return true;
+			}
+
+			return false;
+		}
+
+	private:
+
+		std::queue<TEvent> events;
+	};
+
+	////////////////////////////////////////////////////////////
+	/// \brief Define an event that owns heap memory, like a
+	///		   dropped file path.
+	/// 
+	////////////////////////////////////////////////////////////
+	struct PathEvent
+	{
+		std::string Path;
+	};
+
+	////////////////////////////////////////////////////////////
+	/// \brief Create a mouse move event.
+	/// 
+	////////////////////////////////////////////////////////////
+	WindowEvent MakeEvent(i32 x)
+	{
+		WindowEvent event(WindowEvent::MouseMoved);
+		event.MouseMove.MouseX = x;
+		event.MouseMove.MouseY = -x;
+		return event;
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Push a burst of window events and poll them all,
+	///		   the way Window queues and dispatches a frame's
+	///		   messages.
+	/// 
+	////////////////////////////////////////////////////////////
+	template<typename TSystem>
+	void BM_PushPoll(benchmark::State& state)
+	{
+		const usize burst = (usize)state.range(0);
+
+		TSystem system;
+		const WindowEvent event = MakeEvent(1);
+		WindowEvent polled;
+
+		for(auto _ : state)
+		{
+			for(usize i = 0; i < burst; ++i)
+			{
+				system.PushEvent(event);
+			}
+
+			while(system.PollEvents(polled))
+			{
+				benchmark::DoNotOptimize(polled);
+			}
+		}
+
+		state.SetItemsProcessed(state.iterations() * (i64)burst);
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Hand over events that own heap memory.
+	/// 
+	///	The events are pushed as rvalues, so a system that moves
+	///	them passes the string through without copying it.
+	/// 
+	////////////////////////////////////////////////////////////
+	template<typename TSystem>
+	void BM_PushPollOwning(benchmark::State& state)
+	{
+		const usize burst = (usize)state.range(0);
+
+		TSystem system;
+		PathEvent polled;
+
+		for(auto _ : state)
+		{
+			for(usize i = 0; i < burst; ++i)
+			{
+				system.PushEvent(std::move(polled));
+				polled.Path.assign(64, 'x');
+			}
+
+			while(system.PollEvents(polled))
+			{
+				benchmark::DoNotOptimize(polled.Path.data());
+			}
+		}
+
+		state.SetItemsProcessed(state.iterations() * (i64)burst);
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Push far more events than the capacity while
+	///		   dropping the oldest ones, as a stalled consumer does.
+	/// 
+	////////////////////////////////////////////////////////////
+	void BM_DropOldest(benchmark::State& state)
+	{
+		PollEventSystem<WindowEvent> system(PollEventSystem<WindowEvent>::DefaultCapacity, OverflowPolicy::DropOldest);
+		const WindowEvent event = MakeEvent(1);
+		WindowEvent polled;
+
+		for(auto _ : state)
+		{
+			for(usize i = 0; i < 4096; ++i)
+			{
+				system.PushEvent(event);
+			}
+
+			while(system.PollEvents(polled))
+			{
+				benchmark::DoNotOptimize(polled);
+			}
+		}
+
+		state.SetItemsProcessed(state.iterations() * 4096);
+		state.counters["dropped"] = benchmark::Counter((double)system.GetDroppedEventCount(), benchmark::Counter::kAvgIterations);
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Compare the containers alone, filled to a steady
+	///		   depth.
+	/// 
+	////////////////////////////////////////////////////////////
+	void BM_RingBuffer(benchmark::State& state)
+	{
+		const usize depth = (usize)state.range(0);
+
+		RingBuffer<WindowEvent> buffer(depth);
+		const WindowEvent event = MakeEvent(1);
+		WindowEvent popped;
+
+		for(usize i = 0; i + 1 < depth; ++i)
+		{
+			buffer.PushBack(event);
+		}
+
+		for(auto _ : state)
+		{
+			buffer.PushBack(event);
+			buffer.PopFront(popped);
+			benchmark::DoNotOptimize(popped);
+		}
+
+		state.SetItemsProcessed(state.iterations());
+	}
+
+	void BM_StdQueue(benchmark::State& state)
+	{
+		const usize depth = (usize)state.range(0);
+
+		std::queue<WindowEvent> queue;
+		const WindowEvent event = MakeEvent(1);
+		WindowEvent popped;
+
+		for(usize i = 0; i + 1 < depth; ++i)
+		{
+			queue.push(event);
+		}
+
+		for(auto _ : state)
+		{
+			queue.push(event);
+			popped = queue.front();
+			queue.pop();
+			benchmark::DoNotOptimize(popped);
+		}
+
+		state.SetItemsProcessed(state.iterations());
+	}
+}
+
+BENCHMARK_TEMPLATE(BM_PushPoll, PollEventSystem<WindowEvent>)->ArgName("events")->Arg(16)->Arg(256)->Arg(4096);
+BENCHMARK_TEMPLATE(BM_PushPoll, QueueEventSystem<WindowEvent>)->ArgName("events")->Arg(16)->Arg(256)->Arg(4096);
+
+BENCHMARK_TEMPLATE(BM_PushPollOwning, PollEventSystem<PathEvent>)->ArgName("events")->Arg(16)->Arg(256);
+BENCHMARK_TEMPLATE(BM_PushPollOwning, QueueEventSystem<PathEvent>)->ArgName("events")->Arg(16)->Arg(256);
+
+BENCHMARK(BM_DropOldest);
+
+BENCHMARK(BM_RingBuffer)->ArgName("depth")->Arg(16)->Arg(1024);
+BENCHMARK(BM_StdQueue)->ArgName("depth")->Arg(16)->Arg(1024);
\ No newline at end of file
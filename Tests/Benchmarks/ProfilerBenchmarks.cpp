@@ -0,0 +1,102 @@
+﻿// 
+// ProfilerBenchmarks.cpp
+// Core
+// 
+// Created by Felix Busch on 19.10.2026.
+// Copyright © 2026 Felix Busch. All rights reserved.
+// 
+
+#include <Core/System/Profiler.hpp>
+#include <Core/System/Types.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <filesystem>
+
+#if defined(_M_X64) || defined(_M_IX86)
+#include <intrin.h>
+#define CORE_BENCHMARK_TSC
+#elif defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define CORE_BENCHMARK_TSC
+#endif
+
+using namespace Core;
+
+namespace
+{
+	////////////////////////////////////////////////////////////
+	/// \brief Enter and leave an empty scope while the profiler
+	///		   is not running, the cost every marked scope pays in
+	///		   a build with CORE_ENABLE_PROFILER.
+	/// 
+	////////////////////////////////////////////////////////////
+	void BM_ProfileScopeIdle(benchmark::State& state)
+	{
+		for(auto _ : state)
+		{
+			CORE_PROFILE_SCOPE("Idle");
+			benchmark::ClobberMemory();
+		}
+
+		state.SetItemsProcessed(state.iterations());
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Enter and leave an empty scope while recording,
+	///		   which emits a begin and an end record.
+	/// 
+	///	The scopes come in far faster than the flusher drains
+	///	them, so the run is limited to as many scopes as the
+	///	queue of a thread holds. Otherwise the benchmark would
+	///	mostly measure dropping records. The dropped counter
+	///	shows the share that was dropped anyway.
+	/// 
+	////////////////////////////////////////////////////////////
+	void BM_ProfileScope(benchmark::State& state)
+	{
+		const std::filesystem::path filepath = std::filesystem::temp_directory_path() / "Core.ProfilerBenchmarks.json";
+		const u64 dropped = Profiler::GetDroppedRecordCount();
+		Profiler::Start(filepath);
+
+		for(auto _ : state)
+		{
+			CORE_PROFILE_SCOPE("Recorded");
+			benchmark::ClobberMemory();
+		}
+
+		const u64 droppedNow = Profiler::GetDroppedRecordCount();
+		Profiler::Stop();
+		std::filesystem::remove(filepath);
+
+		state.SetItemsProcessed(state.iterations());
+		state.counters["dropped"] = benchmark::Counter((double)(droppedNow - dropped) / (double)(2 * state.iterations()));
+	}
+
+#ifdef CORE_BENCHMARK_TSC
+	////////////////////////////////////////////////////////////
+	/// \brief Read the time stamp counter the profiler takes
+	///		   its timestamps from.
+	/// 
+	///	A recorded scope reads it twice, so twice this time is
+	///	the floor for BM_ProfileScope on the same machine.
+	/// 
+	////////////////////////////////////////////////////////////
+	void BM_TimestampCounter(benchmark::State& state)
+	{
+		for(auto _ : state)
+		{
+			benchmark::DoNotOptimize(__rdtsc());
+		}
+
+		state.SetItemsProcessed(state.iterations());
+	}
+#endif
+}
+
+BENCHMARK(BM_ProfileScopeIdle);
+BENCHMARK(BM_ProfileScope)->Iterations(30000)->Repetitions(10)->ReportAggregatesOnly(true);
+
+#ifdef CORE_BENCHMARK_TSC
+BENCHMARK(BM_TimestampCounter);
+#endif
\ No newline at end of file
@@ -0,0 +1,220 @@
+﻿// 
+// SpscQueueBenchmarks.cpp
+// Core
+// 
+// Created by Felix Busch on 19.10.2026.
+// Copyright © 2026 Felix Busch. All rights reserved.
+// 
+
+#include <Core/System/SpscQueue.hpp>
+#include <Core/System/Stopwatch.hpp>
+#include <Core/System/LatencyHistogram.hpp>
+#include <Core/Window/WindowEvent.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <mutex>
+#include <queue>
+#include <thread>
+
+using namespace Core;
+
+namespace
+{
+	////////////////////////////////////////////////////////////
+	/// The capacity Application uses for the render events
+	/// 
+	////////////////////////////////////////////////////////////
+	constexpr usize Capacity = 4096;
+
+	////////////////////////////////////////////////////////////
+	/// \brief Define the locked queue the events were handed
+	///		   over with before, bounded like SpscQueue.
+	/// 
+	////////////////////////////////////////////////////////////
+	class LockedQueue
+	{
+	public:
+
+		explicit LockedQueue(usize capacity): capacity(capacity) {}
+
+		bool TryPush(const WindowEvent& event)
+		{
+			std::lock_guard lock(mutex);
+			if(events.size() == capacity)
+			{
+				return false;
+			}
+
+			events.push(event);
+			return true;
+		}
+
+		bool TryPop(WindowEvent& event)
+		{
+			std::lock_guard lock(mutex);
+			if(events.empty())
+			{
+				return false;
+			}
+
+			event = events.front();
+			events.pop();
+			return true;
+		}
+
+	private:
+
+		std::mutex				mutex;
+		std::queue<WindowEvent>	events;
+		usize					capacity;
+	};
+
+	////////////////////////////////////////////////////////////
+	/// \brief Create a mouse move event, stamped now.
+	/// 
+	////////////////////////////////////////////////////////////
+	WindowEvent MakeEvent(i32 x)
+	{
+		WindowEvent event(WindowEvent::MouseMoved);
+		event.MouseMove.MouseX = x;
+		event.MouseMove.MouseY = -x;
+		return event;
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Push and pop a burst of events on one thread.
+	/// 
+	///	The cost of the queue itself without any contention, as
+	///	seen by a frame that drains the events of the last one.
+	/// 
+	////////////////////////////////////////////////////////////
+	template<typename TQueue>
+	void BM_Burst(benchmark::State& state)
+	{
+		const usize burst = (usize)state.range(0);
+
+		TQueue queue(Capacity);
+		const WindowEvent event = MakeEvent(1);
+		WindowEvent received;
+
+		for(auto _ : state)
+		{
+			for(usize i = 0; i < burst; ++i)
+			{
+				queue.TryPush(event);
+			}
+
+			while(queue.TryPop(received))
+			{
+				benchmark::DoNotOptimize(received);
+			}
+		}
+
+		state.SetItemsProcessed(state.iterations() * (i64)burst);
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Stream events from a producer thread to the
+	///		   benchmark thread as fast as possible.
+	/// 
+	////////////////////////////////////////////////////////////
+	template<typename TQueue>
+	void BM_Throughput(benchmark::State& state)
+	{
+		TQueue queue(Capacity);
+		std::atomic<bool> running = true;
+
+		std::thread producer([&]
+		{
+			const WindowEvent event = MakeEvent(1);
+			while(running.load(std::memory_order_relaxed))
+			{
+				if(!queue.TryPush(event))
+				{
+					std::this_thread::yield();
+				}
+			}
+		});
+
+		WindowEvent received;
+		for(auto _ : state)
+		{
+			while(!queue.TryPop(received))
+			{
+				std::this_thread::yield();
+			}
+
+			benchmark::DoNotOptimize(received);
+		}
+
+		running = false;
+		producer.join();
+
+		state.SetItemsProcessed(state.iterations());
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Measure the time from pushing a single event on
+	///		   the producer thread until it has been popped.
+	/// 
+	///	The producer only sends the next event once the previous
+	///	one has arrived, so the queue never fills up and the
+	///	latency is the one of a lone input event.
+	/// 
+	////////////////////////////////////////////////////////////
+	template<typename TQueue>
+	void BM_Latency(benchmark::State& state)
+	{
+		TQueue queue(Capacity);
+		std::atomic<u64> received = 0;
+		std::atomic<bool> running = true;
+
+		std::thread producer([&]
+		{
+			u64 sent = 0;
+			while(running.load(std::memory_order_relaxed))
+			{
+				if(received.load(std::memory_order_acquire) == sent)
+				{
+					queue.TryPush(MakeEvent((i32)sent));
+					++sent;
+				} else
+				{
+					std::this_thread::yield();
+				}
+			}
+		});
+
+		LatencyHistogram histogram;
+		WindowEvent event;
+
+		for(auto _ : state)
+		{
+			while(!queue.TryPop(event))
+			{
+				std::this_thread::yield();
+			}
+
+			histogram.Record(Stopwatch::GetTimestamp() - event.Timestamp);
+			received.fetch_add(1, std::memory_order_release);
+		}
+
+		running = false;
+		producer.join();
+
+		state.counters["p50_us"] = histogram.GetPercentile(50.0f).ToMicroseconds<double>();
+		state.counters["p99_us"] = histogram.GetPercentile(99.0f).ToMicroseconds<double>();
+		state.counters["max_us"] = histogram.GetMax().ToMicroseconds<double>();
+	}
+}
+
+BENCHMARK_TEMPLATE(BM_Burst, SpscQueue<WindowEvent>)->ArgName("events")->Arg(16)->Arg(256)->Arg(4096);
+BENCHMARK_TEMPLATE(BM_Burst, LockedQueue)->ArgName("events")->Arg(16)->Arg(256)->Arg(4096);
+
+BENCHMARK_TEMPLATE(BM_Throughput, SpscQueue<WindowEvent>)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_Throughput, LockedQueue)->UseRealTime();
+
+BENCHMARK_TEMPLATE(BM_Latency, SpscQueue<WindowEvent>)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_Latency, LockedQueue)->UseRealTime();
\ No newline at end of file
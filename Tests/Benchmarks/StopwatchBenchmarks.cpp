@@ -0,0 +1,68 @@
+﻿// 
+// StopwatchBenchmarks.cpp
+// Core
+// 
+// Created by Felix Busch on 19.10.2026.
+// Copyright © 2026 Felix Busch. All rights reserved.
+// 
+
+#include <Core/System/Stopwatch.hpp>
+
+#include <benchmark/benchmark.h>
+
+using namespace Core;
+
+namespace
+{
+	////////////////////////////////////////////////////////////
+	/// \brief Read the clock, as done for every event and
+	///		   profiler record.
+	/// 
+	////////////////////////////////////////////////////////////
+	void BM_GetTimestamp(benchmark::State& state)
+	{
+		for(auto _ : state)
+		{
+			benchmark::DoNotOptimize(Stopwatch::GetTimestamp());
+		}
+
+		state.SetItemsProcessed(state.iterations());
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Get the time since the stopwatch was started, as
+	///		   done for the frame time.
+	/// 
+	////////////////////////////////////////////////////////////
+	void BM_GetElapsedTime(benchmark::State& state)
+	{
+		const Stopwatch stopwatch = Stopwatch::StartNew();
+
+		for(auto _ : state)
+		{
+			benchmark::DoNotOptimize(stopwatch.GetElapsedTime());
+		}
+
+		state.SetItemsProcessed(state.iterations());
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Restart the stopwatch once per frame.
+	/// 
+	////////////////////////////////////////////////////////////
+	void BM_Restart(benchmark::State& state)
+	{
+		Stopwatch stopwatch = Stopwatch::StartNew();
+
+		for(auto _ : state)
+		{
+			benchmark::DoNotOptimize(stopwatch.Restart());
+		}
+
+		state.SetItemsProcessed(state.iterations());
+	}
+}
+
+BENCHMARK(BM_GetTimestamp);
+BENCHMARK(BM_GetElapsedTime);
+BENCHMARK(BM_Restart);
\ No newline at end of file
@@ -0,0 +1,41 @@
+﻿// 
+// Check.hpp
+// Core
+// 
+// Created by Felix Busch on 19.10.2026.
+// Copyright © 2026 Felix Busch. All rights reserved.
+// 
+
+#pragma once
+
+#include <iostream>
+
+////////////////////////////////////////////////////////////
+/// \brief Report a failed condition and keep going.
+/// 
+////////////////////////////////////////////////////////////
+#define CORE_CHECK(condition)																		\
+	do																								\
+	{																								\
+		if(!(condition))																			\
+		{																							\
+			std::cerr << __FILE__ << "(" << __LINE__ << "): check failed: " #condition << std::endl;	\
+			++::Core::Tests::Failures();															\
+		}																							\
+	} while(false)
+
+namespace Core::Tests
+{
+	////////////////////////////////////////////////////////////
+	/// \brief Get the number of failed checks so far.
+	/// 
+	///	Every test executable returns this from main() so ctest
+	///	reports it as failed.
+	/// 
+	////////////////////////////////////////////////////////////
+	inline int& Failures()
+	{
+		static int failures = 0;
+		return failures;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,242 @@
+﻿// 
+// JobsStress.cpp
+// Core
+// 
+// Created by Felix Busch on 19.10.2026.
+// Copyright © 2026 Felix Busch. All rights reserved.
+// 
+
+#include <Core/System/Jobs.hpp>
+
+#include "../Check.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace Core;
+
+namespace
+{
+	////////////////////////////////////////////////////////////
+	/// The number of worker threads, more than the CI machines
+	/// have cores so the workers get preempted mid-job
+	/// 
+	////////////////////////////////////////////////////////////
+	constexpr u32 WorkerCount = 4;
+
+	////////////////////////////////////////////////////////////
+	/// The number of rounds per test
+	/// 
+	////////////////////////////////////////////////////////////
+	constexpr u32 RoundCount = 200;
+
+	////////////////////////////////////////////////////////////
+	/// \brief Submit all jobs from a single job, so they land
+	///		   in one queue and the other workers have to steal.
+	/// 
+	///	Every job must run exactly once.
+	/// 
+	////////////////////////////////////////////////////////////
+	void StealsFromBusyWorkers()
+	{
+		constexpr u32 JobCount = 64;
+
+		Jobs::Start(WorkerCount);
+
+		for(u32 round = 0; round < RoundCount; ++round)
+		{
+			std::unique_ptr<std::atomic<u32>[]> runs(new std::atomic<u32>[JobCount]{});
+			Jobs::Counter counter;
+
+			Jobs::Submit([&]
+			{
+				for(u32 i = 0; i < JobCount; ++i)
+				{
+					Jobs::Submit([&runs, i]
+					{
+						++runs[i];
+						std::this_thread::yield();
+					}, &counter);
+				}
+			}, &counter);
+
+			Jobs::Wait(counter);
+
+			for(u32 i = 0; i < JobCount; ++i)
+			{
+				CORE_CHECK(runs[i] == 1);
+			}
+		}
+
+		u64 jobs = 0;
+		u64 steals = 0;
+		for(u32 i = 0; i < Jobs::GetWorkerCount(); ++i)
+		{
+			const Jobs::WorkerStats stats = Jobs::GetWorkerStats(i);
+			jobs += stats.JobCount;
+			steals += stats.StealCount;
+		}
+
+		CORE_CHECK(jobs <= RoundCount * (JobCount + 1));
+		CORE_CHECK(steals > 0);
+
+		Jobs::Stop();
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Chain stages of jobs through counters.
+	/// 
+	///	A job that depends on a counter must only start once
+	///	every job of that counter has finished, including jobs
+	///	that finished before the dependent one was submitted.
+	/// 
+	////////////////////////////////////////////////////////////
+	void RunsDependenciesInOrder()
+	{
+		constexpr u32 StageCount = 4;
+		constexpr u32 JobsPerStage = 16;
+
+		Jobs::Start(WorkerCount);
+
+		for(u32 round = 0; round < RoundCount; ++round)
+		{
+			Jobs::Counter stages[StageCount];
+			std::atomic<u32> finished[StageCount] = {};
+
+			for(u32 stage = 0; stage < StageCount; ++stage)
+			{
+				Jobs::Counter* dependency = stage > 0 ? &stages[stage - 1] : nullptr;
+
+				for(u32 i = 0; i < JobsPerStage; ++i)
+				{
+					Jobs::Submit([&finished, stage]
+					{
+						CORE_CHECK(stage == 0 || finished[stage - 1] == JobsPerStage);
+						++finished[stage];
+					}, &stages[stage], dependency);
+				}
+
+				// let the stage finish now and then before the next one is submitted
+				if(round % 2 == 0)
+				{
+					Jobs::Wait(stages[stage]);
+				}
+			}
+
+			Jobs::Wait(stages[StageCount - 1]);
+
+			// the last stage only finishes after all stages before it
+			for(u32 stage = 0; stage < StageCount; ++stage)
+			{
+				CORE_CHECK(stages[stage].IsDone());
+				CORE_CHECK(finished[stage] == JobsPerStage);
+			}
+		}
+
+		Jobs::Stop();
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Spawn a tree of jobs without counters and wait
+	///		   for all of them with WaitIdle().
+	/// 
+	////////////////////////////////////////////////////////////
+	void WaitIdleWaitsForNestedJobs()
+	{
+		constexpr u32 Depth = 6;
+		constexpr u32 NodeCount = (1u << (Depth + 1)) - 1;
+
+		Jobs::Start(WorkerCount);
+
+		for(u32 round = 0; round < RoundCount; ++round)
+		{
+			std::atomic<u32> nodes = 0;
+
+			struct Node
+			{
+				static void Spawn(std::atomic<u32>& nodes, u32 depth)
+				{
+					CORE_CHECK(Jobs::IsInJob());
+					++nodes;
+
+					if(depth < Depth)
+					{
+						Jobs::Submit([&nodes, depth] { Spawn(nodes, depth + 1); });
+						Jobs::Submit([&nodes, depth] { Spawn(nodes, depth + 1); });
+					}
+				}
+			};
+
+			Jobs::Submit([&nodes] { Node::Spawn(nodes, 0); });
+			Jobs::WaitIdle();
+
+			CORE_CHECK(nodes == NodeCount);
+			CORE_CHECK(!Jobs::IsInJob());
+		}
+
+		Jobs::Stop();
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Restart the pool with different worker counts
+	///		   while another thread keeps submitting jobs, the way
+	///		   SetJobWorkerCount() does while a tiled texture
+	///		   streams.
+	/// 
+	///	Jobs submitted while the pool restarts run on the
+	///	submitting thread, none of them may get lost.
+	/// 
+	////////////////////////////////////////////////////////////
+	void RestartsWhileSubmitting()
+	{
+		std::atomic<bool> done = false;
+		std::atomic<u64> submitted = 0;
+		std::atomic<u64> ran = 0;
+
+		Jobs::Start(WorkerCount);
+
+		std::thread producer([&]
+		{
+			while(!done)
+			{
+				Jobs::Counter counter;
+				for(u32 i = 0; i < 8; ++i)
+				{
+					Jobs::Submit([&ran] { ++ran; }, &counter);
+					++submitted;
+				}
+
+				Jobs::Wait(counter);
+			}
+		});
+
+		for(u32 round = 0; round < RoundCount; ++round)
+		{
+			Jobs::Stop();
+			CORE_CHECK(!Jobs::IsRunning());
+
+			Jobs::Start(1 + round % WorkerCount);
+			CORE_CHECK(Jobs::GetWorkerCount() == 1 + round % WorkerCount);
+
+			std::this_thread::sleep_for(std::chrono::microseconds(100));
+		}
+
+		done = true;
+		producer.join();
+		Jobs::Stop();
+
+		CORE_CHECK(ran == submitted);
+	}
+}
+
+int main()
+{
+	StealsFromBusyWorkers();
+	RunsDependenciesInOrder();
+	WaitIdleWaitsForNestedJobs();
+	RestartsWhileSubmitting();
+	return Core::Tests::Failures();
+}
\ No newline at end of file
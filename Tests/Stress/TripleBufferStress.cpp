@@ -0,0 +1,184 @@
+﻿// 
+// TripleBufferStress.cpp
+// Core
+// 
+// Created by Felix Busch on 19.10.2026.
+// Copyright © 2026 Felix Busch. All rights reserved.
+// 
+
+#include <Core/System/TripleBuffer.hpp>
+#include <Core/Application/Globals.hpp>
+
+#include "../Check.hpp"
+
+#include <atomic>
+#include <thread>
+
+using namespace Core;
+
+namespace
+{
+	////////////////////////////////////////////////////////////
+	/// The number of values published per test
+	/// 
+	////////////////////////////////////////////////////////////
+	constexpr i32 PublishCount = 200000;
+
+	////////////////////////////////////////////////////////////
+	/// \brief Define a value that is torn if its fields don't
+	///		   belong to the same publication.
+	/// 
+	////////////////////////////////////////////////////////////
+	struct Sample
+	{
+		i32 Sequence = 0;
+		i32 Fields[15] = {};
+
+		bool IsComplete() const
+		{
+			for(i32 i = 0; i < 15; ++i)
+			{
+				if(Fields[i] != Sequence * (i + 1))
+				{
+					return false;
+				}
+			}
+
+			return true;
+		}
+	};
+
+	////////////////////////////////////////////////////////////
+	/// \brief Publish an increasing sequence while the consumer
+	///		   keeps taking over the latest value.
+	/// 
+	///	Every value seen must be complete, newer than the one
+	///	before and stay unchanged until the next Update().
+	/// 
+	////////////////////////////////////////////////////////////
+	void PublishesCompleteValues()
+	{
+		TripleBuffer<Sample> buffer;
+		std::atomic<bool> done = false;
+
+		std::thread producer([&]
+		{
+			Sample sample;
+			for(i32 sequence = 1; sequence <= PublishCount; ++sequence)
+			{
+				sample.Sequence = sequence;
+				for(i32 i = 0; i < 15; ++i)
+				{
+					sample.Fields[i] = sequence * (i + 1);
+				}
+
+				buffer.Publish(sample);
+			}
+
+			done = true;
+		});
+
+		i32 last = 0;
+		u32 updates = 0;
+		while(true)
+		{
+			// read the flag first, so the final value is seen by the last Update()
+			const bool finished = done;
+
+			if(buffer.Update())
+			{
+				const Sample& sample = buffer.Get();
+				CORE_CHECK(sample.IsComplete());
+				CORE_CHECK(sample.Sequence > last);
+				last = sample.Sequence;
+				++updates;
+
+				std::this_thread::yield();
+				CORE_CHECK(buffer.Get().Sequence == last);
+			}
+
+			if(finished)
+			{
+				break;
+			}
+		}
+
+		producer.join();
+
+		CORE_CHECK(!buffer.Update());
+		CORE_CHECK(last == PublishCount);
+		CORE_CHECK(updates > 0);
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Feed the globals from a main thread while a
+	///		   rendering thread latches them every frame.
+	/// 
+	///	Width and Height as well as MouseX and MouseY are
+	///	published together, so a frame must never see one of a
+	///	pair without the other.
+	/// 
+	////////////////////////////////////////////////////////////
+	void GlobalsDontTear()
+	{
+		GlobalUpdatingService globals;
+		std::atomic<bool> done = false;
+
+		std::thread main([&]
+		{
+			for(i32 i = 1; i <= PublishCount; ++i)
+			{
+				WindowEvent resize(WindowEvent::Resized);
+				resize.Size = { (u32)i, (u32)i * 2 };
+				globals.OnEvent(resize);
+
+				WindowEvent move(WindowEvent::MouseMoved);
+				move.MouseMove = { i, -i };
+				globals.OnEvent(move);
+			}
+
+			done = true;
+		});
+
+		i32 lastWidth = 0;
+		i32 lastMouseX = 0;
+		while(true)
+		{
+			const bool finished = done;
+
+			GlobalUpdatingService::Latch();
+			CORE_CHECK(Height == Width * 2);
+			CORE_CHECK(MouseY == -MouseX);
+			CORE_CHECK(Width >= lastWidth);
+			CORE_CHECK(MouseX >= lastMouseX);
+			CORE_CHECK(PMouseX == lastMouseX);
+
+			// the values belong to the frame until the next Latch()
+			const i32 width = Width;
+			const i32 mouseX = MouseX;
+			std::this_thread::yield();
+			CORE_CHECK(Width == width);
+			CORE_CHECK(MouseX == mouseX);
+
+			lastWidth = Width;
+			lastMouseX = MouseX;
+
+			if(finished)
+			{
+				break;
+			}
+		}
+
+		main.join();
+
+		CORE_CHECK(Width == PublishCount);
+		CORE_CHECK(MouseX == PublishCount);
+	}
+}
+
+int main()
+{
+	PublishesCompleteValues();
+	GlobalsDontTear();
+	return Core::Tests::Failures();
+}
\ No newline at end of file
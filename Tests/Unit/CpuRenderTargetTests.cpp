@@ -0,0 +1,128 @@
+﻿// 
+// CpuRenderTargetTests.cpp
+// Core
+// 
+// Created by Felix Busch on 19.10.2026.
+// Copyright © 2026 Felix Busch. All rights reserved.
+// 
+
+#include <Core/Graphics/CpuRenderTarget.hpp>
+
+#include "../Check.hpp"
+
+using namespace Core;
+
+namespace
+{
+	////////////////////////////////////////////////////////////
+	/// \brief Count the pixels that have a given value.
+	/// 
+	////////////////////////////////////////////////////////////
+	u32 CountPixels(const PixelBuffer& pixels, u32 pixel)
+	{
+		u32 count = 0;
+		for(u32 y = 0; y < pixels.GetHeight(); ++y)
+		{
+			for(u32 x = 0; x < pixels.GetWidth(); ++x)
+			{
+				count += pixels.GetPixel(x, y) == pixel;
+			}
+		}
+
+		return count;
+	}
+
+	////////////////////////////////////////////////////////////
+	void FillsRectanglesExactly()
+	{
+		CpuRenderTarget target;
+		target.Resize(32, 32);
+		target.Background(Color(0, 0, 0));
+		target.Fill(Color(255, 0, 0));
+		target.Rect(4.0f, 8.0f, 10.0f, 6.0f);
+
+		const PixelBuffer& pixels = target.GetPixelBuffer();
+		const u32 red = PixelBuffer::Pack(Color(255, 0, 0));
+
+		CORE_CHECK(CountPixels(pixels, red) == 60);
+		CORE_CHECK(pixels.GetPixel(4, 8) == red);
+		CORE_CHECK(pixels.GetPixel(13, 13) == red);
+		CORE_CHECK(pixels.GetPixel(14, 13) != red);
+		CORE_CHECK(pixels.GetPixel(13, 14) != red);
+	}
+
+	////////////////////////////////////////////////////////////
+	void AppliesTheTransformation()
+	{
+		CpuRenderTarget target;
+		target.Resize(32, 32);
+		target.Background(Color(0, 0, 0));
+		target.Fill(Color(255, 255, 255));
+		target.Translate(16.0f, 16.0f);
+		target.Scale(2.0f, 2.0f);
+		target.RectMode(Center);
+		target.Rect(0.0f, 0.0f, 4.0f, 4.0f);
+
+		const PixelBuffer& pixels = target.GetPixelBuffer();
+		const u32 white = PixelBuffer::Pack(Color(255, 255, 255));
+
+		CORE_CHECK(CountPixels(pixels, white) == 64);
+		CORE_CHECK(pixels.GetPixel(12, 12) == white);
+		CORE_CHECK(pixels.GetPixel(19, 19) == white);
+		CORE_CHECK(pixels.GetPixel(20, 20) != white);
+	}
+
+	////////////////////////////////////////////////////////////
+	void BlendsTranslucentFills()
+	{
+		CpuRenderTarget target;
+		target.Resize(8, 8);
+		target.Background(Color(0, 0, 255));
+		target.Fill(Color(255, 0, 0, 128));
+		target.Rect(0.0f, 0.0f, 8.0f, 8.0f);
+
+		const Color color = PixelBuffer::Unpack(target.GetPixelBuffer().GetPixel(3, 3));
+		CORE_CHECK(color.A == 255);
+		CORE_CHECK(color.R == 128);
+		CORE_CHECK(color.B == 127);
+	}
+
+	////////////////////////////////////////////////////////////
+	void CountsLikeRenderTarget()
+	{
+		CpuRenderTarget target;
+		target.Resize(16, 16);
+		target.Background(Color(0, 0, 0));
+
+		// neither fill nor stroke
+		target.Rect(0.0f, 0.0f, 4.0f, 4.0f);
+		target.Line(0.0f, 0.0f, 4.0f, 4.0f);
+
+		target.Fill(Color(255, 255, 255));
+		target.Stroke(Color(255, 0, 0));
+		target.Rect(0.0f, 0.0f, 4.0f, 4.0f);
+		target.Ellipse(8.0f, 8.0f, 4.0f, 4.0f);
+		target.Line(0.0f, 0.0f, 4.0f, 4.0f);
+
+		RenderStats stats = target.GetRenderStats();
+		CORE_CHECK(stats.Clears == 1);
+		CORE_CHECK(stats.CulledPrimitives == 2);
+		CORE_CHECK(stats.Rectangles == 2);
+		CORE_CHECK(stats.Ellipses == 2);
+		CORE_CHECK(stats.Lines == 1);
+		CORE_CHECK(stats.TransformChanges == 1);
+
+		target.ResetRenderStats();
+		CORE_CHECK(target.GetPreviousRenderStats().Rectangles == 2);
+		CORE_CHECK(target.GetRenderStats().GetDrawCallCount() == 0);
+	}
+}
+
+int main()
+{
+	FillsRectanglesExactly();
+	AppliesTheTransformation();
+	BlendsTranslucentFills();
+	CountsLikeRenderTarget();
+	return Core::Tests::Failures();
+}
\ No newline at end of file
@@ -0,0 +1,129 @@
+﻿// 
+// FramePacerTests.cpp
+// Core
+// 
+// Created by Felix Busch on 19.10.2026.
+// Copyright © 2026 Felix Busch. All rights reserved.
+// 
+
+#include <Core/System/FramePacer.hpp>
+#include <Core/System/Stopwatch.hpp>
+
+#include "../Check.hpp"
+
+#ifndef _WIN32
+#include <signal.h>
+#include <sys/time.h>
+#endif
+
+#include <atomic>
+#include <iostream>
+
+using namespace Core;
+
+namespace
+{
+	////////////////////////////////////////////////////////////
+	/// The number of frames per test
+	/// 
+	////////////////////////////////////////////////////////////
+	constexpr u32 FrameCount = 300;
+
+	////////////////////////////////////////////////////////////
+	/// The time between two frames, short enough to keep the
+	/// test fast and long enough that the pacer has to sleep
+	/// 
+	////////////////////////////////////////////////////////////
+	constexpr Time Interval = Milliseconds(2);
+
+	////////////////////////////////////////////////////////////
+	/// \brief Pace a number of frames and check that the
+	///		   deadlines are absolute.
+	/// 
+	///	Since every deadline is one interval after the previous
+	///	one instead of after the previous wake-up, being late
+	///	must not add up over the frames.
+	/// 
+	////////////////////////////////////////////////////////////
+	void PaceFrames(const char* name)
+	{
+		FramePacer pacer;
+		pacer.SetInterval(Interval);
+		pacer.Reset();
+
+		const Stopwatch stopwatch = Stopwatch::StartNew();
+		for(u32 frame = 0; frame < FrameCount; ++frame)
+		{
+			pacer.Wait();
+		}
+
+		const Time elapsed = stopwatch.GetElapsedTime();
+		const Time expected = Nanoseconds(Interval.ToNanoseconds<i64>() * FrameCount);
+		const LatencyHistogram& error = pacer.GetPacingError();
+
+		std::cout << name << ": " << elapsed.ToMicroseconds<i64>() << " us for " << FrameCount << " frames, pacing error p50 "
+			<< error.GetPercentile(50.0f).ToMicroseconds<i64>() << " us, p99 " << error.GetPercentile(99.0f).ToMicroseconds<i64>()
+			<< " us, max " << error.GetMax().ToMicroseconds<i64>() << " us, " << pacer.GetMissedDeadlineCount() << " missed" << std::endl;
+
+		// Wait() never returns before a deadline ...
+		CORE_CHECK(elapsed >= expected);
+
+		// ... and the error of a late frame doesn't carry over to the next one
+		CORE_CHECK(elapsed < expected + Milliseconds(30));
+
+		CORE_CHECK(error.GetCount() + pacer.GetMissedDeadlineCount() == FrameCount);
+		CORE_CHECK(pacer.GetMissedDeadlineCount() <= FrameCount / 20);
+		CORE_CHECK(error.GetPercentile(50.0f) < Microseconds(500));
+	}
+
+	////////////////////////////////////////////////////////////
+	void PacesAbsoluteDeadlines()
+	{
+		PaceFrames("PacesAbsoluteDeadlines");
+	}
+
+#ifndef _WIN32
+	////////////////////////////////////////////////////////////
+	/// \brief Pace frames while a signal interrupts the sleep
+	///		   every few hundred microseconds.
+	/// 
+	///	clock_nanosleep() returns EINTR on every signal and has
+	///	to be resumed with the same absolute deadline.
+	/// 
+	////////////////////////////////////////////////////////////
+	void ResumesAfterSignals()
+	{
+		static std::atomic<u32> signals = 0;
+
+		struct sigaction action = {};
+		action.sa_handler = [](int) { ++signals; };
+		sigemptyset(&action.sa_mask);
+
+		// no SA_RESTART, so the sleep is interrupted
+		struct sigaction previous = {};
+		sigaction(SIGALRM, &action, &previous);
+
+		itimerval timer = {};
+		timer.it_interval.tv_usec = 300;
+		timer.it_value.tv_usec = 300;
+		setitimer(ITIMER_REAL, &timer, nullptr);
+
+		PaceFrames("ResumesAfterSignals");
+
+		timer = {};
+		setitimer(ITIMER_REAL, &timer, nullptr);
+		sigaction(SIGALRM, &previous, nullptr);
+
+		CORE_CHECK(signals > 0);
+	}
+#endif
+}
+
+int main()
+{
+	PacesAbsoluteDeadlines();
+#ifndef _WIN32
+	ResumesAfterSignals();
+#endif
+	return Core::Tests::Failures();
+}
\ No newline at end of file
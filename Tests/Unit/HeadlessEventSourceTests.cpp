@@ -0,0 +1,121 @@
+﻿// 
+// HeadlessEventSourceTests.cpp
+// Core
+// 
+// Created by Felix Busch on 19.10.2026.
+// Copyright © 2026 Felix Busch. All rights reserved.
+// 
+
+#include <Core/System/HeadlessEventSource.hpp>
+#include <Core/System/Stopwatch.hpp>
+#include <Core/Window/WindowEvent.hpp>
+
+#include "../Check.hpp"
+
+#include <thread>
+
+using namespace Core;
+
+namespace
+{
+	////////////////////////////////////////////////////////////
+	/// A timeout long enough that a test only passes if the wait
+	/// ended early
+	/// 
+	////////////////////////////////////////////////////////////
+	constexpr Time LongTimeout = Seconds(10.0);
+
+	////////////////////////////////////////////////////////////
+	/// \brief Define a listener that remembers the last event.
+	/// 
+	////////////////////////////////////////////////////////////
+	class Recorder : public IEventListener<WindowEvent>
+	{
+	public:
+
+		virtual void OnEvent(const WindowEvent& event) override
+		{
+			Last = event;
+			++Count;
+		}
+
+		WindowEvent	Last;
+		u32			Count = 0;
+	};
+
+	////////////////////////////////////////////////////////////
+	void WakeEndsTheWait()
+	{
+		HeadlessEventSource<WindowEvent> source;
+
+		std::thread waker([&]
+		{
+			std::this_thread::sleep_for(std::chrono::milliseconds(50));
+			source.Wake();
+		});
+
+		const Stopwatch stopwatch = Stopwatch::StartNew();
+		CORE_CHECK(!source.WaitEvents(LongTimeout));
+		CORE_CHECK(stopwatch.GetElapsedTime() < Seconds(5.0));
+
+		waker.join();
+	}
+
+	////////////////////////////////////////////////////////////
+	void RemembersWakeWithoutWaiter()
+	{
+		HeadlessEventSource<WindowEvent> source;
+		source.Wake();
+
+		const Stopwatch stopwatch = Stopwatch::StartNew();
+		CORE_CHECK(!source.WaitEvents(LongTimeout));
+		CORE_CHECK(stopwatch.GetElapsedTime() < Seconds(5.0));
+	}
+
+	////////////////////////////////////////////////////////////
+	void PostEndsTheWait()
+	{
+		HeadlessEventSource<WindowEvent> source;
+		Recorder recorder;
+		source.AddEventListener(recorder);
+
+		std::thread poster([&]
+		{
+			std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+			WindowEvent event(WindowEvent::MouseMoved);
+			event.MouseMove = { 3, 4 };
+			source.Post(event);
+		});
+
+		const Stopwatch stopwatch = Stopwatch::StartNew();
+		CORE_CHECK(source.WaitEvents(LongTimeout));
+		CORE_CHECK(stopwatch.GetElapsedTime() < Seconds(5.0));
+
+		poster.join();
+
+		source.DispatchEvents();
+		CORE_CHECK(recorder.Count == 1);
+		CORE_CHECK(recorder.Last.Type == WindowEvent::MouseMoved);
+		CORE_CHECK(recorder.Last.MouseMove.MouseX == 3);
+	}
+
+	////////////////////////////////////////////////////////////
+	void TimeoutExpiresWithoutEvents()
+	{
+		HeadlessEventSource<WindowEvent> source;
+
+		const Stopwatch stopwatch = Stopwatch::StartNew();
+		CORE_CHECK(!source.WaitEvents(Milliseconds(50)));
+		CORE_CHECK(stopwatch.GetElapsedTime() >= Milliseconds(50));
+	}
+}
+
+int main()
+{
+	WakeEndsTheWait();
+	RemembersWakeWithoutWaiter();
+	PostEndsTheWait();
+	TimeoutExpiresWithoutEvents();
+	return Core::Tests::Failures();
+}
\ No newline at end of file
@@ -0,0 +1,294 @@
+﻿// 
+// ImageFilterTests.cpp
+// Core
+// 
+// Created by Felix Busch on 19.10.2026.
+// Copyright © 2026 Felix Busch. All rights reserved.
+// 
+
+#include <Core/Graphics/ImageFilter.hpp>
+#include <Core/Graphics/PixelBuffer.hpp>
+
+#include "../Check.hpp"
+
+#include <cmath>
+#include <cstdlib>
+
+using namespace Core;
+
+namespace
+{
+	////////////////////////////////////////////////////////////
+	/// A 3x3 edge detection kernel, its weights sum to zero
+	/// 
+	////////////////////////////////////////////////////////////
+	constexpr float EdgeKernel[9] =
+	{
+		-1.0f, -1.0f, -1.0f,
+		-1.0f,  8.0f, -1.0f,
+		-1.0f, -1.0f, -1.0f
+	};
+
+	////////////////////////////////////////////////////////////
+	/// A 3x3 kernel that keeps every pixel as it is
+	/// 
+	////////////////////////////////////////////////////////////
+	constexpr float IdentityKernel[9] =
+	{
+		0.0f, 0.0f, 0.0f,
+		0.0f, 1.0f, 0.0f,
+		0.0f, 0.0f, 0.0f
+	};
+
+	////////////////////////////////////////////////////////////
+	/// All resampling filters
+	/// 
+	////////////////////////////////////////////////////////////
+	constexpr ImageFilter::ResampleFilter ResampleFilters[] =
+	{
+		ImageFilter::Box,
+		ImageFilter::Bilinear,
+		ImageFilter::Bicubic,
+		ImageFilter::Lanczos3
+	};
+
+	////////////////////////////////////////////////////////////
+	/// \brief Fill a buffer with a smooth, opaque test image.
+	/// 
+	////////////////////////////////////////////////////////////
+	void Gradient(PixelBuffer& pixels, u32 width, u32 height)
+	{
+		pixels.Resize(width, height);
+
+		for(u32 y = 0; y < height; ++y)
+		{
+			for(u32 x = 0; x < width; ++x)
+			{
+				const float u = (float)x / (float)width;
+				const float v = (float)y / (float)height;
+				const u8 red = (u8)std::lround(127.5f + 127.5f * std::sin(u * 6.2831853f));
+				const u8 green = (u8)std::lround(255.0f * v);
+				const u8 blue = (u8)std::lround(127.5f + 127.5f * std::cos((u + v) * 3.1415926f));
+				pixels.SetPixel(x, y, Color(red, green, blue));
+			}
+		}
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Get the peak signal-to-noise ratio of two buffers
+	///		   of the same size in decibel.
+	/// 
+	////////////////////////////////////////////////////////////
+	double PeakSignalToNoise(const PixelBuffer& a, const PixelBuffer& b)
+	{
+		double error = 0.0;
+		for(u32 y = 0; y < a.GetHeight(); ++y)
+		{
+			for(u32 x = 0; x < a.GetWidth(); ++x)
+			{
+				const u32 p = a.GetPixel(x, y);
+				const u32 q = b.GetPixel(x, y);
+				for(u32 shift = 0; shift < 32; shift += 8)
+				{
+					const double difference = (double)((p >> shift) & 0xFF) - (double)((q >> shift) & 0xFF);
+					error += difference * difference;
+				}
+			}
+		}
+
+		const double mean = error / ((double)a.GetWidth() * a.GetHeight() * 4.0);
+		return mean == 0.0 ? INFINITY : 10.0 * std::log10(255.0 * 255.0 / mean);
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief A zero-sum kernel must not make an opaque image
+	///		   transparent.
+	/// 
+	////////////////////////////////////////////////////////////
+	void ConvolveKeepsOpaqueAlpha()
+	{
+		PixelBuffer pixels;
+		pixels.Resize(16, 16);
+
+		for(u32 y = 0; y < 16; ++y)
+		{
+			for(u32 x = 0; x < 16; ++x)
+			{
+				pixels.SetPixel(x, y, x < 8 ? Color(20, 40, 60) : Color(200, 180, 160));
+			}
+		}
+
+		ImageFilter::Convolve(pixels, EdgeKernel, 3);
+
+		for(u32 y = 0; y < 16; ++y)
+		{
+			for(u32 x = 0; x < 16; ++x)
+			{
+				CORE_CHECK(pixels.GetPixel(x, y) >> 24 == 255);
+			}
+		}
+
+		// flat areas turn black, the edge stays
+		CORE_CHECK(pixels.GetPixel(2, 8) == 0xFF000000);
+		CORE_CHECK(pixels.GetPixel(8, 8) != 0xFF000000);
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief The alpha of the neighbours must not bleed into
+	///		   the color of a pixel.
+	/// 
+	////////////////////////////////////////////////////////////
+	void ConvolveKeepsTranslucentPixels()
+	{
+		PixelBuffer pixels;
+		pixels.Resize(8, 8);
+
+		for(u32 y = 0; y < 8; ++y)
+		{
+			for(u32 x = 0; x < 8; ++x)
+			{
+				pixels.SetPixel(x, y, Color(100, 150, 200, (u8)(x * 32)));
+			}
+		}
+
+		const PixelBuffer source = pixels;
+		ImageFilter::Convolve(pixels, IdentityKernel, 3);
+
+		for(u32 y = 0; y < 8; ++y)
+		{
+			for(u32 x = 0; x < 8; ++x)
+			{
+				CORE_CHECK(pixels.GetPixel(x, y) == source.GetPixel(x, y));
+			}
+		}
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief A flat image must stay flat in both directions,
+	///		   the weights of every filter sum to one.
+	/// 
+	////////////////////////////////////////////////////////////
+	void ResizeKeepsFlatColor()
+	{
+		PixelBuffer source;
+		source.Resize(37, 23);
+
+		const u32 color = PixelBuffer::Pack(Color(90, 160, 220, 200));
+		for(u32 y = 0; y < source.GetHeight(); ++y)
+		{
+			for(u32 x = 0; x < source.GetWidth(); ++x)
+			{
+				source.SetPixel(x, y, color);
+			}
+		}
+
+		for(const ImageFilter::ResampleFilter filter : ResampleFilters)
+		{
+			for(const u32 size : { 5u, 16u, 64u, 101u })
+			{
+				PixelBuffer destination;
+				ImageFilter::Resize(source, destination, size, size / 2 + 1, filter);
+
+				for(u32 y = 0; y < destination.GetHeight(); ++y)
+				{
+					for(u32 x = 0; x < destination.GetWidth(); ++x)
+					{
+						CORE_CHECK(destination.GetPixel(x, y) == color);
+					}
+				}
+			}
+		}
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Resizing to the same size must not change the
+	///		   pixels.
+	/// 
+	////////////////////////////////////////////////////////////
+	void ResizeToSameSizeIsIdentity()
+	{
+		PixelBuffer source;
+		Gradient(source, 48, 32);
+
+		for(const ImageFilter::ResampleFilter filter : ResampleFilters)
+		{
+			PixelBuffer destination;
+			ImageFilter::Resize(source, destination, 48, 32, filter);
+			CORE_CHECK(PeakSignalToNoise(source, destination) == INFINITY);
+		}
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Scaling a smooth image down and back up must stay
+	///		   close to the original, the better filters closer.
+	/// 
+	////////////////////////////////////////////////////////////
+	void ResizeRoundTripQuality()
+	{
+		PixelBuffer source;
+		Gradient(source, 256, 256);
+
+		double quality[4] = {};
+		for(u32 i = 0; i < 4; ++i)
+		{
+			PixelBuffer small, restored;
+			ImageFilter::Resize(source, small, 64, 64, ResampleFilters[i]);
+			ImageFilter::Resize(small, restored, 256, 256, ResampleFilters[i]);
+
+			quality[i] = PeakSignalToNoise(source, restored);
+			CORE_CHECK(quality[i] > 40.0);
+		}
+
+		CORE_CHECK(quality[ImageFilter::Bicubic] > quality[ImageFilter::Box]);
+		CORE_CHECK(quality[ImageFilter::Lanczos3] > quality[ImageFilter::Box]);
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief The ringing of the sharper filters must not produce
+	///		   invalid premultiplied pixels at hard edges.
+	/// 
+	////////////////////////////////////////////////////////////
+	void ResizeKeepsPremultipliedPixelsValid()
+	{
+		PixelBuffer source;
+		source.Resize(32, 32);
+
+		for(u32 y = 0; y < 32; ++y)
+		{
+			for(u32 x = 0; x < 32; ++x)
+			{
+				source.SetPixel(x, y, (x / 4 + y / 4) % 2 == 0 ? Color(255, 255, 255) : Color(255, 0, 0, 0));
+			}
+		}
+
+		for(const ImageFilter::ResampleFilter filter : ResampleFilters)
+		{
+			for(const u32 size : { 13u, 77u })
+			{
+				PixelBuffer destination;
+				ImageFilter::Resize(source, destination, size, size, filter);
+
+				for(u32 y = 0; y < size; ++y)
+				{
+					for(u32 x = 0; x < size; ++x)
+					{
+						const u32 pixel = destination.GetPixel(x, y);
+						const u32 alpha = pixel >> 24;
+						CORE_CHECK(((pixel >> 16) & 0xFF) <= alpha && ((pixel >> 8) & 0xFF) <= alpha && (pixel & 0xFF) <= alpha);
+					}
+				}
+			}
+		}
+	}
+}
+
+int main()
+{
+	ConvolveKeepsOpaqueAlpha();
+	ConvolveKeepsTranslucentPixels();
+	ResizeKeepsFlatColor();
+	ResizeToSameSizeIsIdentity();
+	ResizeRoundTripQuality();
+	ResizeKeepsPremultipliedPixelsValid();
+	return Core::Tests::Failures();
+}
\ No newline at end of file
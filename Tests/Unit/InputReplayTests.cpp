@@ -0,0 +1,371 @@
+﻿// 
+// InputReplayTests.cpp
+// Core
+// 
+// Created by Felix Busch on 19.10.2026.
+// Copyright © 2026 Felix Busch. All rights reserved.
+// 
+
+#include <Core/Application/InputRecorder.hpp>
+#include <Core/Application/InputReplay.hpp>
+
+#include "../Check.hpp"
+
+#include <bitset>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <vector>
+
+using namespace Core;
+
+namespace
+{
+	////////////////////////////////////////////////////////////
+	/// The number of frames in the synthetic recording
+	/// 
+	////////////////////////////////////////////////////////////
+	constexpr u32 FrameCount = 300;
+
+	////////////////////////////////////////////////////////////
+	/// \brief Define a frame of the synthetic event stream.
+	/// 
+	////////////////////////////////////////////////////////////
+	struct Frame
+	{
+		Time						DeltaTime;
+		std::vector<WindowEvent>	Events;
+	};
+
+	////////////////////////////////////////////////////////////
+	/// \brief Define everything Input reports after a frame.
+	/// 
+	////////////////////////////////////////////////////////////
+	struct Snapshot
+	{
+		std::bitset<(usize)KeyCode::Count>	KeysDown;
+		std::bitset<(usize)KeyCode::Count>	KeysPressed;
+		std::bitset<(usize)KeyCode::Count>	KeysReleased;
+		u32									ButtonsDown = 0;
+		u32									ButtonsPressed = 0;
+		u32									ButtonsReleased = 0;
+		float								VerticalWheel = 0.0f;
+		float								HorizontalWheel = 0.0f;
+		Int2								MousePosition;
+		Int2								MouseDelta;
+
+		bool operator == (const Snapshot&) const = default;
+	};
+
+	////////////////////////////////////////////////////////////
+	/// \brief Query every key and button of an Input.
+	/// 
+	////////////////////////////////////////////////////////////
+	Snapshot TakeSnapshot(const Input& input)
+	{
+		Snapshot snapshot;
+		for(usize key = 0; key < (usize)KeyCode::Count; ++key)
+		{
+			snapshot.KeysDown[key] = input.IsKeyDown((KeyCode)key);
+			snapshot.KeysPressed[key] = input.IsKeyPressed((KeyCode)key);
+			snapshot.KeysReleased[key] = input.IsKeyReleased((KeyCode)key);
+		}
+
+		for(u32 button = 0; button < (u32)MouseButton::Count; ++button)
+		{
+			snapshot.ButtonsDown |= (u32)input.IsMouseButtonDown((MouseButton)button) << button;
+			snapshot.ButtonsPressed |= (u32)input.IsMouseButtonPressed((MouseButton)button) << button;
+			snapshot.ButtonsReleased |= (u32)input.IsMouseButtonReleased((MouseButton)button) << button;
+		}
+
+		snapshot.VerticalWheel = input.GetMouseWheelDelta(MouseWheel::Vertical);
+		snapshot.HorizontalWheel = input.GetMouseWheelDelta(MouseWheel::Horizontal);
+		snapshot.MousePosition = input.GetMousePosition();
+		snapshot.MouseDelta = input.GetMouseDelta();
+		return snapshot;
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Create a random event of any type the recorder
+	///		   knows about, including Generic ones it skips.
+	/// 
+	////////////////////////////////////////////////////////////
+	WindowEvent MakeEvent(std::mt19937& random)
+	{
+		// a small set of keys, so they get released again
+		constexpr KeyCode Keys[] = { KeyCode::Cancel, KeyCode::Back, KeyCode::Tab, KeyCode::PA1, KeyCode::OemClear };
+
+		const auto pick = [&random](u32 count) { return std::uniform_int_distribution<u32>(0, count - 1)(random); };
+		const i32 x = (i32)pick(1920);
+		const i32 y = (i32)pick(1080);
+
+		switch(pick(10))
+		{
+			case 0:
+			case 1:
+			{
+				WindowEvent event(pick(2) ? WindowEvent::KeyPressed : WindowEvent::KeyReleased);
+				event.Key = { Keys[pick(std::size(Keys))], pick(2) == 0, pick(2) == 0, pick(2) == 0, false };
+				return event;
+			}
+
+			case 2:
+			{
+				WindowEvent event(pick(2) ? WindowEvent::MousePressed : WindowEvent::MouseReleased);
+				event.MouseButton = { (MouseButton)pick((u32)MouseButton::Count), x, y };
+				return event;
+			}
+
+			case 3:
+			{
+				WindowEvent event(WindowEvent::MouseWheelScrolled);
+				event.MouseWheel = { (MouseWheel)pick((u32)MouseWheel::Count), (float)pick(7) - 3.0f, x, y };
+				return event;
+			}
+
+			case 4:
+			case 5:
+			case 6:
+			{
+				WindowEvent event(WindowEvent::MouseMoved);
+				event.MouseMove = { x, y };
+				return event;
+			}
+
+			case 7:
+			{
+				WindowEvent event(WindowEvent::TextEntered);
+				event.Text = { 'a' + pick(26) };
+				return event;
+			}
+
+			case 8:
+			{
+				if(pick(8) == 0)
+				{
+					return WindowEvent(WindowEvent::FocusLost);
+				}
+
+				WindowEvent event(WindowEvent::Resized);
+				event.Size = { (u32)x, (u32)y };
+				return event;
+			}
+
+			default:
+			{
+				return WindowEvent(WindowEvent::Generic);
+			}
+		}
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Create the synthetic event stream.
+	/// 
+	////////////////////////////////////////////////////////////
+	std::vector<Frame> MakeFrames()
+	{
+		std::mt19937 random(7);
+		std::uniform_int_distribution<i64> frameTime(8000, 33000);
+		std::uniform_int_distribution<u32> eventCount(0, 8);
+
+		std::vector<Frame> frames(FrameCount);
+		for(Frame& frame : frames)
+		{
+			frame.DeltaTime = Microseconds(frameTime(random));
+
+			const u32 count = eventCount(random);
+			for(u32 i = 0; i < count; ++i)
+			{
+				frame.Events.push_back(MakeEvent(random));
+			}
+		}
+
+		return frames;
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Get the events of a frame that end up in the
+	///		   recording.
+	/// 
+	////////////////////////////////////////////////////////////
+	std::vector<WindowEvent> GetRecordedEvents(const Frame& frame)
+	{
+		std::vector<WindowEvent> events;
+		for(const WindowEvent& event : frame.Events)
+		{
+			if(event.Type != WindowEvent::Generic)
+			{
+				events.push_back(event);
+			}
+		}
+
+		return events;
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Define a sketch that takes a snapshot of the
+	///		   replayed Input whenever a frame is drawn.
+	/// 
+	////////////////////////////////////////////////////////////
+	class SnapshotSketch : public Sketch
+	{
+	public:
+
+		explicit SnapshotSketch(const Input& input):
+			input(input)
+		{
+		}
+
+		virtual void OnDraw(float deltaTime) override
+		{
+			Snapshots.push_back(TakeSnapshot(input));
+			DeltaTimes.push_back(deltaTime);
+		}
+
+		virtual void OnEvent(const WindowEvent&) override
+		{
+			++EventCount;
+		}
+
+		std::vector<Snapshot>	Snapshots;
+		std::vector<float>		DeltaTimes;
+		u64						EventCount = 0;
+
+	private:
+
+		const Input& input;
+	};
+
+	////////////////////////////////////////////////////////////
+	/// \brief Get a path for a recording in the temp directory.
+	/// 
+	////////////////////////////////////////////////////////////
+	std::filesystem::path MakeTempPath(const char* name)
+	{
+		return std::filesystem::temp_directory_path() / name;
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Record the stream while feeding it to an Input,
+	///		   then replay the recording into another Input. Both
+	///		   must report the same state after every frame.
+	/// 
+	////////////////////////////////////////////////////////////
+	void ReplayMatchesLiveInput()
+	{
+		const std::filesystem::path filepath = MakeTempPath("Core.InputReplayTests.crec");
+		const std::vector<Frame> frames = MakeFrames();
+
+		Input live;
+		std::vector<Snapshot> expected;
+		u64 recordedEvents = 0;
+
+		InputRecorder recorder;
+		CORE_CHECK(recorder.Open(filepath));
+
+		for(const Frame& frame : frames)
+		{
+			live.BeginFrame();
+			for(const WindowEvent& event : frame.Events)
+			{
+				live.OnEvent(event);
+			}
+
+			expected.push_back(TakeSnapshot(live));
+			recorder.WriteFrame(frame.DeltaTime, frame.Events);
+			recordedEvents += GetRecordedEvents(frame).size();
+		}
+
+		CORE_CHECK(recorder.IsOpen());
+		recorder.Close();
+
+		Input replayed;
+		SnapshotSketch sketch(replayed);
+
+		InputReplay replay;
+		CORE_CHECK(replay.Open(filepath));
+
+		const InputReplay::Statistics statistics = replay.Run(sketch, &replayed);
+		replay.Close();
+
+		CORE_CHECK(statistics.FrameCount == FrameCount);
+		CORE_CHECK(statistics.EventCount == recordedEvents);
+		CORE_CHECK(sketch.EventCount == recordedEvents);
+		CORE_CHECK(sketch.Snapshots.size() == FrameCount);
+
+		for(usize i = 0; i < std::min(sketch.Snapshots.size(), expected.size()); ++i)
+		{
+			CORE_CHECK(sketch.Snapshots[i] == expected[i]);
+			CORE_CHECK(sketch.DeltaTimes[i] == frames[i].DeltaTime.ToSeconds<float>());
+		}
+
+		std::filesystem::remove(filepath);
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Read the frames back one by one and compare the
+	///		   events with the ones that were written.
+	/// 
+	////////////////////////////////////////////////////////////
+	void ReadsBackTheEvents()
+	{
+		const std::filesystem::path filepath = MakeTempPath("Core.InputReplayTests.Events.crec");
+		const std::vector<Frame> frames = MakeFrames();
+
+		InputRecorder recorder;
+		CORE_CHECK(recorder.Open(filepath));
+		for(const Frame& frame : frames)
+		{
+			recorder.WriteFrame(frame.DeltaTime, frame.Events);
+		}
+		recorder.Close();
+
+		InputReplay replay;
+		CORE_CHECK(replay.Open(filepath));
+
+		Time deltaTime;
+		std::vector<WindowEvent> events;
+		for(const Frame& frame : frames)
+		{
+			CORE_CHECK(replay.ReadFrame(deltaTime, events));
+			CORE_CHECK(deltaTime == frame.DeltaTime);
+
+			const std::vector<WindowEvent> written = GetRecordedEvents(frame);
+			CORE_CHECK(events.size() == written.size());
+
+			for(usize i = 0; i < std::min(events.size(), written.size()); ++i)
+			{
+				// all data members of the union start at its address
+				CORE_CHECK(events[i].Type == written[i].Type);
+				CORE_CHECK(std::memcmp(&events[i].Size, &written[i].Size, InputRecorder::GetPayloadSize(written[i].Type)) == 0);
+			}
+		}
+
+		// the recording ends after the last frame
+		CORE_CHECK(!replay.ReadFrame(deltaTime, events));
+		replay.Close();
+
+		std::filesystem::remove(filepath);
+	}
+
+	////////////////////////////////////////////////////////////
+	void RejectsOtherFiles()
+	{
+		const std::filesystem::path filepath = MakeTempPath("Core.InputReplayTests.Other.crec");
+		std::ofstream(filepath, std::ios::binary) << "not a recording";
+
+		InputReplay replay;
+		CORE_CHECK(!replay.Open(filepath));
+
+		std::filesystem::remove(filepath);
+	}
+}
+
+int main()
+{
+	ReplayMatchesLiveInput();
+	ReadsBackTheEvents();
+	RejectsOtherFiles();
+	return Core::Tests::Failures();
+}
\ No newline at end of file
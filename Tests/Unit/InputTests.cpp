@@ -0,0 +1,202 @@
+﻿// 
+// InputTests.cpp
+// Core
+// 
+// Created by Felix Busch on 19.10.2026.
+// Copyright © 2026 Felix Busch. All rights reserved.
+// 
+
+#include <Core/Application/Input.hpp>
+
+#include "../Check.hpp"
+
+using namespace Core;
+
+namespace
+{
+	////////////////////////////////////////////////////////////
+	/// \brief Create a key event.
+	/// 
+	////////////////////////////////////////////////////////////
+	WindowEvent MakeKey(WindowEvent::EventType type, KeyCode code)
+	{
+		WindowEvent event(type);
+		event.Key = { code, false, false, false, false };
+		return event;
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Create a mouse button event.
+	/// 
+	////////////////////////////////////////////////////////////
+	WindowEvent MakeButton(WindowEvent::EventType type, MouseButton button)
+	{
+		WindowEvent event(type);
+		event.MouseButton = { button, 0, 0 };
+		return event;
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Create a mouse wheel event.
+	/// 
+	////////////////////////////////////////////////////////////
+	WindowEvent MakeWheel(MouseWheel wheel, float delta)
+	{
+		WindowEvent event(WindowEvent::MouseWheelScrolled);
+		event.MouseWheel = { wheel, delta, 0, 0 };
+		return event;
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Create a mouse move event.
+	/// 
+	////////////////////////////////////////////////////////////
+	WindowEvent MakeMove(int32_t x, int32_t y)
+	{
+		WindowEvent event(WindowEvent::MouseMoved);
+		event.MouseMove = { x, y };
+		return event;
+	}
+
+	////////////////////////////////////////////////////////////
+	void TracksKeyEdges()
+	{
+		Input input;
+		input.BeginFrame();
+		input.OnEvent(MakeKey(WindowEvent::KeyPressed, KeyCode::Cancel));
+		CORE_CHECK(input.IsKeyDown(KeyCode::Cancel));
+		CORE_CHECK(input.IsKeyPressed(KeyCode::Cancel));
+
+		input.BeginFrame();
+		input.OnEvent(MakeKey(WindowEvent::KeyPressed, KeyCode::Cancel));
+		CORE_CHECK(!input.IsKeyPressed(KeyCode::Cancel));
+
+		input.OnEvent(MakeKey(WindowEvent::KeyReleased, KeyCode::Cancel));
+		CORE_CHECK(!input.IsKeyDown(KeyCode::Cancel));
+		CORE_CHECK(input.IsKeyReleased(KeyCode::Cancel));
+	}
+
+	////////////////////////////////////////////////////////////
+	void IgnoresKeysOutOfRange()
+	{
+		const KeyCode invalid[] = { KeyCode::Unknown, KeyCode::Count, (KeyCode)((i32)KeyCode::Count + 1), (KeyCode)-2, (KeyCode)100000 };
+
+		Input input;
+		input.BeginFrame();
+		for(const KeyCode key : invalid)
+		{
+			input.OnEvent(MakeKey(WindowEvent::KeyPressed, key));
+		}
+
+		for(const KeyCode key : invalid)
+		{
+			CORE_CHECK(!input.IsKeyDown(key));
+			CORE_CHECK(!input.IsKeyPressed(key));
+			CORE_CHECK(!input.IsKeyReleased(key));
+		}
+
+		CORE_CHECK(!input.IsKeyDown(KeyCode::Cancel));
+	}
+
+	////////////////////////////////////////////////////////////
+	void IgnoresButtonsOutOfRange()
+	{
+		const MouseButton invalid[] = { MouseButton::Count, (MouseButton)31, (MouseButton)32, (MouseButton)1000 };
+
+		Input input;
+		input.BeginFrame();
+		for(const MouseButton button : invalid)
+		{
+			input.OnEvent(MakeButton(WindowEvent::MousePressed, button));
+		}
+
+		for(const MouseButton button : invalid)
+		{
+			CORE_CHECK(!input.IsMouseButtonDown(button));
+			CORE_CHECK(!input.IsMouseButtonPressed(button));
+		}
+
+		CORE_CHECK(!input.IsMouseButtonDown(MouseButton::Left));
+		CORE_CHECK(!input.IsMouseButtonDown(MouseButton::XButton2));
+	}
+
+	////////////////////////////////////////////////////////////
+	void AccumulatesWheelDeltas()
+	{
+		Input input;
+		input.BeginFrame();
+		input.OnEvent(MakeWheel(MouseWheel::Vertical, 1.0f));
+		input.OnEvent(MakeWheel(MouseWheel::Vertical, 0.5f));
+		input.OnEvent(MakeWheel(MouseWheel::Horizontal, -2.0f));
+		input.OnEvent(MakeWheel(MouseWheel::Count, 3.0f));
+		input.OnEvent(MakeWheel((MouseWheel)5, 3.0f));
+
+		CORE_CHECK(input.GetMouseWheelDelta(MouseWheel::Vertical) == 1.5f);
+		CORE_CHECK(input.GetMouseWheelDelta(MouseWheel::Horizontal) == -2.0f);
+		CORE_CHECK(input.GetMouseWheelDelta(MouseWheel::Count) == 0.0f);
+		CORE_CHECK(input.GetMouseWheelDelta((MouseWheel)5) == 0.0f);
+
+		input.BeginFrame();
+		CORE_CHECK(input.GetMouseWheelDelta(MouseWheel::Vertical) == 0.0f);
+		CORE_CHECK(input.GetMouseWheelDelta(MouseWheel::Horizontal) == 0.0f);
+	}
+
+	////////////////////////////////////////////////////////////
+	void TracksMouseDelta()
+	{
+		Input input;
+		input.BeginFrame();
+
+		// the first position has nothing to move from
+		input.OnEvent(MakeMove(10, 20));
+		CORE_CHECK(input.GetMousePosition() == Int2(10, 20));
+		CORE_CHECK(input.GetMouseDelta() == Int2(0, 0));
+
+		input.OnEvent(MakeMove(13, 18));
+		input.OnEvent(MakeMove(15, 25));
+		CORE_CHECK(input.GetMousePosition() == Int2(15, 25));
+		CORE_CHECK(input.GetMouseDelta() == Int2(5, 5));
+
+		input.BeginFrame();
+		CORE_CHECK(input.GetMouseDelta() == Int2(0, 0));
+
+		input.OnEvent(MakeMove(14, 25));
+		CORE_CHECK(input.GetMouseDelta() == Int2(-1, 0));
+	}
+
+	////////////////////////////////////////////////////////////
+	void ReleasesEverythingOnFocusLost()
+	{
+		Input input;
+		input.BeginFrame();
+		input.OnEvent(MakeKey(WindowEvent::KeyPressed, KeyCode::Cancel));
+		input.OnEvent(MakeButton(WindowEvent::MousePressed, MouseButton::Left));
+		input.OnEvent(MakeButton(WindowEvent::MousePressed, MouseButton::XButton2));
+
+		input.BeginFrame();
+		input.OnEvent(WindowEvent(WindowEvent::FocusLost));
+
+		CORE_CHECK(!input.IsKeyDown(KeyCode::Cancel));
+		CORE_CHECK(input.IsKeyReleased(KeyCode::Cancel));
+		CORE_CHECK(!input.IsMouseButtonDown(MouseButton::Left));
+		CORE_CHECK(input.IsMouseButtonReleased(MouseButton::Left));
+		CORE_CHECK(!input.IsMouseButtonDown(MouseButton::XButton2));
+		CORE_CHECK(input.IsMouseButtonReleased(MouseButton::XButton2));
+
+		// the release edges only last for one frame
+		input.BeginFrame();
+		CORE_CHECK(!input.IsKeyReleased(KeyCode::Cancel));
+		CORE_CHECK(!input.IsMouseButtonReleased(MouseButton::Left));
+	}
+}
+
+int main()
+{
+	TracksKeyEdges();
+	IgnoresKeysOutOfRange();
+	IgnoresButtonsOutOfRange();
+	AccumulatesWheelDeltas();
+	TracksMouseDelta();
+	ReleasesEverythingOnFocusLost();
+	return Core::Tests::Failures();
+}
\ No newline at end of file
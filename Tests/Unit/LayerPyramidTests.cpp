@@ -0,0 +1,392 @@
+﻿// 
+// LayerPyramidTests.cpp
+// Core
+// 
+// Created by Felix Busch on 19.10.2026.
+// Copyright © 2026 Felix Busch. All rights reserved.
+// 
+
+#include <Core/Graphics/LayerPyramid.hpp>
+
+#include "../Check.hpp"
+
+#include <algorithm>
+#include <map>
+
+using namespace Core;
+
+namespace
+{
+	////////////////////////////////////////////////////////////
+	/// The memory of a layer of 32x32 tiles with 32x32 pixels
+	/// 
+	////////////////////////////////////////////////////////////
+	constexpr usize LayerBytes = 1024 * 1024 * 4;
+
+	////////////////////////////////////////////////////////////
+	/// A time budget that never runs out
+	/// 
+	////////////////////////////////////////////////////////////
+	const Time Unlimited = Time::FromSeconds(1000.0);
+
+	////////////////////////////////////////////////////////////
+	/// \brief Define a renderer that models the content of every
+	///		   layer as the version of each chunk it shows.
+	/// 
+	////////////////////////////////////////////////////////////
+	class Recorder : public LayerPyramid::Renderer
+	{
+	public:
+
+		using Content = std::map<u32, u32>;
+
+		Recorder(const LayerPyramid& pyramid):
+			pyramid(pyramid)
+		{
+			versions.assign((usize)pyramid.GetWidth(0) * pyramid.GetHeight(0), 0);
+		}
+
+		virtual bool CreateLayer(u32 level, u32 x, u32 y) override
+		{
+			CORE_CHECK(layers.count(Key(level, x, y)) == 0);
+			layers[Key(level, x, y)] = {};
+			Peak = std::max(Peak, layers.size());
+			return true;
+		}
+
+		virtual void ReleaseLayer(u32 level, u32 x, u32 y) override
+		{
+			CORE_CHECK(layers.erase(Key(level, x, y)) == 1);
+		}
+
+		virtual bool RenderChunk(u32 x, u32 y) override
+		{
+			CORE_CHECK(layers.count(Key(0, x, y)) == 1);
+			layers[Key(0, x, y)] = { { Chunk(x, y), versions[Chunk(x, y)] } };
+			++Chunks;
+			return true;
+		}
+
+		virtual bool RenderQuadrant(u32 level, u32 x, u32 y, u32 quadrant, bool empty) override
+		{
+			CORE_CHECK(layers.count(Key(level, x, y)) == 1);
+			Content& layer = layers[Key(level, x, y)];
+
+			const u32 childX = x * 2 + (quadrant & 1);
+			const u32 childY = y * 2 + (quadrant >> 1);
+			const u32 side = 1u << (level - 1);
+			std::erase_if(layer, [&](const auto& entry)
+			{
+				const u32 chunkX = entry.first % pyramid.GetWidth(0);
+				const u32 chunkY = entry.first / pyramid.GetWidth(0);
+				return chunkX / side == childX && chunkY / side == childY;
+			});
+
+			if(!empty)
+			{
+				CORE_CHECK(layers.count(Key(level - 1, childX, childY)) == 1);
+				for(const auto& entry : layers[Key(level - 1, childX, childY)])
+				{
+					layer.insert(entry);
+				}
+			}
+
+			++Quadrants;
+			return true;
+		}
+
+		virtual bool RenderCell(u32 level, u32 x, u32 y, u32 chunkX, u32 chunkY, bool empty) override
+		{
+			CORE_CHECK(layers.count(Key(level, x, y)) == 1);
+			CORE_CHECK(chunkX >> level == x && chunkY >> level == y);
+
+			Content& layer = layers[Key(level, x, y)];
+			layer.erase(Chunk(chunkX, chunkY));
+			if(!empty)
+			{
+				layer[Chunk(chunkX, chunkY)] = versions[Chunk(chunkX, chunkY)];
+			}
+
+			++Cells;
+			return true;
+		}
+
+		////////////////////////////////////////////////////////////
+		/// \brief Change a chunk like TileMap::SetTile() does.
+		/// 
+		////////////////////////////////////////////////////////////
+		void Edit(LayerPyramid& target, u32 x, u32 y, i32 delta)
+		{
+			++versions[Chunk(x, y)];
+			target.Invalidate(x, y, delta);
+		}
+
+		////////////////////////////////////////////////////////////
+		/// \brief Check that a layer shows the current version of
+		///		   every non-empty chunk it covers and nothing else.
+		/// 
+		////////////////////////////////////////////////////////////
+		bool Shows(u32 level, u32 x, u32 y) const
+		{
+			const auto layer = layers.find(Key(level, x, y));
+			if(layer == layers.end())
+			{
+				return false;
+			}
+
+			Content expected;
+			for(u32 chunkY = y << level; chunkY < std::min((y + 1) << level, pyramid.GetHeight(0)); ++chunkY)
+			{
+				for(u32 chunkX = x << level; chunkX < std::min((x + 1) << level, pyramid.GetWidth(0)); ++chunkX)
+				{
+					if(pyramid.GetCount(0, chunkX, chunkY) > 0)
+					{
+						expected[Chunk(chunkX, chunkY)] = versions[Chunk(chunkX, chunkY)];
+					}
+				}
+			}
+
+			return layer->second == expected;
+		}
+
+		usize	Peak = 0;
+		u32		Chunks = 0;
+		u32		Quadrants = 0;
+		u32		Cells = 0;
+
+	private:
+
+		static u64 Key(u32 level, u32 x, u32 y)
+		{
+			return ((u64)level << 48) | ((u64)y << 24) | x;
+		}
+
+		u32 Chunk(u32 x, u32 y) const
+		{
+			return y * pyramid.GetWidth(0) + x;
+		}
+
+		const LayerPyramid&		pyramid;
+		std::vector<u32>		versions;
+		std::map<u64, Content>	layers;
+	};
+
+	////////////////////////////////////////////////////////////
+	/// \brief Create a pyramid for a map full of tiles.
+	/// 
+	////////////////////////////////////////////////////////////
+	void CreateFull(LayerPyramid& pyramid, u32 chunks, usize budgetLayers)
+	{
+		pyramid.Create(chunks, chunks, LayerBytes, budgetLayers * LayerBytes);
+		pyramid.Reset(std::vector<u32>((usize)chunks * chunks, 1024));
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Draw the whole map on the top level, as TileMap
+	///		   does when it is zoomed out completely.
+	/// 
+	////////////////////////////////////////////////////////////
+	bool DrawTop(LayerPyramid& pyramid, Recorder& recorder, const Time& budget)
+	{
+		pyramid.BeginFrame(budget);
+		return pyramid.Build(recorder, pyramid.GetLevelCount() - 1, 0, 0);
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Building the top of a 4096x4096 tile map must not
+	///		   keep the whole pyramid alive.
+	/// 
+	////////////////////////////////////////////////////////////
+	void ZoomedOutStaysInBudget()
+	{
+		LayerPyramid pyramid;
+		CreateFull(pyramid, 128, 16);
+		Recorder recorder(pyramid);
+
+		const u32 top = pyramid.GetLevelCount() - 1;
+		CORE_CHECK(DrawTop(pyramid, recorder, Unlimited));
+		CORE_CHECK(recorder.Shows(top, 0, 0));
+		CORE_CHECK(recorder.Chunks == 128 * 128);
+		CORE_CHECK(recorder.Peak <= 16 + pyramid.GetLevelCount());
+		CORE_CHECK(pyramid.GetUsedBytes() <= 16 * LayerBytes);
+
+		u32 level = 0;
+		CORE_CHECK(pyramid.FindFallback(top, 0, 0, level) && level == top);
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief With the smallest time budget the map must still
+	///		   complete, one piece per frame.
+	/// 
+	////////////////////////////////////////////////////////////
+	void CompletesAcrossFrames()
+	{
+		LayerPyramid pyramid;
+		CreateFull(pyramid, 16, 4);
+		Recorder recorder(pyramid);
+
+		u32 frames = 1;
+		while(!DrawTop(pyramid, recorder, Time::Zero) && frames < 10000)
+		{
+			++frames;
+		}
+
+		CORE_CHECK(frames > 1 && frames < 10000);
+		CORE_CHECK(recorder.Shows(pyramid.GetLevelCount() - 1, 0, 0));
+		CORE_CHECK(recorder.Chunks == 16 * 16);
+		CORE_CHECK(recorder.Peak <= 4 + pyramid.GetLevelCount());
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Evicted children must not keep their parent from
+	///		   being rendered again.
+	/// 
+	////////////////////////////////////////////////////////////
+	void RebuildsAfterEviction()
+	{
+		LayerPyramid pyramid;
+		CreateFull(pyramid, 32, 8);
+		Recorder recorder(pyramid);
+		CORE_CHECK(DrawTop(pyramid, recorder, Unlimited));
+
+		// scroll over the chunks until the coarse layers are gone
+		for(u32 y = 0; y < 32; ++y)
+		{
+			pyramid.BeginFrame(Unlimited);
+			for(u32 x = 0; x < 32; ++x)
+			{
+				CORE_CHECK(pyramid.Build(recorder, 0, x, y));
+				CORE_CHECK(recorder.Shows(0, x, y));
+			}
+		}
+
+		recorder.Edit(pyramid, 5, 7, 0);
+		CORE_CHECK(DrawTop(pyramid, recorder, Unlimited));
+		CORE_CHECK(recorder.Shows(pyramid.GetLevelCount() - 1, 0, 0));
+		CORE_CHECK(pyramid.GetUsedBytes() <= 8 * LayerBytes);
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief A changed chunk only renders its cell of the top
+	///		   layer again, even when the layers below are gone.
+	/// 
+	////////////////////////////////////////////////////////////
+	void EditRendersOneCell()
+	{
+		LayerPyramid pyramid;
+		CreateFull(pyramid, 32, 8);
+		Recorder recorder(pyramid);
+		CORE_CHECK(DrawTop(pyramid, recorder, Unlimited));
+
+		recorder.Chunks = 0;
+		recorder.Quadrants = 0;
+		recorder.Edit(pyramid, 17, 3, -1);
+		recorder.Edit(pyramid, 17, 3, 0);
+		CORE_CHECK(DrawTop(pyramid, recorder, Unlimited));
+
+		const u32 top = pyramid.GetLevelCount() - 1;
+		CORE_CHECK(recorder.Shows(top, 0, 0));
+		CORE_CHECK(recorder.Chunks == 0 && recorder.Quadrants == 0 && recorder.Cells == 1);
+		CORE_CHECK(pyramid.GetCount(top, 0, 0) == 32 * 32 * 1024 - 1);
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Edits must show up on every level, including
+	///		   chunks that become empty.
+	/// 
+	////////////////////////////////////////////////////////////
+	void EditsReachEveryLevel()
+	{
+		LayerPyramid pyramid;
+		CreateFull(pyramid, 12, 4096);
+		Recorder recorder(pyramid);
+
+		const auto buildAll = [&]()
+		{
+			pyramid.BeginFrame(Unlimited);
+			for(u32 level = 0; level < pyramid.GetLevelCount(); ++level)
+			{
+				for(u32 y = 0; y < pyramid.GetHeight(level); ++y)
+				{
+					for(u32 x = 0; x < pyramid.GetWidth(level); ++x)
+					{
+						CORE_CHECK(pyramid.Build(recorder, level, x, y));
+						CORE_CHECK(pyramid.GetCount(level, x, y) == 0 || recorder.Shows(level, x, y));
+					}
+				}
+			}
+		};
+
+		buildAll();
+
+		recorder.Edit(pyramid, 0, 0, 0);
+		recorder.Edit(pyramid, 11, 11, -1024);
+		recorder.Edit(pyramid, 6, 9, 0);
+		recorder.Edit(pyramid, 6, 9, 0);
+		recorder.Edit(pyramid, 7, 2, -1024);
+		recorder.Edit(pyramid, 7, 2, 5);
+		buildAll();
+
+		CORE_CHECK(pyramid.GetCount(0, 11, 11) == 0);
+		CORE_CHECK(pyramid.GetCount(0, 7, 2) == 5);
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief An outdated layer stands in for itself while it is
+	///		   rendered again, a new one does not.
+	/// 
+	////////////////////////////////////////////////////////////
+	void FallbackNeedsCompleteLayer()
+	{
+		LayerPyramid pyramid;
+		CreateFull(pyramid, 8, 64);
+		Recorder recorder(pyramid);
+
+		const u32 top = pyramid.GetLevelCount() - 1;
+		u32 level = 0;
+
+		CORE_CHECK(!DrawTop(pyramid, recorder, Time::Zero));
+		CORE_CHECK(!pyramid.FindFallback(top, 0, 0, level));
+
+		while(!DrawTop(pyramid, recorder, Unlimited))
+		{
+		}
+
+		pyramid.Reset(std::vector<u32>(8 * 8, 1024));
+		CORE_CHECK(!DrawTop(pyramid, recorder, Time::Zero));
+		CORE_CHECK(pyramid.FindFallback(top, 0, 0, level) && level == top);
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Empty areas and partial edges are not rendered.
+	/// 
+	////////////////////////////////////////////////////////////
+	void SkipsEmptyChunks()
+	{
+		LayerPyramid pyramid;
+		pyramid.Create(5, 3, LayerBytes, 64 * LayerBytes);
+
+		std::vector<u32> counts(5 * 3, 0);
+		counts[4] = 10;
+		counts[10] = 3;
+		pyramid.Reset(counts);
+
+		Recorder recorder(pyramid);
+		CORE_CHECK(DrawTop(pyramid, recorder, Unlimited));
+		CORE_CHECK(recorder.Shows(pyramid.GetLevelCount() - 1, 0, 0));
+		CORE_CHECK(recorder.Chunks == 2);
+		CORE_CHECK(pyramid.GetCount(pyramid.GetLevelCount() - 1, 0, 0) == 13);
+	}
+}
+
+int main()
+{
+	ZoomedOutStaysInBudget();
+	CompletesAcrossFrames();
+	RebuildsAfterEviction();
+	EditRendersOneCell();
+	EditsReachEveryLevel();
+	FallbackNeedsCompleteLayer();
+	SkipsEmptyChunks();
+	return Core::Tests::Failures();
+}
\ No newline at end of file
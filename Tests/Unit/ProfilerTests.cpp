@@ -0,0 +1,186 @@
+﻿// 
+// ProfilerTests.cpp
+// Core
+// 
+// Created by Felix Busch on 19.10.2026.
+// Copyright © 2026 Felix Busch. All rights reserved.
+// 
+
+#include <Core/System/Profiler.hpp>
+#include <Core/System/Types.hpp>
+
+#include "../Check.hpp"
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <thread>
+
+using namespace Core;
+
+namespace
+{
+	////////////////////////////////////////////////////////////
+	/// \brief Get the path of a trace file in the temp directory.
+	/// 
+	////////////////////////////////////////////////////////////
+	std::filesystem::path GetTracePath(const char* name)
+	{
+		return std::filesystem::temp_directory_path() / name;
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Read a trace file.
+	/// 
+	////////////////////////////////////////////////////////////
+	std::string ReadTrace(const std::filesystem::path& filepath)
+	{
+		std::ifstream file(filepath);
+		std::stringstream content;
+		content << file.rdbuf();
+		return content.str();
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Count the occurrences of a string.
+	/// 
+	////////////////////////////////////////////////////////////
+	usize Count(const std::string& text, const std::string& pattern)
+	{
+		usize count = 0;
+		for(usize position = text.find(pattern); position != std::string::npos; position = text.find(pattern, position + 1))
+		{
+			++count;
+		}
+
+		return count;
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Check that every end event of the trace closes
+	///		   the most recent open begin event of its thread.
+	/// 
+	///	The trace must have been written by a single thread.
+	/// 
+	////////////////////////////////////////////////////////////
+	bool IsBalanced(const std::string& trace)
+	{
+		i64 depth = 0;
+		for(usize position = trace.find("\"ph\":\""); position != std::string::npos; position = trace.find("\"ph\":\"", position + 1))
+		{
+			const char phase = trace[position + 6];
+			depth += phase == 'B' ? 1 : phase == 'E' ? -1 : 0;
+
+			if(depth < 0)
+			{
+				return false;
+			}
+		}
+
+		return depth == 0;
+	}
+
+	////////////////////////////////////////////////////////////
+	void EndsScopesOpenAtStop()
+	{
+		const std::filesystem::path path = GetTracePath("CoreProfilerOpenAtStop.json");
+		CORE_CHECK(Profiler::Start(path));
+
+		std::optional<ProfileScope> outer;
+		outer.emplace("Outer");
+		{
+			CORE_PROFILE_SCOPE("Closed");
+		}
+		std::optional<ProfileScope> inner;
+		inner.emplace("Inner");
+
+		Profiler::Stop();
+		inner.reset();
+		outer.reset();
+
+		const std::string trace = ReadTrace(path);
+		CORE_CHECK(IsBalanced(trace));
+		CORE_CHECK(Count(trace, "\"ph\":\"B\"") == 3);
+		CORE_CHECK(Count(trace, "\"ph\":\"E\"") == 3);
+		CORE_CHECK(trace.rfind("\"name\":\"Outer\"") > trace.rfind("\"name\":\"Inner\""));
+	}
+
+	////////////////////////////////////////////////////////////
+	void LeavesOutEndsWithoutBegin()
+	{
+		const std::filesystem::path first = GetTracePath("CoreProfilerFirst.json");
+		const std::filesystem::path second = GetTracePath("CoreProfilerSecond.json");
+
+		CORE_CHECK(Profiler::Start(first));
+		std::optional<ProfileScope> scope;
+		scope.emplace("SpansSessions");
+		Profiler::Stop();
+
+		// the end record lands in a session that never saw the begin
+		CORE_CHECK(Profiler::Start(second));
+		scope.reset();
+		{
+			CORE_PROFILE_SCOPE("Second");
+		}
+		Profiler::Stop();
+
+		const std::string trace = ReadTrace(second);
+		CORE_CHECK(IsBalanced(trace));
+		CORE_CHECK(Count(trace, "SpansSessions") == 0);
+		CORE_CHECK(Count(trace, "\"name\":\"Second\"") == 2);
+	}
+
+	////////////////////////////////////////////////////////////
+	void RecyclesBuffersOfEndedThreads()
+	{
+		constexpr u32 ThreadCount = 32;
+		const std::filesystem::path path = GetTracePath("CoreProfilerThreads.json");
+
+		// buffers are recycled both during and between sessions
+		for(const bool running : { true, false })
+		{
+			if(running)
+			{
+				CORE_CHECK(Profiler::Start(path));
+			}
+
+			const unsigned long long before = Profiler::GetBufferCount();
+			for(u32 i = 0; i < ThreadCount; ++i)
+			{
+				std::thread([]
+				{
+					CORE_PROFILE_THREAD("Worker");
+					CORE_PROFILE_SCOPE("Work");
+				}).join();
+
+				// during a session the buffer comes back once the flusher drained it
+				if(running)
+				{
+					std::this_thread::sleep_for(std::chrono::milliseconds(25));
+				}
+
+				CORE_CHECK(Profiler::GetBufferCount() <= before + 1);
+			}
+
+			if(running)
+			{
+				Profiler::Stop();
+
+				const std::string trace = ReadTrace(path);
+				CORE_CHECK(Count(trace, "\"name\":\"Work\"") == 2 * ThreadCount);
+				CORE_CHECK(Count(trace, "\"thread_name\"") == ThreadCount);
+			}
+		}
+	}
+}
+
+int main()
+{
+	EndsScopesOpenAtStop();
+	LeavesOutEndsWithoutBegin();
+	RecyclesBuffersOfEndedThreads();
+	return Core::Tests::Failures();
+}
\ No newline at end of file
@@ -0,0 +1,117 @@
+﻿// 
+// TransformTests.cpp
+// Core
+// 
+// Created by Felix Busch on 19.10.2026.
+// Copyright © 2026 Felix Busch. All rights reserved.
+// 
+
+#include <Core/System/Transform.hpp>
+
+#include "../Check.hpp"
+#include "../LegacyTransform.hpp"
+
+#include <cmath>
+#include <random>
+
+using namespace Core;
+
+namespace
+{
+	////////////////////////////////////////////////////////////
+	/// The number of random matrices per test
+	/// 
+	////////////////////////////////////////////////////////////
+	constexpr int SampleCount = 1000;
+
+	////////////////////////////////////////////////////////////
+	/// \brief Create an invertible matrix with random entries.
+	/// 
+	////////////////////////////////////////////////////////////
+	Transform MakeTransform(std::mt19937& random)
+	{
+		std::uniform_real_distribution<float> distribution(-1.0f, 1.0f);
+
+		float data[16];
+		for(int i = 0; i < 16; ++i)
+		{
+			data[i] = distribution(random) + (i % 5 == 0 ? 4.0f : 0.0f);
+		}
+
+		return { data };
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Get the largest difference between two matrices.
+	/// 
+	////////////////////////////////////////////////////////////
+	float MaxDifference(const Transform& lhs, const Transform& rhs)
+	{
+		float difference = 0.0f;
+		for(int i = 0; i < 16; ++i)
+		{
+			difference = std::max(difference, std::abs(lhs.GetData()[i] - rhs.GetData()[i]));
+		}
+
+		return difference;
+	}
+
+	////////////////////////////////////////////////////////////
+	void ComposesTransforms()
+	{
+		std::mt19937 random(1);
+		for(int i = 0; i < SampleCount; ++i)
+		{
+			const Transform transform = MakeTransform(random);
+			CORE_CHECK(transform * Transform::Identity == transform);
+			CORE_CHECK(Transform::Identity * transform == transform);
+		}
+
+		// the left-hand side is applied first
+		const Transform transform = Transform::Translation(10.0f, 20.0f) * Transform::Scaling(2.0f, 3.0f);
+		CORE_CHECK(transform.TransformPoint(1.0f, 1.0f) == Float2(22.0f, 63.0f));
+	}
+
+	////////////////////////////////////////////////////////////
+	void InverseMatchesLegacy()
+	{
+		std::mt19937 random(2);
+		for(int i = 0; i < SampleCount; ++i)
+		{
+			const Transform transform = MakeTransform(random);
+			const Transform inverse = transform.Inverse();
+
+			CORE_CHECK(MaxDifference(inverse, Tests::LegacyInverse(transform)) < 1e-5f);
+			CORE_CHECK(MaxDifference(transform * inverse, Transform::Identity) < 1e-5f);
+			CORE_CHECK(MaxDifference(inverse * transform, Transform::Identity) < 1e-5f);
+		}
+	}
+
+	////////////////////////////////////////////////////////////
+	void InvertsAffineTransforms()
+	{
+		Transform transform;
+		transform.Translate(20.0f, -10.0f).Rotate(Degrees(30.0f)).Scale(2.0f, 0.5f);
+
+		const Float2 point = transform.TransformPoint(3.0f, 4.0f);
+		const Float2 back = transform.Inverse().TransformPoint(point);
+		CORE_CHECK(std::abs(back.X - 3.0f) < 1e-4f);
+		CORE_CHECK(std::abs(back.Y - 4.0f) < 1e-4f);
+	}
+
+	////////////////////////////////////////////////////////////
+	void KeepsSingularTransforms()
+	{
+		const Transform singular = Transform::Scaling(0.0f, 1.0f);
+		CORE_CHECK(singular.Inverse() == singular);
+	}
+}
+
+int main()
+{
+	ComposesTransforms();
+	InverseMatchesLegacy();
+	InvertsAffineTransforms();
+	KeepsSingularTransforms();
+	return Core::Tests::Failures();
+}
\ No newline at end of file